@@ -6,17 +6,25 @@ void GeometryCore::Geometry::importSTEP(const std::string& filePath){
 
     GeometryCore::STEPImporter importer;
     importer.import(filePath, _subject);
-    this->_shapesMap = std::move(importer.getPartsMap());
-    for(auto shape : _shapesMap){
-        this->_tagMap.tagEntities(shape.second);
-    }
+    this->addParts(importer.getPartsMap());
 };
 void GeometryCore::Geometry::importSTL(const std::string& filePath){
     GeometryCore::STLImporter importer;
     importer.import(filePath, _subject);
-    this->_shapesMap = std::move(importer.getPartsMap());
-    for(auto shape : _shapesMap){
-        this->_tagMap.tagEntities(shape.second);
+    this->addParts(importer.getPartsMap());
+};
+
+void GeometryCore::Geometry::addParts(const PartsMap& partsMap){
+    // Parts from consecutive imports are accumulated, so that renderer is able
+    // to tell which of them are new. Colliding names get numeric suffix.
+    for(const auto& [name, shape] : partsMap){
+        std::string uniqueName = name;
+        int suffix = 1;
+        while(_shapesMap.find(uniqueName) != _shapesMap.end()){
+            uniqueName = name + "_" + std::to_string(suffix++);
+        }
+        _shapesMap.emplace(uniqueName, shape);
+        this->_tagMap.tagEntities(shape);
     }
 };
 
@@ -36,7 +36,8 @@ namespace GeometryCore {
 
     private:
 
-        
+        void addParts(const PartsMap& partsMap);
+
         const ModelSubject& _subject;
         PartsMap _shapesMap;
         TagMap _tagMap;
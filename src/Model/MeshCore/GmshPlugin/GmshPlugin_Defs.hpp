@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : GmshPlugin_Defs.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#ifndef GMSHPLUGIN_DEFS_HPP
+#define GMSHPLUGIN_DEFS_HPP
+
+#ifdef WIN32
+#if defined GMSHPLUGIN_EXPORTS
+#define GMSHPLUGIN_EXPORT __declspec(dllexport)
+#else
+#define GMSHPLUGIN_EXPORT __declspec(dllimport)
+#endif
+#else
+#define GMSHPLUGIN_EXPORT
+#endif
+
+#endif
@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : GmshPlugin_Gmsh2VTK.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#include "GmshPlugin_Gmsh2VTK.hpp"
+#include "MGTMesh_MeshObject.hpp"
+#include "MGTMesh_Renumbering.hpp"
+
+#include <vtkCellType.h>
+#include <vtkNew.h>
+#include <vtkSMPTools.h>
+
+#include <gmsh.h_cwrap>
+
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+#include <map>
+#include <string>
+
+namespace {
+
+// Elements of single Gmsh type generated on single entity
+struct ElementChunk {
+	int tag;
+	int nodesNb;
+	std::vector<std::size_t> nodeTags;
+};
+
+// Higher order elements are converted to linear ones, Gmsh stores corner nodes first
+int GetCellType(const int dimension, const int cornersNb) {
+	if (dimension == 2) {
+		switch (cornersNb) {
+		case 3:
+			return VTK_TRIANGLE;
+		case 4:
+			return VTK_QUAD;
+		default:
+			return 0;
+		}
+	}
+	if (dimension == 3) {
+		switch (cornersNb) {
+		case 4:
+			return VTK_TETRA;
+		case 5:
+			return VTK_PYRAMID;
+		case 6:
+			return VTK_WEDGE;
+		case 8:
+			return VTK_HEXAHEDRON;
+		default:
+			return 0;
+		}
+	}
+	return 0;
+}
+
+}
+
+//----------------------------------------------------------------------------
+GmshPlugin_Gmsh2VTK::GmshPlugin_Gmsh2VTK(const bool renumber)
+	: _renumber(renumber) { }
+
+//----------------------------------------------------------------------------
+std::vector<std::int32_t> GmshPlugin_Gmsh2VTK::PopulateMeshNodes(
+	MGTMesh_MeshData* meshData) const {
+	std::vector<std::size_t> nodeTags;
+	std::vector<double> coords;
+	std::vector<double> parametricCoords;
+	gmsh::model::mesh::getNodes(nodeTags, coords, parametricCoords, -1, -1, false, false);
+
+	const auto nbN = static_cast<vtkIdType>(nodeTags.size());
+	const std::span<double> nodes = meshData->AllocateNodes(nbN);
+	if (nodes.empty())
+		return {};
+
+	// Note: Gmsh tags are 1-based and need not be contiguous
+	const std::size_t maxTag = *std::max_element(nodeTags.begin(), nodeTags.end());
+	std::vector<std::int32_t> nodeIndices(maxTag + 1, -1);
+	vtkSMPTools::For(0, nbN, [&](vtkIdType begin, vtkIdType end) {
+		std::copy(coords.begin() + 3 * begin, coords.begin() + 3 * end, nodes.begin() + 3 * begin);
+		for (vtkIdType i = begin; i < end; ++i)
+			nodeIndices[nodeTags[i]] = static_cast<std::int32_t>(i);
+	});
+	return nodeIndices;
+}
+
+//----------------------------------------------------------------------------
+void GmshPlugin_Gmsh2VTK::PopulateElements(MGTMesh_MeshData* meshData,
+	const MGTMesh_MeshData::Dimension dimension,
+	const std::vector<std::int32_t>& nodeIndices) const {
+	gmsh::vectorpair entities;
+	gmsh::model::getEntities(entities, dimension == MGTMesh_MeshData::Dimension::Volume ? 3 : 2);
+
+	// Chunks grouped by VTK cell type, so that each type forms single block
+	std::map<int, std::vector<ElementChunk>> groups;
+	for (const auto& [entityDim, entityTag] : entities) {
+		std::vector<int> types;
+		std::vector<std::vector<std::size_t>> elementTags;
+		std::vector<std::vector<std::size_t>> nodeTags;
+		gmsh::model::mesh::getElements(types, elementTags, nodeTags, entityDim, entityTag);
+
+		for (std::size_t i = 0; i < types.size(); ++i) {
+			std::string name;
+			int typeDim, order, nodesNb, cornersNb;
+			std::vector<double> localCoords;
+			gmsh::model::mesh::getElementProperties(
+				types[i], name, typeDim, order, nodesNb, localCoords, cornersNb);
+
+			const int cellType = GetCellType(typeDim, cornersNb);
+			if (cellType == 0) {
+				SPDLOG_ERROR("Unsupported element type encountered on entity {}: {}",
+					entityTag, name);
+				continue;
+			}
+			groups[cellType].push_back({ entityTag, nodesNb, std::move(nodeTags[i]) });
+		}
+	}
+
+	for (const auto& [cellType, chunks] : groups) {
+		std::vector<vtkIdType> firstElements;
+		vtkIdType elementsNb = 0;
+		for (const ElementChunk& chunk : chunks) {
+			firstElements.push_back(elementsNb);
+			elementsNb += static_cast<vtkIdType>(chunk.nodeTags.size() / chunk.nodesNb);
+		}
+
+		const auto block = meshData->AppendBlock(dimension, cellType, elementsNb);
+		const int cornersNb = MGTMesh_MeshData::GetNodesNb(cellType);
+		for (std::size_t c = 0; c < chunks.size(); ++c) {
+			const ElementChunk& chunk = chunks[c];
+			const vtkIdType first = firstElements[c];
+			vtkSMPTools::For(0, static_cast<vtkIdType>(chunk.nodeTags.size() / chunk.nodesNb),
+				[&](vtkIdType begin, vtkIdType end) {
+					for (vtkIdType i = begin; i < end; ++i) {
+						for (int j = 0; j < cornersNb; ++j)
+							block.connectivity[(first + i) * cornersNb + j]
+								= nodeIndices[chunk.nodeTags[i * chunk.nodesNb + j]];
+						block.tags[first + i] = chunk.tag;
+					}
+				});
+		}
+	}
+}
+
+//----------------------------------------------------------------------------
+void GmshPlugin_Gmsh2VTK::ConvertToMeshData(MGTMesh_MeshObject* mesh) const {
+	vtkNew<MGTMesh_MeshData> meshData;
+	const std::vector<std::int32_t> nodeIndices = this->PopulateMeshNodes(meshData);
+	this->PopulateElements(meshData, MGTMesh_MeshData::Dimension::Surface, nodeIndices);
+	this->PopulateElements(meshData, MGTMesh_MeshData::Dimension::Volume, nodeIndices);
+
+	if (meshData->GetNumberOfElements(MGTMesh_MeshData::Dimension::Surface) == 0)
+		SPDLOG_WARN("No surface elements found in the Gmsh mesh.");
+
+	if (_renumber)
+		MGTMesh_Renumbering::Renumber(meshData);
+
+	mesh->SetMeshData(meshData);
+	SPDLOG_INFO("Mesh conversion completed: {} points, {} volume and {} surface elements, "
+				"{} bytes of mesh data.",
+		meshData->GetNumberOfNodes(),
+		meshData->GetNumberOfElements(MGTMesh_MeshData::Dimension::Volume),
+		meshData->GetNumberOfElements(MGTMesh_MeshData::Dimension::Surface),
+		meshData->GetMemorySize());
+}
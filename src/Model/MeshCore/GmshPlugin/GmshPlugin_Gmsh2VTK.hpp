@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : GmshPlugin_Gmsh2VTK.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef GMSHPLUGIN_GMSH2VTK_HPP
+#define GMSHPLUGIN_GMSH2VTK_HPP
+
+#include "GmshPlugin_Defs.hpp"
+#include "MGTMesh_MeshData.hpp"
+
+#include <cstdint>
+#include <vector>
+
+class MGTMesh_MeshObject;
+
+class GMSHPLUGIN_EXPORT GmshPlugin_Gmsh2VTK {
+public:
+	explicit GmshPlugin_Gmsh2VTK(bool renumber = false);
+
+public:
+	// Converts nodes, surface elements and volume elements (if any) of the current Gmsh
+	// model to native mesh data, blocks of the mesh object become views of it. Elements
+	// are tagged with tags of the Gmsh entities they were generated on. Nodes and
+	// elements are renumbered for cache locality if requested.
+	void ConvertToMeshData(MGTMesh_MeshObject* mesh) const;
+
+private:
+	// Returns indices of nodes by their Gmsh tags, -1 for unused tags
+	std::vector<std::int32_t> PopulateMeshNodes(MGTMesh_MeshData* meshData) const;
+	void PopulateElements(MGTMesh_MeshData* meshData, MGTMesh_MeshData::Dimension dimension,
+		const std::vector<std::int32_t>& nodeIndices) const;
+
+private:
+	bool _renumber;
+};
+
+#endif
@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : GmshPlugin_Mesher.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#include "GmshPlugin_Mesher.hpp"
+#include "GmshPlugin_Gmsh2VTK.hpp"
+#include "MGTMeshUtils_ComputeError.hpp"
+#include "MGTMesh_Algorithm.hpp"
+#include "MGTMesh_SizeField.hpp"
+
+#include <Standard_Failure.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <vtkSMPTools.h>
+
+#include <gmsh.h_cwrap>
+
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <numbers>
+#include <stdexcept>
+
+namespace {
+
+// Gmsh algorithm IDs
+constexpr int FrontalDelaunay = 6;
+constexpr int FrontalDelaunayForQuads = 8;
+constexpr int Hxt = 10;
+
+std::mutex gmshMutex;
+
+// Scales sizes like Netgen presets of the same fineness
+double getSizeFactor(const MGTMesh_MeshParameters::Fineness fineness) {
+	switch (fineness) {
+	case MGTMesh_MeshParameters::VeryCoarse:
+		return 2;
+	case MGTMesh_MeshParameters::Coarse:
+		return 1.5;
+	case MGTMesh_MeshParameters::Fine:
+		return 0.7;
+	case MGTMesh_MeshParameters::VeryFine:
+		return 0.5;
+	default:
+		return 1;
+	}
+}
+
+}
+
+//----------------------------------------------------------------------------
+GmshPlugin_Mesher::GmshPlugin_Mesher(MGTMesh_MeshObject* mesh,
+	const TopoDS_Shape& shape, const MGTMesh_Algorithm* algorithm)
+	: _mesh(mesh)
+	, _shape(shape)
+	, _algorithm(algorithm) {
+
+	SPDLOG_INFO("Initializing GmshPlugin_Mesher object");
+}
+
+//----------------------------------------------------------------------------
+GmshPlugin_Mesher::~GmshPlugin_Mesher() = default;
+
+//----------------------------------------------------------------------------
+void GmshPlugin_Mesher::SetMeshParameters() const {
+	using gmsh::option::setNumber;
+
+	setNumber("General.NumThreads", vtkSMPTools::GetEstimatedNumberOfThreads());
+	setNumber("Mesh.Algorithm",
+		_algorithm->quadAllowed ? FrontalDelaunayForQuads : FrontalDelaunay);
+	setNumber("Mesh.RecombineAll", _algorithm->quadAllowed ? 1 : 0);
+	setNumber("Mesh.Algorithm3D", Hxt);
+	setNumber("Mesh.ElementOrder", _algorithm->secondOrder ? 2 : 1);
+
+	if (_algorithm->maxSize > 0)
+		setNumber("Mesh.MeshSizeMax", _algorithm->maxSize);
+	setNumber("Mesh.MeshSizeMin", _algorithm->minSize);
+	setNumber("Mesh.MeshSizeFactor", getSizeFactor(_algorithm->fineness));
+
+	// Gmsh counts elements per full circle, Netgen segments per radius
+	setNumber("Mesh.MeshSizeFromCurvature",
+		_algorithm->surfaceCurvature ? 2 * std::numbers::pi * _algorithm->nbSegPerRadius : 0);
+
+	setNumber("Mesh.Optimize", _algorithm->optimize ? 1 : 0);
+	setNumber("Mesh.Smoothing", _algorithm->optimize ? _algorithm->nbSurfOptSteps : 0);
+
+	// Grading follows the size field, Gmsh has no growth rate of its own
+	if (_algorithm->sizeField && !_algorithm->sizeField->IsEmpty()) {
+		const std::shared_ptr<const MGTMesh_SizeField> sizeField = _algorithm->sizeField;
+		gmsh::model::mesh::setSizeCallback(
+			[sizeField](int, int, double x, double y, double z, double lc) {
+				const double point[3] = { x, y, z };
+				return std::min(lc, sizeField->Evaluate(point));
+			});
+	}
+}
+
+//----------------------------------------------------------------------------
+void GmshPlugin_Mesher::CheckEntities() const {
+	// Sub-shapes of the imported shape are bound in the order of exploration, so tags
+	// of entities of a fresh model are IDs of solids and faces as in Netgen meshes
+	TopTools_IndexedMapOfShape solids;
+	TopTools_IndexedMapOfShape faces;
+	TopExp::MapShapes(_shape, TopAbs_SOLID, solids);
+	TopExp::MapShapes(_shape, TopAbs_FACE, faces);
+
+	gmsh::vectorpair volumes;
+	gmsh::vectorpair surfaces;
+	gmsh::model::getEntities(volumes, 3);
+	gmsh::model::getEntities(surfaces, 2);
+	if (static_cast<int>(volumes.size()) != solids.Extent()
+		|| static_cast<int>(surfaces.size()) != faces.Extent())
+		SPDLOG_WARN("Gmsh model has {} volumes and {} surfaces for {} solids and {} faces, "
+					"element tags may not match the shape",
+			volumes.size(), surfaces.size(), solids.Extent(), faces.Extent());
+}
+
+//----------------------------------------------------------------------------
+int GmshPlugin_Mesher::ComputeMesh() {
+	const std::scoped_lock lock(gmshMutex);
+
+	int err = COMPERR_OK;
+	try {
+		if (!gmsh::isInitialized())
+			gmsh::initialize();
+		gmsh::option::setNumber("General.Terminal", 0);
+		gmsh::clear();
+		gmsh::model::add("MGTMesh");
+
+		gmsh::vectorpair dimTags;
+		gmsh::model::occ::importShapesNativePointer(&_shape, dimTags);
+		gmsh::model::occ::synchronize();
+		this->CheckEntities();
+		this->SetMeshParameters();
+
+		const int dimension = _algorithm->Is3DAlgortihm() ? 3 : 2;
+		SPDLOG_INFO("Starting Gmsh {} mesh generation process",
+			dimension == 3 ? "volume" : "surface");
+		gmsh::model::mesh::generate(dimension);
+
+		const GmshPlugin_Gmsh2VTK gmsh2vtk(_algorithm->renumber);
+		gmsh2vtk.ConvertToMeshData(_mesh);
+	} catch (Standard_Failure& ex) {
+		SPDLOG_ERROR("OpenCASCADE Exception: {}", ex.GetMessageString());
+		err = COMPERR_OCC_EXCEPTION;
+	} catch (std::exception& ex) {
+		SPDLOG_ERROR("Gmsh Exception: {}", ex.what());
+		err = COMPERR_STD_EXCEPTION;
+	}
+
+	// Model and callback must not outlive the shape and the algorithm
+	if (gmsh::isInitialized()) {
+		gmsh::model::mesh::removeSizeCallback();
+		gmsh::clear();
+	}
+	return err;
+}
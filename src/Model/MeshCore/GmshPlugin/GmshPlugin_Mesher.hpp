@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : GmshPlugin_Mesher.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef GMSHPLUGIN_MESHER_HPP
+#define GMSHPLUGIN_MESHER_HPP
+
+#include "GmshPlugin_Defs.hpp"
+
+class TopoDS_Shape;
+class MGTMesh_Algorithm;
+class MGTMesh_MeshObject;
+
+/**
+ * Meshing by Gmsh with parameters of the algorithm mapped to Gmsh options. The shape
+ * is passed to the OCC kernel of Gmsh directly without export, volumes are meshed by
+ * the multithreaded HXT algorithm with as many threads as the SMP backend uses. Gmsh
+ * keeps global state, so only one mesh is computed at a time.
+ */
+class GMSHPLUGIN_EXPORT GmshPlugin_Mesher {
+public:
+	GmshPlugin_Mesher(MGTMesh_MeshObject*, const TopoDS_Shape& shape,
+		const MGTMesh_Algorithm* algorithm);
+	~GmshPlugin_Mesher();
+
+	// Returns MGTMeshUtils_ComputeErrorName
+	int ComputeMesh();
+
+private:
+	void SetMeshParameters() const;
+
+	// Warns if entities of the model do not correspond to solids and faces of the shape
+	void CheckEntities() const;
+
+private:
+	MGTMesh_MeshObject* _mesh;
+	const TopoDS_Shape& _shape;
+	const MGTMesh_Algorithm* _algorithm;
+};
+
+#endif
@@ -0,0 +1,240 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_Assembly.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "MGTMesh_Assembly.hpp"
+#include "MGTMesh_MeshData.hpp"
+#include "MGTMesh_MeshObject.hpp"
+
+#include <BRepAlgoAPI_BuilderAlgo.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_ListOfShape.hxx>
+
+#include <vtkSMPTools.h>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace {
+
+using Dimension = MGTMesh_MeshData::Dimension;
+
+// Shapes of the fused compound the shape was split into, the shape itself if it was
+// not modified
+TopTools_ListOfShape GetImages(BRepAlgoAPI_BuilderAlgo& builder, const TopoDS_Shape& shape) {
+	if (builder.IsDeleted(shape))
+		return {};
+	if (const TopTools_ListOfShape& modified = builder.Modified(shape); !modified.IsEmpty())
+		return modified;
+
+	TopTools_ListOfShape images;
+	images.Append(shape);
+	return images;
+}
+
+// Copies elements selected by their tags and nodes they use
+template <typename IsSelected>
+void ExtractElements(
+	const MGTMesh_MeshData& source, IsSelected isSelected, MGTMesh_MeshData& target) {
+	constexpr std::array dimensions { Dimension::Volume, Dimension::Surface };
+	std::array<std::vector<char>, 2> isElementSelected;
+	std::vector<std::int32_t> newIds(source.GetNumberOfNodes(), -1);
+	for (std::size_t d = 0; d < dimensions.size(); ++d) {
+		const std::span<const std::int32_t> connectivity = source.GetConnectivity(dimensions[d]);
+		const std::span<const std::int32_t> tags = source.GetTags(dimensions[d]);
+		isElementSelected[d].assign(tags.size(), 0);
+		vtkIdType offset = 0;
+		for (const auto& block : source.GetBlocks(dimensions[d])) {
+			for (vtkIdType e = block.firstElement; e < block.firstElement + block.elementsNb;
+				 ++e, offset += block.nodesNb) {
+				if (!isSelected(dimensions[d], tags[e]))
+					continue;
+				isElementSelected[d][e] = 1;
+				for (int j = 0; j < block.nodesNb; ++j)
+					newIds[connectivity[offset + j]] = 0;
+			}
+		}
+	}
+
+	std::int32_t nodesNb = 0;
+	for (std::int32_t& newId : newIds) {
+		if (newId == 0)
+			newId = nodesNb++;
+	}
+	const std::span<const double> nodes = source.GetNodes();
+	const std::span<double> targetNodes = target.AllocateNodes(nodesNb);
+	for (std::size_t node = 0; node < newIds.size(); ++node) {
+		if (newIds[node] >= 0)
+			std::copy_n(nodes.begin() + 3 * node, 3,
+				targetNodes.begin() + 3 * static_cast<std::size_t>(newIds[node]));
+	}
+
+	for (std::size_t d = 0; d < dimensions.size(); ++d) {
+		const std::span<const std::int32_t> connectivity = source.GetConnectivity(dimensions[d]);
+		const std::span<const std::int32_t> tags = source.GetTags(dimensions[d]);
+		vtkIdType offset = 0;
+		for (const auto& block : source.GetBlocks(dimensions[d])) {
+			const auto first = isElementSelected[d].begin() + block.firstElement;
+			const vtkIdType selectedNb = std::count(first, first + block.elementsNb, 1);
+			const MGTMesh_MeshData::BlockData targetBlock
+				= target.AppendBlock(dimensions[d], block.cellType, selectedNb);
+			vtkIdType filled = 0;
+			for (vtkIdType e = block.firstElement; e < block.firstElement + block.elementsNb;
+				 ++e, offset += block.nodesNb) {
+				if (!isElementSelected[d][e])
+					continue;
+				for (int j = 0; j < block.nodesNb; ++j)
+					targetBlock.connectivity[filled * block.nodesNb + j]
+						= newIds[connectivity[offset + j]];
+				targetBlock.tags[filled++] = tags[e];
+			}
+		}
+	}
+}
+
+}
+
+//----------------------------------------------------------------------------
+MGTMesh_Assembly::MGTMesh_Assembly(const std::map<std::string, TopoDS_Shape>& parts) {
+	for (const auto& [name, shape] : parts) {
+		_names.push_back(name);
+		_parts.push_back(shape);
+	}
+}
+
+//----------------------------------------------------------------------------
+bool MGTMesh_Assembly::Fuse() {
+	TopTools_ListOfShape arguments;
+	for (const TopoDS_Shape& part : _parts)
+		arguments.Append(part);
+
+	BRepAlgoAPI_BuilderAlgo builder;
+	builder.SetArguments(arguments);
+	builder.SetRunParallel(Standard_True);
+	// Parts are imprinted on copies, shapes of parts stay unchanged
+	builder.SetNonDestructive(Standard_True);
+	builder.Build();
+	if (!builder.IsDone() || builder.HasErrors()) {
+		SPDLOG_ERROR("General fuse of {} parts failed", _parts.size());
+		return false;
+	}
+	if (builder.HasWarnings())
+		SPDLOG_WARN("General fuse of parts completed with warnings");
+	_shape = builder.Shape();
+
+	TopTools_IndexedMapOfShape solids;
+	TopTools_IndexedMapOfShape faces;
+	TopExp::MapShapes(_shape, TopAbs_SOLID, solids);
+	TopExp::MapShapes(_shape, TopAbs_FACE, faces);
+	_solidParts.assign(solids.Extent() + 1, -1);
+	_faceParts.assign(faces.Extent() + 1, {});
+
+	// Common volume of overlapping parts is a solid shared by their images
+	int commonSolidsNb = 0;
+	for (int i = 0; i < static_cast<int>(_parts.size()); ++i) {
+		for (TopExp_Explorer explorer(_parts[i], TopAbs_SOLID); explorer.More(); explorer.Next()) {
+			for (const TopoDS_Shape& image : GetImages(builder, explorer.Current())) {
+				const int solidId = solids.FindIndex(image);
+				if (solidId == 0)
+					continue;
+				if (_solidParts[solidId] >= 0 && _solidParts[solidId] != i)
+					++commonSolidsNb;
+				else
+					_solidParts[solidId] = i;
+			}
+		}
+		for (TopExp_Explorer explorer(_parts[i], TopAbs_FACE); explorer.More(); explorer.Next()) {
+			for (const TopoDS_Shape& image : GetImages(builder, explorer.Current())) {
+				const int faceId = faces.FindIndex(image);
+				if (faceId != 0 && !std::ranges::contains(_faceParts[faceId], i))
+					_faceParts[faceId].push_back(i);
+			}
+		}
+	}
+	if (commonSolidsNb > 0)
+		SPDLOG_WARN("{} solids are common to overlapping parts, they are kept in the first "
+					"of them",
+			commonSolidsNb);
+
+	SPDLOG_INFO("Fused {} parts into {} solids and {} faces", _parts.size(), solids.Extent(),
+		faces.Extent());
+	return true;
+}
+
+//----------------------------------------------------------------------------
+bool MGTMesh_Assembly::Update(const std::map<std::string, TopoDS_Shape>& parts) {
+	bool isChanged = _shape.IsNull() || parts.size() != _parts.size();
+	auto part = parts.begin();
+	for (std::size_t i = 0; i < _parts.size() && !isChanged; ++i, ++part)
+		isChanged = part->first != _names[i] || !part->second.IsEqual(_parts[i]);
+	if (!isChanged)
+		return true;
+
+	*this = MGTMesh_Assembly(parts);
+	return this->Fuse();
+}
+
+//----------------------------------------------------------------------------
+std::vector<vtkSmartPointer<MGTMesh_MeshObject>> MGTMesh_Assembly::SplitMesh(
+	const MGTMesh_MeshObject* mesh) const {
+	const vtkSmartPointer<MGTMesh_MeshData> meshData = mesh ? mesh->GetMeshData() : nullptr;
+	if (!meshData) {
+		SPDLOG_ERROR("Mesh of assembly has no native mesh data");
+		return {};
+	}
+
+	std::vector<vtkSmartPointer<MGTMesh_MeshData>> partsData(_parts.size());
+	for (vtkSmartPointer<MGTMesh_MeshData>& partData : partsData)
+		partData = vtkSmartPointer<MGTMesh_MeshData>::New();
+
+	// Parts are extracted in parallel, each into own mesh data
+	vtkSMPTools::For(0, static_cast<vtkIdType>(_parts.size()), 1,
+		[&](const vtkIdType begin, const vtkIdType end) {
+			for (vtkIdType i = begin; i < end; ++i) {
+				const auto part = static_cast<int>(i);
+				const auto isSelected = [this, part](const Dimension dimension, const int tag) {
+					if (dimension == Dimension::Volume)
+						return tag > 0 && tag < static_cast<int>(_solidParts.size())
+							&& _solidParts[tag] == part;
+					return tag > 0 && tag < static_cast<int>(_faceParts.size())
+						&& std::ranges::contains(_faceParts[tag], part);
+				};
+				ExtractElements(*meshData, isSelected, *partsData[i]);
+			}
+		});
+
+	std::vector<vtkSmartPointer<MGTMesh_MeshObject>> meshObjects;
+	for (std::size_t i = 0; i < _parts.size(); ++i) {
+		meshObjects.push_back(vtkSmartPointer<MGTMesh_MeshObject>::New());
+		meshObjects.back()->SetMeshData(partsData[i]);
+		spdlog::debug("Mesh of part {} has {} nodes", _names[i],
+			partsData[i]->GetNumberOfNodes());
+	}
+	return meshObjects;
+}
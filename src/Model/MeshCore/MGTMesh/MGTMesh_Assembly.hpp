@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_Assembly.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef MGTMESH_ASSEMBLY_HPP
+#define MGTMESH_ASSEMBLY_HPP
+
+#include <TopoDS_Shape.hxx>
+
+#include <vtkSmartPointer.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+class MGTMesh_MeshObject;
+
+/**
+ * Parts of an assembly fused by OCCT general fuse into a single compound, in which
+ * contact faces of parts are shared. Meshing the compound gives conforming interfaces
+ * meshed once. Solids and faces of the compound are mapped back to parts they are
+ * images of, so that its mesh is split into meshes of the original parts. Elements
+ * keep tags of solids and faces of the compound.
+ */
+class MGTMesh_Assembly {
+public:
+	explicit MGTMesh_Assembly(const std::map<std::string, TopoDS_Shape>& parts);
+
+	// Returns false if general fuse failed
+	bool Fuse();
+
+	// Fuses parts again only if some of them changed, returns false if fuse failed
+	bool Update(const std::map<std::string, TopoDS_Shape>& parts);
+
+	[[nodiscard]] const TopoDS_Shape& GetShape() const { return _shape; }
+	[[nodiscard]] const std::vector<std::string>& GetPartNames() const { return _names; }
+
+	// One mesh object per part with elements generated on its solids and faces, shared
+	// faces are included in meshes of both parts
+	[[nodiscard]] std::vector<vtkSmartPointer<MGTMesh_MeshObject>> SplitMesh(
+		const MGTMesh_MeshObject* mesh) const;
+
+private:
+	std::vector<std::string> _names;
+	std::vector<TopoDS_Shape> _parts;
+	TopoDS_Shape _shape;
+
+	// Part index of solids and parts of faces of the compound by their 1-based IDs
+	std::vector<int> _solidParts;
+	std::vector<std::vector<int>> _faceParts;
+};
+
+#endif
@@ -0,0 +1,320 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_AutoSizing.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "MGTMesh_AutoSizing.hpp"
+#include "MGTMesh_SizeField.hpp"
+#include "MGTMeshUtils_DefaultParameters.hpp"
+
+#include <BRepAdaptor_Surface.hxx>
+#include <BRepLProp_SLProps.hxx>
+#include <BRep_Tool.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Precision.hxx>
+#include <Standard_Failure.hxx>
+#include <TopExp.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+#include <gp_Trsf.hxx>
+
+#include <vtkSMPTools.h>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+constexpr int LeafSize = 4;
+
+// Walls are opposite if angle between their normals is below 45 degrees, so faces
+// meeting at concave edges are not taken for gaps
+constexpr double FacingCosine = 0.7;
+
+// Hits closer than this fraction of shape size are taken for the node's own faces
+constexpr double RelativeTolerance = 1e-6;
+
+constexpr double Infinity = std::numeric_limits<double>::infinity();
+
+using Vector = std::array<double, 3>;
+
+//----------------------------------------------------------------------------
+Vector subtract(const Vector& a, const Vector& b) {
+	return { a[0] - b[0], a[1] - b[1], a[2] - b[2] };
+}
+
+//----------------------------------------------------------------------------
+Vector cross(const Vector& a, const Vector& b) {
+	return { a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0] };
+}
+
+//----------------------------------------------------------------------------
+double dot(const Vector& a, const Vector& b) {
+	return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+//----------------------------------------------------------------------------
+Vector normalized(const Vector& a) {
+	const double length = std::sqrt(dot(a, a));
+	return length > 0.0 ? Vector { a[0] / length, a[1] / length, a[2] / length } : Vector {};
+}
+
+}
+
+//----------------------------------------------------------------------------
+MGTMesh_AutoSizing::MGTMesh_AutoSizing(const TopoDS_Shape& shape)
+	: _shape(shape) { }
+
+//----------------------------------------------------------------------------
+void MGTMesh_AutoSizing::Compute() {
+	_samples.clear();
+	_triangles.clear();
+	_nodes.clear();
+
+	TopTools_IndexedMapOfShape faces;
+	TopExp::MapShapes(_shape, TopAbs_FACE, faces);
+
+	// Triangulation left on the shape by others is replaced, so that radii and gaps do not
+	// depend on its deflection. It is the same one Netgen geometry is prepared with.
+	MGTMeshUtils_DefaultParameters::TriangulateShape(_shape);
+
+	// Faces are collected in parallel, each into own buffers to keep their order
+	std::vector<std::vector<Sample>> facesSamples(faces.Extent());
+	std::vector<std::vector<Triangle>> facesTriangles(faces.Extent());
+	vtkSMPTools::For(0, faces.Extent(), [&](vtkIdType begin, vtkIdType end) {
+		for (vtkIdType i = begin; i < end; ++i)
+			this->CollectFace(faces(static_cast<int>(i) + 1), facesSamples[i], facesTriangles[i]);
+	});
+	for (int i = 0; i < faces.Extent(); ++i) {
+		_samples.insert(_samples.end(), facesSamples[i].begin(), facesSamples[i].end());
+		_triangles.insert(_triangles.end(), facesTriangles[i].begin(), facesTriangles[i].end());
+	}
+	if (_triangles.empty())
+		return;
+
+	this->BuildNode(0, static_cast<int>(_triangles.size()));
+	const std::array<double, 6>& bounds = _nodes.front().bounds;
+	const double diagonal = std::hypot(
+		bounds[1] - bounds[0], bounds[3] - bounds[2], bounds[5] - bounds[4]);
+	const double tolerance = RelativeTolerance * diagonal;
+
+	vtkSMPTools::For(0, static_cast<vtkIdType>(_samples.size()), [&](vtkIdType begin, vtkIdType end) {
+		for (vtkIdType i = begin; i < end; ++i)
+			_samples[i].gap = this->FindGap(_samples[i], tolerance);
+	});
+	spdlog::debug("Automatic sizing computed at {} nodes of {} triangles", _samples.size(),
+		_triangles.size());
+}
+
+//----------------------------------------------------------------------------
+void MGTMesh_AutoSizing::CollectFace(const TopoDS_Shape& shape, std::vector<Sample>& samples,
+	std::vector<Triangle>& triangles) const {
+	const TopoDS_Face& face = TopoDS::Face(shape);
+	TopLoc_Location location;
+	const Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(face, location);
+	if (triangulation.IsNull())
+		return;
+
+	const gp_Trsf transformation = location.Transformation();
+	samples.resize(triangulation->NbNodes(), Sample { {}, {}, Infinity, Infinity });
+	for (int i = 0; i < triangulation->NbNodes(); ++i) {
+		const gp_Pnt point = triangulation->Node(i + 1).Transformed(transformation);
+		samples[i].point = { point.X(), point.Y(), point.Z() };
+	}
+
+	// Node normals are averaged from normals of triangles weighted by their areas,
+	// orientation does not matter as gaps are searched in both directions
+	for (int i = 1; i <= triangulation->NbTriangles(); ++i) {
+		int n1, n2, n3;
+		triangulation->Triangle(i).Get(n1, n2, n3);
+		Triangle triangle { { samples[n1 - 1].point, samples[n2 - 1].point,
+								samples[n3 - 1].point },
+			{} };
+		const Vector normal = cross(subtract(triangle.points[1], triangle.points[0]),
+			subtract(triangle.points[2], triangle.points[0]));
+		if (dot(normal, normal) <= 0.0)
+			continue;
+
+		for (const int n : { n1, n2, n3 }) {
+			for (int k = 0; k < 3; ++k)
+				samples[n - 1].normal[k] += normal[k];
+		}
+		triangle.normal = normalized(normal);
+		triangles.push_back(triangle);
+	}
+	for (Sample& sample : samples)
+		sample.normal = normalized(sample.normal);
+
+	// Planes are bounded by zero curvature, radii are computed for other faces only
+	try {
+		const BRepAdaptor_Surface surface(face);
+		if (surface.GetType() == GeomAbs_Plane || !triangulation->HasUVNodes())
+			return;
+
+		BRepLProp_SLProps properties(surface, 2, Precision::Confusion());
+		for (int i = 0; i < triangulation->NbNodes(); ++i) {
+			const gp_Pnt2d uv = triangulation->UVNode(i + 1);
+			properties.SetParameters(uv.X(), uv.Y());
+			if (!properties.IsCurvatureDefined())
+				continue;
+
+			const double curvature = std::max(
+				std::abs(properties.MaxCurvature()), std::abs(properties.MinCurvature()));
+			if (curvature > 0.0)
+				samples[i].radius = 1.0 / curvature;
+		}
+	} catch (const Standard_Failure& ex) {
+		SPDLOG_WARN("Curvature of face could not be computed: {}", ex.GetMessageString());
+	}
+}
+
+//----------------------------------------------------------------------------
+int MGTMesh_AutoSizing::BuildNode(const int first, const int count) {
+	Node node { { Infinity, -Infinity, Infinity, -Infinity, Infinity, -Infinity }, first, count,
+		-1, -1 };
+	for (int i = first; i < first + count; ++i) {
+		for (const Vector& point : _triangles[i].points) {
+			for (int k = 0; k < 3; ++k) {
+				node.bounds[2 * k] = std::min(node.bounds[2 * k], point[k]);
+				node.bounds[2 * k + 1] = std::max(node.bounds[2 * k + 1], point[k]);
+			}
+		}
+	}
+
+	const int index = static_cast<int>(_nodes.size());
+	_nodes.push_back(node);
+	if (count <= LeafSize)
+		return index;
+
+	// Split at the median of centroids along the longest side of bounds
+	int axis = 0;
+	for (int k = 1; k < 3; ++k) {
+		if (node.bounds[2 * k + 1] - node.bounds[2 * k]
+			> node.bounds[2 * axis + 1] - node.bounds[2 * axis])
+			axis = k;
+	}
+	const auto begin = _triangles.begin() + first;
+	std::nth_element(begin, begin + count / 2, begin + count,
+		[axis](const Triangle& a, const Triangle& b) {
+			return a.points[0][axis] + a.points[1][axis] + a.points[2][axis]
+				< b.points[0][axis] + b.points[1][axis] + b.points[2][axis];
+		});
+
+	const int left = this->BuildNode(first, count / 2);
+	const int right = this->BuildNode(first + count / 2, count - count / 2);
+	_nodes[index].left = left;
+	_nodes[index].right = right;
+	return index;
+}
+
+//----------------------------------------------------------------------------
+double MGTMesh_AutoSizing::FindGap(const Sample& sample, const double tolerance) const {
+	double gap = Infinity;
+	const Vector& origin = sample.point;
+	const Vector& direction = sample.normal;
+	if (dot(direction, direction) == 0.0)
+		return gap;
+
+	std::array<int, 64> stack {};
+	int stackSize = 0;
+	stack[stackSize++] = 0;
+	while (stackSize > 0) {
+		const Node& node = _nodes[stack[--stackSize]];
+
+		// Line parameters inside bounds must overlap parameters closer than the gap
+		double tMin = -gap;
+		double tMax = gap;
+		for (int k = 0; k < 3 && tMin <= tMax; ++k) {
+			const double low = node.bounds[2 * k];
+			const double high = node.bounds[2 * k + 1];
+			if (direction[k] == 0.0) {
+				if (origin[k] < low || origin[k] > high)
+					tMax = -Infinity;
+				continue;
+			}
+			const double t1 = (low - origin[k]) / direction[k];
+			const double t2 = (high - origin[k]) / direction[k];
+			tMin = std::max(tMin, std::min(t1, t2));
+			tMax = std::min(tMax, std::max(t1, t2));
+		}
+		if (tMin > tMax)
+			continue;
+
+		if (node.left >= 0) {
+			stack[stackSize++] = node.left;
+			stack[stackSize++] = node.right;
+			continue;
+		}
+
+		// Moller-Trumbore intersection of the line with triangles
+		for (int i = node.first; i < node.first + node.count; ++i) {
+			const Triangle& triangle = _triangles[i];
+			if (std::abs(dot(triangle.normal, direction)) < FacingCosine)
+				continue;
+
+			const Vector edge1 = subtract(triangle.points[1], triangle.points[0]);
+			const Vector edge2 = subtract(triangle.points[2], triangle.points[0]);
+			const Vector p = cross(direction, edge2);
+			const double determinant = dot(edge1, p);
+			if (determinant == 0.0)
+				continue;
+
+			const Vector s = subtract(origin, triangle.points[0]);
+			const double u = dot(s, p) / determinant;
+			if (u < 0.0 || u > 1.0)
+				continue;
+			const Vector q = cross(s, edge1);
+			const double v = dot(direction, q) / determinant;
+			if (v < 0.0 || u + v > 1.0)
+				continue;
+
+			const double distance = std::abs(dot(edge2, q) / determinant);
+			if (distance > tolerance && distance < gap)
+				gap = distance;
+		}
+	}
+	return gap;
+}
+
+//----------------------------------------------------------------------------
+void MGTMesh_AutoSizing::AddSizings(MGTMesh_SizeField& sizeField, const double nbSegPerRadius,
+	const double nbSegPerGap, const double minSize) const {
+	std::size_t addedNb = 0;
+	for (const Sample& sample : _samples) {
+		double size = Infinity;
+		if (nbSegPerRadius > 0.0)
+			size = std::min(size, sample.radius / nbSegPerRadius);
+		if (nbSegPerGap > 0.0)
+			size = std::min(size, sample.gap / nbSegPerGap);
+		if (!std::isfinite(size))
+			continue;
+
+		sizeField.AddSource(sample.point.data(), std::max(size, minSize));
+		++addedNb;
+	}
+	spdlog::debug("Automatic sizing added {} sources", addedNb);
+}
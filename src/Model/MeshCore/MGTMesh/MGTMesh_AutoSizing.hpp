@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_AutoSizing.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef MGTMESH_AUTOSIZING_HPP
+#define MGTMESH_AUTOSIZING_HPP
+
+#include <TopoDS_Shape.hxx>
+
+#include <array>
+#include <vector>
+
+class MGTMesh_SizeField;
+
+/**
+ * Automatic sizing of a shape by surface curvature and proximity of its faces. Radii
+ * of curvature and distances across walls and gaps are computed once at nodes of the
+ * shape tessellation, distances by casting rays along node normals against a BVH of
+ * all triangles. Sizes for given numbers of elements per radius and per gap are then
+ * added to size fields without repeating the geometric computation.
+ */
+class MGTMesh_AutoSizing {
+public:
+	explicit MGTMesh_AutoSizing(const TopoDS_Shape& shape);
+
+	void Compute();
+
+	[[nodiscard]] const TopoDS_Shape& GetShape() const { return _shape; }
+
+	// Adds sizes of radius / nbSegPerRadius and gap / nbSegPerGap, a zero number
+	// disables the corresponding sizing. Sizes are not smaller than minimal size.
+	void AddSizings(MGTMesh_SizeField& sizeField, double nbSegPerRadius, double nbSegPerGap,
+		double minSize) const;
+
+private:
+	struct Sample {
+		std::array<double, 3> point;
+		std::array<double, 3> normal;
+		double radius;
+		double gap;
+	};
+
+	struct Triangle {
+		std::array<std::array<double, 3>, 3> points;
+		std::array<double, 3> normal;
+	};
+
+	struct Node {
+		std::array<double, 6> bounds;
+		int first;
+		int count;
+		int left;
+		int right;
+	};
+
+	void CollectFace(const TopoDS_Shape& face, std::vector<Sample>& samples,
+		std::vector<Triangle>& triangles) const;
+
+	int BuildNode(int first, int count);
+
+	// Distance to the nearest facing triangle along the line, infinite if there is none
+	[[nodiscard]] double FindGap(const Sample& sample, double tolerance) const;
+
+private:
+	TopoDS_Shape _shape;
+	std::vector<Sample> _samples;
+	std::vector<Triangle> _triangles;
+	std::vector<Node> _nodes;
+};
+
+#endif
@@ -25,17 +25,29 @@
 
 #include "MGTMesh_Generator.hpp"
 #include "MGTMeshUtils_ComputeError.hpp"
+#include "MGTMesh_Sweeper.hpp"
+#include "NetgenPlugin_LocalHSnapshot.hpp"
 #include "NetgenPlugin_Mesher.hpp"
 #include "NetgenPlugin_Parameters.hpp"
+#include "NetgenPlugin_PreparedGeometry.hpp"
+
+#ifdef ENABLE_GMSH
+#include "GmshPlugin_Mesher.hpp"
+#endif
+
+#include <spdlog/spdlog.h>
 
 #include <memory>
+#include <optional>
 
 //----------------------------------------------------------------------------
 MGTMesh_Generator::MGTMesh_Generator(const TopoDS_Shape& shape,
 	const MGTMesh_Algorithm& algorithm, MGTMesh_MeshObject* meshObject)
 	: _meshObject(meshObject)
 	, _shape(&shape)
-	, _algorithm(&algorithm) { }
+	, _algorithm(&algorithm)
+	, _preparedGeometry(nullptr)
+	, _localHSnapshots(nullptr) { }
 
 //----------------------------------------------------------------------------
 MGTMesh_Generator::~MGTMesh_Generator() = default;
@@ -45,14 +57,89 @@ MGTMesh_MeshObject* MGTMesh_Generator::GetOutputMesh() const {
 	return _meshObject;
 }
 
+//----------------------------------------------------------------------------
+void MGTMesh_Generator::SetPreparedGeometry(NetgenPlugin_PreparedGeometry* geometry) {
+	_preparedGeometry = geometry;
+}
+
+//----------------------------------------------------------------------------
+void MGTMesh_Generator::SetLocalHSnapshots(std::vector<NetgenPlugin_LocalHSnapshot>* snapshots) {
+	_localHSnapshots = snapshots;
+}
+
 //----------------------------------------------------------------------------
 int MGTMesh_Generator::Compute() const {
+	if (_algorithm->sweep && _algorithm->Is3DAlgortihm()) {
+		MGTMesh_Sweeper sweeper(*_shape, *_algorithm);
+		if (sweeper.FindSweeps())
+			return sweeper.Compute(_meshObject);
+		SPDLOG_INFO("Shape is not sweepable, meshing it with Netgen");
+	}
+
 	if (_algorithm->GetEngineLib() == MGTMesh_Scheme::Engine::NETGEN) {
 		const auto netgenAlg
 			= std::make_unique<NetgenPlugin_Parameters>(*_algorithm);
 
 		NetgenPlugin_Mesher netgenMesher(_meshObject, *_shape, netgenAlg.get());
+		netgenMesher.SetPreparedGeometry(_preparedGeometry);
+		netgenMesher.SetLocalHSnapshots(_localHSnapshots);
 		return netgenMesher.ComputeMesh();
 	}
+#ifdef ENABLE_GMSH
+	if (_algorithm->GetEngineLib() == MGTMesh_Scheme::Engine::GMSH) {
+		GmshPlugin_Mesher gmshMesher(_meshObject, *_shape, _algorithm);
+		return gmshMesher.ComputeMesh();
+	}
+#endif
+	SPDLOG_ERROR("Meshing engine {} is not available", _algorithm->GetEngineLib());
 	return COMPERR_BAD_PARMETERS;
 }
+
+//----------------------------------------------------------------------------
+std::vector<int> MGTMesh_Generator::ComputeFamily(const TopoDS_Shape& shape,
+	const std::vector<const MGTMesh_Algorithm*>& algorithms,
+	const std::vector<MGTMesh_MeshObject*>& meshObjects,
+	NetgenPlugin_PreparedGeometry* preparedGeometry,
+	std::vector<NetgenPlugin_LocalHSnapshot>* localHSnapshots) {
+	std::vector<int> results(algorithms.size(), COMPERR_BAD_PARMETERS);
+	if (algorithms.size() != meshObjects.size())
+		return results;
+
+	std::vector<NetgenPlugin_LocalHSnapshot> familySnapshots;
+	if (!localHSnapshots)
+		localHSnapshots = &familySnapshots;
+
+	// Netgen keeps meshing parameters and state in globals, meshes are computed one after
+	// another
+	std::optional<NetgenPlugin_PreparedGeometry> familyGeometry;
+	for (std::size_t i = 0; i < algorithms.size(); ++i) {
+		if (algorithms[i]->sweep && algorithms[i]->Is3DAlgortihm()) {
+			MGTMesh_Sweeper sweeper(shape, *algorithms[i]);
+			if (sweeper.FindSweeps()) {
+				results[i] = sweeper.Compute(meshObjects[i]);
+				continue;
+			}
+		}
+#ifdef ENABLE_GMSH
+		if (algorithms[i]->GetEngineLib() == MGTMesh_Scheme::Engine::GMSH) {
+			GmshPlugin_Mesher gmshMesher(meshObjects[i], shape, algorithms[i]);
+			results[i] = gmshMesher.ComputeMesh();
+			continue;
+		}
+#endif
+		if (algorithms[i]->GetEngineLib() != MGTMesh_Scheme::Engine::NETGEN)
+			continue;
+
+		if (!preparedGeometry) {
+			SPDLOG_INFO("Preparing geometry shared by {} meshes...", algorithms.size());
+			preparedGeometry = &familyGeometry.emplace(shape);
+		}
+		const auto netgenAlg = std::make_unique<NetgenPlugin_Parameters>(*algorithms[i]);
+		NetgenPlugin_Mesher netgenMesher(meshObjects[i], shape, netgenAlg.get());
+		netgenMesher.SetPreparedGeometry(preparedGeometry);
+		netgenMesher.SetLocalHSnapshots(localHSnapshots);
+		results[i] = netgenMesher.ComputeMesh();
+		spdlog::debug("Mesh {} of family computed with status {}", i, results[i]);
+	}
+	return results;
+}
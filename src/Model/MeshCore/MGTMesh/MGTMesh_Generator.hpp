@@ -29,19 +29,44 @@
 
 #include <TopoDS_Shape.hxx>
 
+#include <vector>
+
+class NetgenPlugin_LocalHSnapshot;
+class NetgenPlugin_PreparedGeometry;
+
 class MGTMesh_Generator {
 public:
 	MGTMesh_Generator(
 		const TopoDS_Shape&, const MGTMesh_Algorithm&, MGTMesh_MeshObject* meshObject);
 	~MGTMesh_Generator();
 
+	// Netgen geometry of the shape kept between runs, prepared by Compute if not set
+	void SetPreparedGeometry(NetgenPlugin_PreparedGeometry* geometry);
+	// Local size functions kept from previous meshes of the shape, reused and extended
+	// by Netgen meshes
+	void SetLocalHSnapshots(std::vector<NetgenPlugin_LocalHSnapshot>* snapshots);
+
+	// Extruded and revolved solids are swept if the algorithm asks for it, shapes that
+	// are not sweepable are meshed by the engine of the algorithm
 	[[nodiscard]] int Compute() const;
 	[[nodiscard]] MGTMesh_MeshObject* GetOutputMesh() const;
 
+	// Meshes the shape with each algorithm into the mesh object of the same index.
+	// Shape is prepared for meshing engine once and shared by all meshes. Returns
+	// MGTMeshUtils_ComputeErrorName of each mesh. Meshes share local size functions
+	// too. Given geometry and snapshots kept between runs are used if any.
+	[[nodiscard]] static std::vector<int> ComputeFamily(const TopoDS_Shape& shape,
+		const std::vector<const MGTMesh_Algorithm*>& algorithms,
+		const std::vector<MGTMesh_MeshObject*>& meshObjects,
+		NetgenPlugin_PreparedGeometry* preparedGeometry = nullptr,
+		std::vector<NetgenPlugin_LocalHSnapshot>* localHSnapshots = nullptr);
+
 private:
 	MGTMesh_MeshObject* _meshObject;
 	const TopoDS_Shape* _shape;
 	const MGTMesh_Algorithm* _algorithm;
+	NetgenPlugin_PreparedGeometry* _preparedGeometry;
+	std::vector<NetgenPlugin_LocalHSnapshot>* _localHSnapshots;
 };
 
 #endif
\ No newline at end of file
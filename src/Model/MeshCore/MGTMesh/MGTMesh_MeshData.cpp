@@ -0,0 +1,327 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_MeshData.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#include "MGTMesh_MeshData.hpp"
+
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
+#include <vtkCellType.h>
+#include <vtkDoubleArray.h>
+#include <vtkInformation.h>
+#include <vtkInformationObjectBaseKey.h>
+#include <vtkObjectFactory.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkSMPTools.h>
+#include <vtkTypeInt32Array.h>
+#include <vtkTypeInt64Array.h>
+#include <vtkUnsignedCharArray.h>
+#include <vtkUnstructuredGrid.h>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <limits>
+
+vtkStandardNewMacro(MGTMesh_MeshData);
+vtkInformationKeyMacro(MGTMesh_MeshData, MESH_DATA, ObjectBase);
+
+//----------------------------------------------------------------------------
+MGTMesh_MeshData::MGTMesh_MeshData() = default;
+
+//----------------------------------------------------------------------------
+MGTMesh_MeshData::~MGTMesh_MeshData() = default;
+
+//----------------------------------------------------------------------------
+int MGTMesh_MeshData::GetNodesNb(const int cellType) {
+	switch (cellType) {
+	case VTK_TRIANGLE:
+		return 3;
+	case VTK_QUAD:
+	case VTK_TETRA:
+		return 4;
+	case VTK_PYRAMID:
+		return 5;
+	case VTK_WEDGE:
+		return 6;
+	case VTK_HEXAHEDRON:
+		return 8;
+	default:
+		return 0;
+	}
+}
+
+//----------------------------------------------------------------------------
+std::span<double> MGTMesh_MeshData::AllocateNodes(const vtkIdType nodesNb) {
+	if (nodesNb > std::numeric_limits<std::int32_t>::max()) {
+		SPDLOG_ERROR("Number of nodes exceeds range of 32-bit node IDs: {}", nodesNb);
+		_nodes.clear();
+		return {};
+	}
+
+	_nodes.resize(3 * nodesNb);
+	this->Modified();
+	return _nodes;
+}
+
+//----------------------------------------------------------------------------
+MGTMesh_MeshData::BlockData MGTMesh_MeshData::AppendBlock(
+	const Dimension dimension, const int cellType, const vtkIdType elementsNb) {
+	const int nodesNb = GetNodesNb(cellType);
+	if (nodesNb == 0 || elementsNb <= 0) {
+		if (nodesNb == 0)
+			SPDLOG_ERROR("Cell type {} is not supported by mesh data", cellType);
+		return {};
+	}
+
+	Elements& elements = this->GetElements(dimension);
+	const auto firstElement = static_cast<vtkIdType>(elements.tags.size());
+	const auto firstNode = static_cast<vtkIdType>(elements.connectivity.size());
+
+	if (!elements.blocks.empty() && elements.blocks.back().cellType == cellType)
+		elements.blocks.back().elementsNb += elementsNb;
+	else
+		elements.blocks.push_back({ cellType, nodesNb, firstElement, elementsNb });
+
+	elements.connectivity.resize(firstNode + elementsNb * nodesNb);
+	elements.tags.resize(firstElement + elementsNb);
+	this->Modified();
+
+	return { std::span(elements.connectivity).subspan(firstNode),
+		std::span(elements.tags).subspan(firstElement) };
+}
+
+//----------------------------------------------------------------------------
+void MGTMesh_MeshData::Clear() {
+	_nodes = {};
+	_elements = {};
+	this->Modified();
+}
+
+//----------------------------------------------------------------------------
+void MGTMesh_MeshData::RenumberNodes(const std::span<const std::int32_t> newIds) {
+	const vtkIdType nodesNb = this->GetNumberOfNodes();
+	if (static_cast<vtkIdType>(newIds.size()) != nodesNb) {
+		SPDLOG_ERROR("Node renumbering does not match number of nodes");
+		return;
+	}
+
+	std::vector<double> nodes(_nodes.size());
+	vtkSMPTools::For(0, nodesNb, [&](vtkIdType begin, vtkIdType end) {
+		for (vtkIdType i = begin; i < end; ++i)
+			std::copy_n(&_nodes[3 * i], 3, &nodes[3 * newIds[i]]);
+	});
+	_nodes = std::move(nodes);
+
+	for (Elements& elements : _elements) {
+		std::vector<std::int32_t>& connectivity = elements.connectivity;
+		vtkSMPTools::For(0, static_cast<vtkIdType>(connectivity.size()),
+			[&](vtkIdType begin, vtkIdType end) {
+				for (vtkIdType i = begin; i < end; ++i)
+					connectivity[i] = newIds[connectivity[i]];
+			});
+	}
+	this->Modified();
+}
+
+//----------------------------------------------------------------------------
+void MGTMesh_MeshData::ReorderElements(
+	const Dimension dimension, const std::span<const vtkIdType> order) {
+	Elements& elements = this->GetElements(dimension);
+	if (order.size() != elements.tags.size()) {
+		SPDLOG_ERROR("Element order does not match number of elements");
+		return;
+	}
+
+	std::vector<std::int32_t> connectivity(elements.connectivity.size());
+	std::vector<std::int32_t> tags(elements.tags.size());
+
+	vtkIdType blockOffset = 0;
+	for (const ElementBlock& block : elements.blocks) {
+		const vtkIdType firstElement = block.firstElement;
+		const int nodesNb = block.nodesNb;
+
+		vtkSMPTools::For(0, block.elementsNb, [&](vtkIdType begin, vtkIdType end) {
+			for (vtkIdType i = begin; i < end; ++i) {
+				const vtkIdType source = order[firstElement + i] - firstElement;
+				std::copy_n(&elements.connectivity[blockOffset + source * nodesNb], nodesNb,
+					&connectivity[blockOffset + i * nodesNb]);
+				tags[firstElement + i] = elements.tags[firstElement + source];
+			}
+		});
+		blockOffset += block.elementsNb * nodesNb;
+	}
+
+	elements.connectivity = std::move(connectivity);
+	elements.tags = std::move(tags);
+	this->Modified();
+}
+
+//----------------------------------------------------------------------------
+vtkIdType MGTMesh_MeshData::GetNumberOfNodes() const {
+	return static_cast<vtkIdType>(_nodes.size() / 3);
+}
+
+//----------------------------------------------------------------------------
+vtkIdType MGTMesh_MeshData::GetNumberOfElements(const Dimension dimension) const {
+	return static_cast<vtkIdType>(this->GetElements(dimension).tags.size());
+}
+
+//----------------------------------------------------------------------------
+const std::vector<MGTMesh_MeshData::ElementBlock>& MGTMesh_MeshData::GetBlocks(
+	const Dimension dimension) const {
+	return this->GetElements(dimension).blocks;
+}
+
+//----------------------------------------------------------------------------
+std::span<const std::int32_t> MGTMesh_MeshData::GetConnectivity(
+	const Dimension dimension) const {
+	return this->GetElements(dimension).connectivity;
+}
+
+//----------------------------------------------------------------------------
+std::span<const std::int32_t> MGTMesh_MeshData::GetTags(const Dimension dimension) const {
+	return this->GetElements(dimension).tags;
+}
+
+//----------------------------------------------------------------------------
+std::size_t MGTMesh_MeshData::GetMemorySize() const {
+	std::size_t size = _nodes.capacity() * sizeof(double);
+	for (const Elements& elements : _elements) {
+		size += (elements.connectivity.capacity() + elements.tags.capacity())
+			* sizeof(std::int32_t);
+		size += elements.blocks.capacity() * sizeof(ElementBlock);
+	}
+	return size;
+}
+
+//----------------------------------------------------------------------------
+const MGTMesh_MeshData::Elements& MGTMesh_MeshData::GetElements(
+	const Dimension dimension) const {
+	return _elements[static_cast<std::size_t>(dimension)];
+}
+
+//----------------------------------------------------------------------------
+MGTMesh_MeshData::Elements& MGTMesh_MeshData::GetElements(const Dimension dimension) {
+	return _elements[static_cast<std::size_t>(dimension)];
+}
+
+//----------------------------------------------------------------------------
+template <typename ArrayT, typename ValueT>
+vtkSmartPointer<ArrayT> MGTMesh_MeshData::CreateArrayView(
+	ValueT* data, const vtkIdType valuesNb, const int componentsNb) {
+	const auto array = vtkSmartPointer<ArrayT>::New();
+	array->SetNumberOfComponents(componentsNb);
+	array->SetArray(data, valuesNb, 1);
+	array->GetInformation()->Set(MESH_DATA(), this);
+	return array;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkCellArray> MGTMesh_MeshData::CreateCellsView(Elements& elements) {
+	const auto elementsNb = static_cast<vtkIdType>(elements.tags.size());
+	const auto connectivityNb = static_cast<vtkIdType>(elements.connectivity.size());
+	const auto cells = vtkSmartPointer<vtkCellArray>::New();
+
+	// Offsets are generated, they are implied by the blocks
+	const auto fillOffsets = [&elements](auto* offsets) {
+		vtkIdType offset = 0;
+		for (const ElementBlock& block : elements.blocks) {
+			vtkSMPTools::For(0, block.elementsNb, [&](vtkIdType begin, vtkIdType end) {
+				for (vtkIdType i = begin; i < end; ++i)
+					offsets->SetValue(block.firstElement + i, offset + i * block.nodesNb);
+			});
+			offset += block.elementsNb * block.nodesNb;
+		}
+		offsets->SetValue(offsets->GetNumberOfValues() - 1, offset);
+	};
+
+	if (connectivityNb <= std::numeric_limits<std::int32_t>::max()) {
+		const auto offsets = vtkSmartPointer<vtkTypeInt32Array>::New();
+		offsets->SetNumberOfValues(elementsNb + 1);
+		fillOffsets(offsets.Get());
+		cells->SetData(offsets,
+			this->CreateArrayView<vtkTypeInt32Array>(elements.connectivity.data(), connectivityNb, 1));
+		return cells;
+	}
+
+	// Offsets exceed 32-bit range, VTK requires offsets and connectivity of the same type
+	SPDLOG_WARN("Connectivity exceeds 32-bit offsets range, it is copied to 64-bit view");
+	const auto offsets = vtkSmartPointer<vtkTypeInt64Array>::New();
+	offsets->SetNumberOfValues(elementsNb + 1);
+	fillOffsets(offsets.Get());
+
+	const auto connectivity = vtkSmartPointer<vtkTypeInt64Array>::New();
+	connectivity->SetNumberOfValues(connectivityNb);
+	std::copy(elements.connectivity.begin(), elements.connectivity.end(),
+		connectivity->GetPointer(0));
+	cells->SetData(offsets, connectivity);
+	return cells;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkPoints> MGTMesh_MeshData::CreatePointsView() {
+	const auto points = vtkSmartPointer<vtkPoints>::New();
+	points->SetData(this->CreateArrayView<vtkDoubleArray>(
+		_nodes.data(), static_cast<vtkIdType>(_nodes.size()), 3));
+	return points;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkUnstructuredGrid> MGTMesh_MeshData::CreateVolumeView(vtkPoints* points) {
+	Elements& elements = this->GetElements(Dimension::Volume);
+	const auto elementsNb = static_cast<vtkIdType>(elements.tags.size());
+
+	const auto cellTypes = vtkSmartPointer<vtkUnsignedCharArray>::New();
+	cellTypes->SetNumberOfValues(elementsNb);
+	for (const ElementBlock& block : elements.blocks) {
+		std::fill_n(cellTypes->GetPointer(block.firstElement), block.elementsNb,
+			static_cast<unsigned char>(block.cellType));
+	}
+
+	const auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+	grid->SetPoints(points);
+	grid->SetCells(cellTypes, this->CreateCellsView(elements));
+
+	const auto solidIds
+		= this->CreateArrayView<vtkTypeInt32Array>(elements.tags.data(), elementsNb, 1);
+	solidIds->SetName("SolidId");
+	grid->GetCellData()->AddArray(solidIds);
+	return grid;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkPolyData> MGTMesh_MeshData::CreateSurfaceView(vtkPoints* points) {
+	Elements& elements = this->GetElements(Dimension::Surface);
+	const auto elementsNb = static_cast<vtkIdType>(elements.tags.size());
+
+	const auto polyData = vtkSmartPointer<vtkPolyData>::New();
+	polyData->SetPoints(points);
+	polyData->SetPolys(this->CreateCellsView(elements));
+
+	const auto faceIds
+		= this->CreateArrayView<vtkTypeInt32Array>(elements.tags.data(), elementsNb, 1);
+	faceIds->SetName("FaceId");
+	polyData->GetCellData()->AddArray(faceIds);
+	return polyData;
+}
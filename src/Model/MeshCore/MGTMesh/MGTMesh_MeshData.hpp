@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_MeshData.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef MGTMESH_MESHDATA_HPP
+#define MGTMESH_MESHDATA_HPP
+
+#include <vtkObject.h>
+#include <vtkSmartPointer.h>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+class vtkCellArray;
+class vtkInformationObjectBaseKey;
+class vtkPoints;
+class vtkPolyData;
+class vtkUnstructuredGrid;
+
+/**
+ * Native mesh storage: node coordinates in a single contiguous array and elements
+ * of each dimension in blocks of a single VTK cell type with 32-bit connectivity.
+ * Every element carries a tag of the geometric entity it was generated on (solid ID
+ * of volume elements, face ID of surface elements). Volume and surface elements
+ * share nodes.
+ *
+ * VTK views created by Create*View methods reference the storage without copying
+ * coordinates, connectivity or tags, only cell offsets and types are generated.
+ * Views keep the data alive, but they are invalidated by further modification.
+ */
+class MGTMesh_MeshData final : public vtkObject {
+public:
+	static MGTMesh_MeshData* New();
+	vtkTypeMacro(MGTMesh_MeshData, vtkObject);
+
+	// Key under which arrays viewing the storage keep reference to it
+	static vtkInformationObjectBaseKey* MESH_DATA();
+
+	enum class Dimension { Volume, Surface };
+
+	struct ElementBlock {
+		int cellType;
+		int nodesNb;
+		vtkIdType firstElement;
+		vtkIdType elementsNb;
+	};
+
+	// Connectivity and tags of appended block, to be filled by the caller
+	struct BlockData {
+		std::span<std::int32_t> connectivity;
+		std::span<std::int32_t> tags;
+	};
+
+	// Resizes node storage and returns x, y, z coordinates to be filled
+	std::span<double> AllocateNodes(vtkIdType nodesNb);
+
+	// Appends block of elements of a supported linear cell type. Subsequent blocks of
+	// the same type are merged.
+	BlockData AppendBlock(Dimension dimension, int cellType, vtkIdType elementsNb);
+
+	void Clear();
+
+	// Moves node i to position newIds[i] and updates connectivity accordingly
+	void RenumberNodes(std::span<const std::int32_t> newIds);
+
+	// Places element order[i] at position i, tags follow their elements. Elements
+	// must not be moved out of their blocks.
+	void ReorderElements(Dimension dimension, std::span<const vtkIdType> order);
+
+	[[nodiscard]] vtkIdType GetNumberOfNodes() const;
+	[[nodiscard]] std::span<const double> GetNodes() const { return _nodes; }
+
+	// Coordinates to be moved in place, points views must be marked modified afterwards
+	[[nodiscard]] std::span<double> GetMutableNodes() { return _nodes; }
+
+	[[nodiscard]] vtkIdType GetNumberOfElements(Dimension dimension) const;
+	[[nodiscard]] const std::vector<ElementBlock>& GetBlocks(Dimension dimension) const;
+	[[nodiscard]] std::span<const std::int32_t> GetConnectivity(Dimension dimension) const;
+	[[nodiscard]] std::span<const std::int32_t> GetTags(Dimension dimension) const;
+
+	// Size of the storage in bytes
+	[[nodiscard]] std::size_t GetMemorySize() const;
+
+	[[nodiscard]] vtkSmartPointer<vtkPoints> CreatePointsView();
+
+	// Grid of volume elements with "SolidId" cell data
+	[[nodiscard]] vtkSmartPointer<vtkUnstructuredGrid> CreateVolumeView(vtkPoints* points);
+
+	// Polygons of surface elements with "FaceId" cell data
+	[[nodiscard]] vtkSmartPointer<vtkPolyData> CreateSurfaceView(vtkPoints* points);
+
+	[[nodiscard]] static int GetNodesNb(int cellType);
+
+protected:
+	MGTMesh_MeshData();
+	~MGTMesh_MeshData() override;
+
+private:
+	struct Elements {
+		std::vector<std::int32_t> connectivity;
+		std::vector<std::int32_t> tags;
+		std::vector<ElementBlock> blocks;
+	};
+
+	[[nodiscard]] const Elements& GetElements(Dimension dimension) const;
+	[[nodiscard]] Elements& GetElements(Dimension dimension);
+
+	// Cell array viewing connectivity of the elements
+	[[nodiscard]] vtkSmartPointer<vtkCellArray> CreateCellsView(Elements& elements);
+
+	template <typename ArrayT, typename ValueT>
+	[[nodiscard]] vtkSmartPointer<ArrayT> CreateArrayView(
+		ValueT* data, vtkIdType valuesNb, int componentsNb);
+
+private:
+	std::vector<double> _nodes;
+	std::array<Elements, 2> _elements;
+};
+
+#endif
@@ -23,6 +23,9 @@
 * Date      : 25/01/2025
 */
 #include "MGTMesh_MeshObject.hpp"
+#include "MGTMesh_MeshData.hpp"
+
+#include <vtkPoints.h>
 
 vtkStandardNewMacro(MGTMesh_MeshObject);
 
@@ -40,6 +43,7 @@ MGTMesh_MeshObject::~MGTMesh_MeshObject() {
 //----------------------------------------------------------------------------
 void MGTMesh_MeshObject::SetInternalMesh(vtkUnstructuredGrid* mesh) {
 	_internalMesh = vtkSmartPointer<vtkUnstructuredGrid>::Take(mesh);
+	_meshData = nullptr;
 	this->SetBlock(0, _internalMesh);
 }
 
@@ -52,9 +56,31 @@ MGTMesh_MeshObject::GetInternalMesh() const {
 //----------------------------------------------------------------------------
 void MGTMesh_MeshObject::SetBoundaryMesh(vtkPolyData* mesh) {
 	_boundaryMesh = vtkSmartPointer<vtkPolyData>::Take(mesh);
+	_meshData = nullptr;
+	this->SetBlock(1, _boundaryMesh);
+}
+
+//----------------------------------------------------------------------------
+void MGTMesh_MeshObject::SetMeshData(MGTMesh_MeshData* meshData) {
+	if (!meshData) {
+		_internalMesh = vtkSmartPointer<vtkUnstructuredGrid>::New();
+		_boundaryMesh = vtkSmartPointer<vtkPolyData>::New();
+	} else {
+		const vtkSmartPointer<vtkPoints> points = meshData->CreatePointsView();
+		_internalMesh = meshData->CreateVolumeView(points);
+		_boundaryMesh = meshData->CreateSurfaceView(points);
+	}
+
+	_meshData = meshData;
+	this->SetBlock(0, _internalMesh);
 	this->SetBlock(1, _boundaryMesh);
 }
 
+//----------------------------------------------------------------------------
+vtkSmartPointer<MGTMesh_MeshData> MGTMesh_MeshObject::GetMeshData() const {
+	return _meshData;
+}
+
 //----------------------------------------------------------------------------
 vtkSmartPointer<vtkPolyData> MGTMesh_MeshObject::GetBoundaryMesh() const {
 	return _boundaryMesh;
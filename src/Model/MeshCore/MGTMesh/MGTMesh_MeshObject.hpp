@@ -31,6 +31,8 @@
 #include <vtkSmartPointer.h>
 #include <vtkUnstructuredGrid.h>
 
+class MGTMesh_MeshData;
+
 class MGTMesh_MeshObject final : public vtkMultiBlockDataSet {
 public:
 	static MGTMesh_MeshObject* New();
@@ -42,13 +44,20 @@ public:
 	void SetInternalMesh(vtkUnstructuredGrid* mesh);
 	void SetBoundaryMesh(vtkPolyData* mesh);
 
+	// Replaces both blocks with views sharing nodes and referencing the data without copying
+	void SetMeshData(MGTMesh_MeshData* meshData);
+
 	[[nodiscard]] vtkSmartPointer<vtkUnstructuredGrid> GetInternalMesh() const;
 	[[nodiscard]] vtkSmartPointer<vtkPolyData> GetBoundaryMesh() const;
+
+	// Native storage the blocks are views of, nullptr if blocks were set directly
+	[[nodiscard]] vtkSmartPointer<MGTMesh_MeshData> GetMeshData() const;
 	[[nodiscard]] bool IsEmpty() const;
 
 private:
 	vtkSmartPointer<vtkUnstructuredGrid> _internalMesh;
 	vtkSmartPointer<vtkPolyData> _boundaryMesh;
+	vtkSmartPointer<MGTMesh_MeshData> _meshData;
 };
 
 #endif
@@ -26,8 +26,11 @@
 #ifndef MGTMESH_MESHPARAMETRS_HPP
 #define MGTMESH_MESHPARAMETRS_HPP
 
+#include <memory>
 #include <string>
 
+class MGTMesh_SizeField;
+
 class MGTMesh_MeshParameters {
 public:
 	explicit MGTMesh_MeshParameters() = default;
@@ -46,6 +49,10 @@ public:
 	std::string meshSizeFile;
 	double nbSegPerRadius {};
 	double nbSegPerEdge {};
+	double nbSegPerGap {};
+
+	// Local sizes of shapes, already built
+	std::shared_ptr<const MGTMesh_SizeField> sizeField;
 
 	// Optimizer
 	bool optimize {};
@@ -54,6 +61,15 @@ public:
 	double elemSizeWeight {};
 	int worstElemMeasure {};
 
+	// Renumbering of nodes and elements for cache locality
+	bool renumber {};
+
+	// Parts are fused before meshing, so that their contact faces are meshed once
+	bool sharedTopology {};
+
+	// Extruded and revolved solids are meshed with swept hexahedra
+	bool sweep {};
+
 	// Insider
 	bool surfaceCurvature {};
 	bool useDelauney {};
@@ -0,0 +1,458 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_Partitioner.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#include "MGTMesh_Partitioner.hpp"
+#include "MGTMesh_MeshObject.hpp"
+
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
+#include <vtkDataSetAttributes.h>
+#include <vtkIdList.h>
+#include <vtkMath.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkSMPThreadLocalObject.h>
+#include <vtkSMPTools.h>
+#include <vtkStaticCellLinks.h>
+#include <vtkTypeInt32Array.h>
+#include <vtkTypeInt64Array.h>
+#include <vtkUnsignedCharArray.h>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <future>
+#include <numeric>
+#include <span>
+
+namespace {
+
+using Method = MGTMesh_Partitioner::Method;
+using Point = std::array<double, 3>;
+
+// Both halves are bisected concurrently down to this depth (up to 16 tasks)
+constexpr int ParallelDepth = 4;
+
+std::vector<Point> ComputeCentroids(vtkUnstructuredGrid* grid) {
+	const vtkIdType cellsNb = grid->GetNumberOfCells();
+	vtkCellArray* cells = grid->GetCells();
+	vtkPoints* points = grid->GetPoints();
+	std::vector<Point> centroids(cellsNb);
+
+	vtkSMPThreadLocalObject<vtkIdList> localNodeIds;
+	vtkSMPTools::For(0, cellsNb, [&](const vtkIdType begin, const vtkIdType end) {
+		vtkIdList* nodeIds = localNodeIds.Local();
+		double coords[3];
+		for (vtkIdType cellId = begin; cellId < end; ++cellId) {
+			cells->GetCellAtId(cellId, nodeIds);
+			const vtkIdType nodesNb = nodeIds->GetNumberOfIds();
+			Point centroid = { 0.0, 0.0, 0.0 };
+			for (vtkIdType i = 0; i < nodesNb; ++i) {
+				points->GetPoint(nodeIds->GetId(i), coords);
+				for (int k = 0; k < 3; ++k)
+					centroid[k] += coords[k];
+			}
+			for (double& coord : centroid)
+				coord /= static_cast<double>(std::max<vtkIdType>(nodesNb, 1));
+			centroids[cellId] = centroid;
+		}
+	});
+	return centroids;
+}
+
+// Cells are split by planes perpendicular to this direction
+Point ComputeSplitDirection(const std::span<const vtkIdType> cellIds,
+	const std::vector<Point>& centroids, const Method method) {
+	if (method == Method::Coordinate) {
+		Point min = centroids[cellIds.front()];
+		Point max = min;
+		for (const vtkIdType cellId : cellIds) {
+			for (int k = 0; k < 3; ++k) {
+				min[k] = std::min(min[k], centroids[cellId][k]);
+				max[k] = std::max(max[k], centroids[cellId][k]);
+			}
+		}
+
+		int axis = 0;
+		for (int k = 1; k < 3; ++k) {
+			if (max[k] - min[k] > max[axis] - min[axis])
+				axis = k;
+		}
+		Point direction = { 0.0, 0.0, 0.0 };
+		direction[axis] = 1.0;
+		return direction;
+	}
+
+	Point mean = { 0.0, 0.0, 0.0 };
+	for (const vtkIdType cellId : cellIds) {
+		for (int k = 0; k < 3; ++k)
+			mean[k] += centroids[cellId][k];
+	}
+	for (double& coord : mean)
+		coord /= static_cast<double>(cellIds.size());
+
+	double covariance[3][3] = {};
+	for (const vtkIdType cellId : cellIds) {
+		const Point& centroid = centroids[cellId];
+		const Point offset
+			= { centroid[0] - mean[0], centroid[1] - mean[1], centroid[2] - mean[2] };
+		for (int i = 0; i < 3; ++i) {
+			for (int j = 0; j < 3; ++j)
+				covariance[i][j] += offset[i] * offset[j];
+		}
+	}
+
+	// Eigenvalues are sorted in decreasing order, eigenvectors are stored in columns
+	double eigenvalues[3];
+	double eigenvectors[3][3];
+	double* covarianceRows[3] = { covariance[0], covariance[1], covariance[2] };
+	double* eigenvectorRows[3] = { eigenvectors[0], eigenvectors[1], eigenvectors[2] };
+	vtkMath::Jacobi(covarianceRows, eigenvalues, eigenvectorRows);
+	return { eigenvectors[0][0], eigenvectors[1][0], eigenvectors[2][0] };
+}
+
+// Splits cells between partitions [firstPart, firstPart + partsNb) so that number
+// of cells of each partition differs by at most one
+void Bisect(const std::span<vtkIdType> cellIds, const std::vector<Point>& centroids,
+	const Method method, const int firstPart, const int partsNb, std::int32_t* partitions,
+	const int depth) {
+	if (partsNb == 1 || cellIds.size() <= 1) {
+		for (const vtkIdType cellId : cellIds)
+			partitions[cellId] = firstPart;
+		return;
+	}
+
+	const int leftPartsNb = partsNb / 2;
+	const std::size_t split = cellIds.size() * leftPartsNb / partsNb;
+	const Point direction = ComputeSplitDirection(cellIds, centroids, method);
+	const auto project = [&centroids, &direction](const vtkIdType cellId) {
+		const Point& centroid = centroids[cellId];
+		return centroid[0] * direction[0] + centroid[1] * direction[1]
+			+ centroid[2] * direction[2];
+	};
+	std::nth_element(cellIds.begin(), cellIds.begin() + static_cast<std::ptrdiff_t>(split),
+		cellIds.end(), [&project](const vtkIdType a, const vtkIdType b) {
+			return project(a) < project(b);
+		});
+
+	const std::span<vtkIdType> left = cellIds.first(split);
+	const std::span<vtkIdType> right = cellIds.subspan(split);
+	if (depth >= ParallelDepth) {
+		Bisect(left, centroids, method, firstPart, leftPartsNb, partitions, depth + 1);
+		Bisect(right, centroids, method, firstPart + leftPartsNb, partsNb - leftPartsNb,
+			partitions, depth + 1);
+		return;
+	}
+
+	std::future<void> leftTask = std::async(std::launch::async, [&, left]() {
+		Bisect(left, centroids, method, firstPart, leftPartsNb, partitions, depth + 1);
+	});
+	Bisect(right, centroids, method, firstPart + leftPartsNb, partsNb - leftPartsNb, partitions,
+		depth + 1);
+	leftTask.get();
+}
+
+// Partition of the volume cell containing all nodes of the polygon
+std::int32_t FindOwnerPartition(vtkIdList* polyNodeIds, vtkStaticCellLinks* links,
+	vtkCellArray* cells, const vtkTypeInt32Array* partitions, vtkIdList* cellNodeIds) {
+	if (polyNodeIds->GetNumberOfIds() == 0)
+		return 0;
+
+	const vtkIdType firstNode = polyNodeIds->GetId(0);
+	const vtkIdType* nodeCells = links->GetCells(firstNode);
+	const vtkIdType nodeCellsNb = links->GetNcells(firstNode);
+	for (vtkIdType i = 0; i < nodeCellsNb; ++i) {
+		cells->GetCellAtId(nodeCells[i], cellNodeIds);
+		bool contains = true;
+		for (vtkIdType j = 1; j < polyNodeIds->GetNumberOfIds() && contains; ++j)
+			contains = cellNodeIds->IsId(polyNodeIds->GetId(j)) >= 0;
+		if (contains)
+			return partitions->GetValue(nodeCells[i]);
+	}
+	return 0;
+}
+
+void AssignBoundaryPartitions(
+	vtkUnstructuredGrid* grid, vtkPolyData* boundary, const vtkTypeInt32Array* partitions) {
+	if (!boundary || boundary->GetNumberOfPolys() == 0)
+		return;
+
+	const vtkIdType polysNb = boundary->GetNumberOfPolys();
+	auto boundaryPartitions = vtkSmartPointer<vtkTypeInt32Array>::New();
+	boundaryPartitions->SetName(MGTMesh_Partitioner::PartitionArrayName);
+	boundaryPartitions->SetNumberOfValues(polysNb);
+
+	if (boundary->GetNumberOfPoints() != grid->GetNumberOfPoints()) {
+		SPDLOG_WARN("Boundary mesh does not share nodes with volume mesh, "
+					"boundary cells are assigned to partition 0");
+		boundaryPartitions->FillValue(0);
+	} else {
+		vtkNew<vtkStaticCellLinks> links;
+		links->BuildLinks(grid);
+		vtkCellArray* cells = grid->GetCells();
+		vtkCellArray* polys = boundary->GetPolys();
+
+		vtkSMPThreadLocalObject<vtkIdList> localPolyNodeIds;
+		vtkSMPThreadLocalObject<vtkIdList> localCellNodeIds;
+		vtkSMPTools::For(0, polysNb, [&](const vtkIdType begin, const vtkIdType end) {
+			vtkIdList* polyNodeIds = localPolyNodeIds.Local();
+			vtkIdList* cellNodeIds = localCellNodeIds.Local();
+			for (vtkIdType polyId = begin; polyId < end; ++polyId) {
+				polys->GetCellAtId(polyId, polyNodeIds);
+				boundaryPartitions->SetValue(polyId,
+					FindOwnerPartition(polyNodeIds, links, cells, partitions, cellNodeIds));
+			}
+		});
+	}
+
+	boundary->GetCellData()->AddArray(boundaryPartitions);
+}
+
+void LogStatistics(vtkUnstructuredGrid* grid, const vtkTypeInt32Array* partitions,
+	const int partsNb) {
+	const vtkIdType cellsNb = grid->GetNumberOfCells();
+	std::vector<vtkIdType> partCellsNb(partsNb, 0);
+	for (vtkIdType cellId = 0; cellId < cellsNb; ++cellId)
+		++partCellsNb[partitions->GetValue(cellId)];
+
+	// Nodes shared by cells of different partitions
+	std::vector<std::int32_t> nodePartitions(grid->GetNumberOfPoints(), -1);
+	std::vector<char> interfaceNodes(nodePartitions.size(), 0);
+	vtkCellArray* cells = grid->GetCells();
+	vtkNew<vtkIdList> nodeIds;
+	for (vtkIdType cellId = 0; cellId < cellsNb; ++cellId) {
+		const std::int32_t partition = partitions->GetValue(cellId);
+		cells->GetCellAtId(cellId, nodeIds);
+		for (vtkIdType i = 0; i < nodeIds->GetNumberOfIds(); ++i) {
+			std::int32_t& nodePartition = nodePartitions[nodeIds->GetId(i)];
+			if (nodePartition < 0)
+				nodePartition = partition;
+			else if (nodePartition != partition)
+				interfaceNodes[nodeIds->GetId(i)] = 1;
+		}
+	}
+
+	const double averageCellsNb = static_cast<double>(cellsNb) / partsNb;
+	SPDLOG_INFO("Mesh partitioned into {} parts, imbalance: {:.3f}, interface nodes: {}",
+		partsNb, static_cast<double>(std::ranges::max(partCellsNb)) / averageCellsNb,
+		std::ranges::count(interfaceNodes, 1));
+}
+
+vtkSmartPointer<MGTMesh_MeshObject> ExtractPartition(vtkUnstructuredGrid* grid,
+	vtkPolyData* boundary, vtkStaticCellLinks* links, const vtkTypeInt32Array* partitions,
+	const std::span<const vtkIdType> ownedCells, const std::int32_t partition) {
+	vtkCellArray* cells = grid->GetCells();
+	vtkNew<vtkIdList> nodeIds;
+
+	// Ghost layer: cells of other partitions sharing a node with owned cells
+	std::vector<vtkIdType> partCells(ownedCells.begin(), ownedCells.end());
+	for (const vtkIdType cellId : ownedCells) {
+		cells->GetCellAtId(cellId, nodeIds);
+		for (vtkIdType i = 0; i < nodeIds->GetNumberOfIds(); ++i) {
+			const vtkIdType* nodeCells = links->GetCells(nodeIds->GetId(i));
+			const vtkIdType nodeCellsNb = links->GetNcells(nodeIds->GetId(i));
+			for (vtkIdType j = 0; j < nodeCellsNb; ++j) {
+				if (partitions->GetValue(nodeCells[j]) != partition)
+					partCells.push_back(nodeCells[j]);
+			}
+		}
+	}
+	const auto ghostCells = std::span(partCells).subspan(ownedCells.size());
+	std::ranges::sort(ghostCells);
+	partCells.erase(std::unique(partCells.begin() + static_cast<std::ptrdiff_t>(ownedCells.size()),
+						partCells.end()),
+		partCells.end());
+
+	// Nodes of partition cells, in increasing order of global IDs
+	std::vector<vtkIdType> globalNodes;
+	for (const vtkIdType cellId : partCells) {
+		cells->GetCellAtId(cellId, nodeIds);
+		for (vtkIdType i = 0; i < nodeIds->GetNumberOfIds(); ++i)
+			globalNodes.push_back(nodeIds->GetId(i));
+	}
+	std::ranges::sort(globalNodes);
+	globalNodes.erase(std::unique(globalNodes.begin(), globalNodes.end()), globalNodes.end());
+	const auto getLocalNode = [&globalNodes](const vtkIdType globalNode) {
+		return static_cast<vtkIdType>(
+			std::ranges::lower_bound(globalNodes, globalNode) - globalNodes.begin());
+	};
+
+	const auto nodesNb = static_cast<vtkIdType>(globalNodes.size());
+	auto points = vtkSmartPointer<vtkPoints>::New();
+	points->SetDataType(grid->GetPoints()->GetDataType());
+	points->SetNumberOfPoints(nodesNb);
+	auto globalNodeIds = vtkSmartPointer<vtkTypeInt64Array>::New();
+	globalNodeIds->SetName(MGTMesh_Partitioner::GlobalNodeArrayName);
+	globalNodeIds->SetNumberOfValues(nodesNb);
+
+	vtkUnstructuredGrid* partGrid = vtkUnstructuredGrid::New();
+	partGrid->SetPoints(points);
+	vtkPointData* pointData = partGrid->GetPointData();
+	pointData->CopyAllocate(grid->GetPointData(), nodesNb);
+	double coords[3];
+	for (vtkIdType i = 0; i < nodesNb; ++i) {
+		grid->GetPoints()->GetPoint(globalNodes[i], coords);
+		points->SetPoint(i, coords);
+		pointData->CopyData(grid->GetPointData(), globalNodes[i], i);
+		globalNodeIds->SetValue(i, globalNodes[i]);
+	}
+	pointData->AddArray(globalNodeIds);
+
+	const auto cellsNb = static_cast<vtkIdType>(partCells.size());
+	auto ghostTypes = vtkSmartPointer<vtkUnsignedCharArray>::New();
+	ghostTypes->SetName(vtkDataSetAttributes::GhostArrayName());
+	ghostTypes->SetNumberOfValues(cellsNb);
+	auto globalCellIds = vtkSmartPointer<vtkTypeInt64Array>::New();
+	globalCellIds->SetName(MGTMesh_Partitioner::GlobalCellArrayName);
+	globalCellIds->SetNumberOfValues(cellsNb);
+
+	partGrid->Allocate(cellsNb);
+	vtkCellData* cellData = partGrid->GetCellData();
+	cellData->CopyAllocate(grid->GetCellData(), cellsNb);
+	for (vtkIdType i = 0; i < cellsNb; ++i) {
+		const vtkIdType cellId = partCells[i];
+		cells->GetCellAtId(cellId, nodeIds);
+		for (vtkIdType j = 0; j < nodeIds->GetNumberOfIds(); ++j)
+			nodeIds->SetId(j, getLocalNode(nodeIds->GetId(j)));
+		partGrid->InsertNextCell(grid->GetCellType(cellId), nodeIds);
+		cellData->CopyData(grid->GetCellData(), cellId, i);
+		ghostTypes->SetValue(i,
+			i < static_cast<vtkIdType>(ownedCells.size()) ? 0
+														  : vtkDataSetAttributes::DUPLICATECELL);
+		globalCellIds->SetValue(i, cellId);
+	}
+	cellData->AddArray(ghostTypes);
+	cellData->AddArray(globalCellIds);
+
+	// Boundary cells of owned cells, sharing nodes with the partition volume mesh
+	vtkPolyData* partBoundary = vtkPolyData::New();
+	partBoundary->SetPoints(points);
+	const auto* boundaryPartitions = boundary
+		? vtkTypeInt32Array::SafeDownCast(
+			  boundary->GetCellData()->GetArray(MGTMesh_Partitioner::PartitionArrayName))
+		: nullptr;
+	if (boundaryPartitions && boundary->GetNumberOfPoints() == grid->GetNumberOfPoints()) {
+		auto polys = vtkSmartPointer<vtkCellArray>::New();
+		vtkCellData* polyData = partBoundary->GetCellData();
+		polyData->CopyAllocate(boundary->GetCellData());
+		for (vtkIdType polyId = 0; polyId < boundary->GetNumberOfPolys(); ++polyId) {
+			if (boundaryPartitions->GetValue(polyId) != partition)
+				continue;
+			boundary->GetPolys()->GetCellAtId(polyId, nodeIds);
+			for (vtkIdType j = 0; j < nodeIds->GetNumberOfIds(); ++j)
+				nodeIds->SetId(j, getLocalNode(nodeIds->GetId(j)));
+			polyData->CopyData(boundary->GetCellData(), polyId, polys->InsertNextCell(nodeIds));
+		}
+		partBoundary->SetPolys(polys);
+	}
+
+	vtkSmartPointer<MGTMesh_MeshObject> partMesh = vtkSmartPointer<MGTMesh_MeshObject>::New();
+	partMesh->SetInternalMesh(partGrid);
+	partMesh->SetBoundaryMesh(partBoundary);
+	return partMesh;
+}
+
+}
+
+//----------------------------------------------------------------------------
+bool MGTMesh_Partitioner::Partition(
+	MGTMesh_MeshObject* mesh, const int partsNb, const Method method) {
+	const vtkSmartPointer<vtkUnstructuredGrid> grid
+		= mesh ? mesh->GetInternalMesh() : nullptr;
+	if (!grid || grid->GetNumberOfCells() == 0) {
+		SPDLOG_WARN("Mesh has no volume cells to partition");
+		return false;
+	}
+	if (partsNb < 1) {
+		SPDLOG_ERROR("Invalid number of partitions: {}", partsNb);
+		return false;
+	}
+
+	const vtkIdType cellsNb = grid->GetNumberOfCells();
+	const std::vector<Point> centroids = ComputeCentroids(grid);
+	std::vector<vtkIdType> cellIds(cellsNb);
+	std::iota(cellIds.begin(), cellIds.end(), 0);
+
+	auto partitions = vtkSmartPointer<vtkTypeInt32Array>::New();
+	partitions->SetName(PartitionArrayName);
+	partitions->SetNumberOfValues(cellsNb);
+	Bisect(cellIds, centroids, method, 0, partsNb, partitions->GetPointer(0), 0);
+	grid->GetCellData()->AddArray(partitions);
+
+	AssignBoundaryPartitions(grid, mesh->GetBoundaryMesh(), partitions);
+	LogStatistics(grid, partitions, partsNb);
+	return true;
+}
+
+//----------------------------------------------------------------------------
+bool MGTMesh_Partitioner::IsPartitioned(const MGTMesh_MeshObject* mesh) {
+	const vtkSmartPointer<vtkUnstructuredGrid> grid
+		= mesh ? mesh->GetInternalMesh() : nullptr;
+	return grid
+		&& vtkTypeInt32Array::SafeDownCast(grid->GetCellData()->GetArray(PartitionArrayName));
+}
+
+//----------------------------------------------------------------------------
+std::vector<vtkSmartPointer<MGTMesh_MeshObject>> MGTMesh_Partitioner::ExtractPartitions(
+	const MGTMesh_MeshObject* mesh) {
+	std::vector<vtkSmartPointer<MGTMesh_MeshObject>> partMeshes;
+	if (!IsPartitioned(mesh))
+		return partMeshes;
+
+	const vtkSmartPointer<vtkUnstructuredGrid> grid = mesh->GetInternalMesh();
+	const auto* partitions
+		= vtkTypeInt32Array::SafeDownCast(grid->GetCellData()->GetArray(PartitionArrayName));
+	const vtkIdType cellsNb = grid->GetNumberOfCells();
+
+	// Cells of each partition, in increasing order
+	std::int32_t partsNb = 0;
+	for (vtkIdType cellId = 0; cellId < cellsNb; ++cellId)
+		partsNb = std::max(partsNb, partitions->GetValue(cellId) + 1);
+	std::vector<vtkIdType> partOffsets(partsNb + 1, 0);
+	for (vtkIdType cellId = 0; cellId < cellsNb; ++cellId)
+		++partOffsets[partitions->GetValue(cellId) + 1];
+	std::partial_sum(partOffsets.begin(), partOffsets.end(), partOffsets.begin());
+	std::vector<vtkIdType> partCells(cellsNb);
+	std::vector<vtkIdType> positions(partOffsets.begin(), partOffsets.end() - 1);
+	for (vtkIdType cellId = 0; cellId < cellsNb; ++cellId)
+		partCells[positions[partitions->GetValue(cellId)]++] = cellId;
+
+	vtkNew<vtkStaticCellLinks> links;
+	links->BuildLinks(grid);
+
+	const vtkSmartPointer<vtkPolyData> boundary = mesh->GetBoundaryMesh();
+	partMeshes.resize(partsNb);
+	vtkSMPTools::For(0, partsNb, 1, [&](const vtkIdType begin, const vtkIdType end) {
+		for (vtkIdType partition = begin; partition < end; ++partition) {
+			const auto ownedCells = std::span<const vtkIdType>(partCells).subspan(
+				partOffsets[partition], partOffsets[partition + 1] - partOffsets[partition]);
+			partMeshes[partition]
+				= ExtractPartition(grid, boundary, links, partitions, ownedCells,
+					static_cast<std::int32_t>(partition));
+		}
+	});
+	return partMeshes;
+}
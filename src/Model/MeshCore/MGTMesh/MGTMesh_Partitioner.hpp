@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_Partitioner.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef MGTMESH_PARTITIONER_HPP
+#define MGTMESH_PARTITIONER_HPP
+
+#include <vtkSmartPointer.h>
+
+#include <vector>
+
+class MGTMesh_MeshObject;
+
+/**
+ * Splits volume mesh into parts of balanced cell counts for parallel solvers.
+ * Centroids of cells are recursively bisected, either along the longest extent of
+ * their bounding box (coordinate bisection) or perpendicular to their principal axis
+ * of inertia (inertial bisection), which gives smaller interfaces for slanted parts.
+ * Partition of each cell is stored in "PartitionId" cell array of both blocks,
+ * boundary cells belong to the partition of the volume cell they bound.
+ */
+class MGTMesh_Partitioner {
+public:
+	enum class Method { Coordinate, Inertial };
+
+	static constexpr const char* PartitionArrayName = "PartitionId";
+	static constexpr const char* GlobalCellArrayName = "GlobalCellId";
+	static constexpr const char* GlobalNodeArrayName = "GlobalNodeId";
+
+	// Returns false if mesh has no volume cells
+	static bool Partition(
+		MGTMesh_MeshObject* mesh, int partsNb, Method method = Method::Inertial);
+
+	[[nodiscard]] static bool IsPartitioned(const MGTMesh_MeshObject* mesh);
+
+	// One mesh object per partition: owned cells followed by single layer of ghost cells
+	// sharing nodes with them, marked in "vtkGhostType" array. Global IDs of cells and
+	// nodes are stored in "GlobalCellId" and "GlobalNodeId" arrays.
+	[[nodiscard]] static std::vector<vtkSmartPointer<MGTMesh_MeshObject>> ExtractPartitions(
+		const MGTMesh_MeshObject* mesh);
+};
+
+#endif
@@ -24,7 +24,9 @@
 */
 
 #include "MGTMesh_ProxyMesh.hpp"
+#include "MGTMesh_MeshData.hpp"
 #include "MGTMesh_MeshObject.hpp"
+#include "MGTMesh_SectionView.hpp"
 
 #include <vtkActor.h>
 #include <vtkAppendFilter.h>
@@ -32,9 +34,210 @@
 #include <vtkCompositeDataGeometryFilter.h>
 #include <vtkPolyDataMapper.h>
 #include <vtkProperty.h>
+#include <vtkSMPTools.h>
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+
+namespace {
+
+using Dimension = MGTMesh_MeshData::Dimension;
+
+// Nodes of different mesh objects closer than this fraction of the shortest boundary
+// edge are welded
+constexpr double WeldFraction = 0.01;
+
+struct Part {
+	const MGTMesh_MeshData* meshData;
+	vtkIdType firstNode;
+	// Added to volume and surface element tags
+	std::array<std::int32_t, 2> tagOffsets;
+};
+
+// Boundary node in cell of spatial hash with side equal to welding tolerance
+struct HashedNode {
+	std::array<std::int64_t, 3> cell;
+	vtkIdType node;
+	int part;
+};
+
+bool CompareCells(const HashedNode& a, const HashedNode& b) { return a.cell < b.cell; }
+
+std::int32_t GetMaxTag(const MGTMesh_MeshData* meshData, const Dimension dimension) {
+	const std::span<const std::int32_t> tags = meshData->GetTags(dimension);
+	return tags.empty() ? 0 : std::ranges::max(tags);
+}
+
+const double* GetPoint(const std::vector<Part>& parts, const HashedNode& hashed) {
+	const Part& part = parts[hashed.part];
+	return part.meshData->GetNodes().data() + 3 * (hashed.node - part.firstNode);
+}
+
+double GetMinEdgeLength(const MGTMesh_MeshData* meshData) {
+	const std::span<const double> nodes = meshData->GetNodes();
+	const std::span<const std::int32_t> connectivity
+		= meshData->GetConnectivity(Dimension::Surface);
+	double minLength = std::numeric_limits<double>::infinity();
+	vtkIdType offset = 0;
+	for (const MGTMesh_MeshData::ElementBlock& block : meshData->GetBlocks(Dimension::Surface)) {
+		for (vtkIdType i = 0; i < block.elementsNb; ++i) {
+			const std::int32_t* element = connectivity.data() + offset + i * block.nodesNb;
+			for (int j = 0; j < block.nodesNb; ++j) {
+				const double* p0 = nodes.data() + 3 * element[j];
+				const double* p1 = nodes.data() + 3 * element[(j + 1) % block.nodesNb];
+				const double length = std::hypot(p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2]);
+				if (length > 0.0)
+					minLength = std::min(minLength, length);
+			}
+		}
+		offset += block.elementsNb * block.nodesNb;
+	}
+	return minLength;
+}
+
+// Nodes of surface elements of all parts sorted by cells of the spatial hash
+std::vector<HashedNode> HashBoundaryNodes(const std::vector<Part>& parts, const double cellSize) {
+	std::vector<HashedNode> hashedNodes;
+	for (int i = 0; i < static_cast<int>(parts.size()); ++i) {
+		const MGTMesh_MeshData* meshData = parts[i].meshData;
+		std::vector<char> isBoundary(meshData->GetNumberOfNodes(), 0);
+		for (const std::int32_t node : meshData->GetConnectivity(Dimension::Surface))
+			isBoundary[node] = 1;
+		for (vtkIdType node = 0; node < meshData->GetNumberOfNodes(); ++node) {
+			if (isBoundary[node])
+				hashedNodes.push_back({ {}, parts[i].firstNode + node, i });
+		}
+	}
+
+	vtkSMPTools::For(0, static_cast<vtkIdType>(hashedNodes.size()),
+		[&](const vtkIdType begin, const vtkIdType end) {
+			for (vtkIdType i = begin; i < end; ++i) {
+				const double* point = GetPoint(parts, hashedNodes[i]);
+				for (int k = 0; k < 3; ++k)
+					hashedNodes[i].cell[k]
+						= static_cast<std::int64_t>(std::floor(point[k] / cellSize));
+			}
+		});
+	vtkSMPTools::Sort(hashedNodes.begin(), hashedNodes.end(),
+		[](const HashedNode& a, const HashedNode& b) {
+			return a.cell < b.cell || (a.cell == b.cell && a.node < b.node);
+		});
+	return hashedNodes;
+}
+
+// Each node is represented by the first node of other parts within tolerance, or by
+// itself. Chains of representatives are resolved, so every node points to the first
+// node of its weld.
+std::vector<vtkIdType> FindRepresentatives(const std::vector<Part>& parts,
+	const std::vector<HashedNode>& hashedNodes, const vtkIdType nodesNb, const double tolerance) {
+	std::vector<vtkIdType> representatives(nodesNb);
+	std::iota(representatives.begin(), representatives.end(), vtkIdType { 0 });
+
+	const double squaredTolerance = tolerance * tolerance;
+	vtkSMPTools::For(0, static_cast<vtkIdType>(hashedNodes.size()),
+		[&](const vtkIdType begin, const vtkIdType end) {
+			for (vtkIdType i = begin; i < end; ++i) {
+				const HashedNode& hashed = hashedNodes[i];
+				const double* point = GetPoint(parts, hashed);
+				vtkIdType representative = hashed.node;
+				for (int n = 0; n < 27; ++n) {
+					HashedNode neighbor { hashed.cell, 0, 0 };
+					neighbor.cell[0] += n % 3 - 1;
+					neighbor.cell[1] += n / 3 % 3 - 1;
+					neighbor.cell[2] += n / 9 - 1;
+					const auto [first, last] = std::equal_range(
+						hashedNodes.begin(), hashedNodes.end(), neighbor, CompareCells);
+					for (auto other = first; other != last; ++other) {
+						if (other->part == hashed.part || other->node >= representative)
+							continue;
+						const double* otherPoint = GetPoint(parts, *other);
+						const double d[3] = { otherPoint[0] - point[0], otherPoint[1] - point[1],
+							otherPoint[2] - point[2] };
+						if (d[0] * d[0] + d[1] * d[1] + d[2] * d[2] <= squaredTolerance)
+							representative = other->node;
+					}
+				}
+				representatives[hashed.node] = representative;
+			}
+		});
+
+	// Representatives precede their nodes
+	for (vtkIdType node = 0; node < nodesNb; ++node)
+		representatives[node] = representatives[representatives[node]];
+	return representatives;
+}
+
+// Welded nodes are expected to lie on interface faces matched by a face of another part.
+// The rest marks parts touching with non-matching meshes, or along edges or at vertices.
+void ReportNonMatchingInterfaces(const std::vector<Part>& parts,
+	const std::vector<std::int32_t>& newIds, const std::vector<char>& isWelded,
+	const std::span<const double> mergedNodes) {
+	struct Face {
+		std::array<std::int32_t, 4> nodes;
+		int part;
+	};
+	std::vector<Face> faces;
+	for (int i = 0; i < static_cast<int>(parts.size()); ++i) {
+		const std::span<const std::int32_t> connectivity
+			= parts[i].meshData->GetConnectivity(Dimension::Surface);
+		vtkIdType offset = 0;
+		for (const auto& block : parts[i].meshData->GetBlocks(Dimension::Surface)) {
+			for (vtkIdType e = 0; e < block.elementsNb; ++e, offset += block.nodesNb) {
+				Face face { { -1, -1, -1, -1 }, i };
+				bool isInterface = block.nodesNb <= 4;
+				for (int j = 0; j < block.nodesNb && isInterface; ++j) {
+					face.nodes[j] = newIds[parts[i].firstNode + connectivity[offset + j]];
+					isInterface = isWelded[face.nodes[j]];
+				}
+				if (isInterface) {
+					std::ranges::sort(face.nodes);
+					faces.push_back(face);
+				}
+			}
+		}
+	}
+	vtkSMPTools::Sort(faces.begin(), faces.end(),
+		[](const Face& a, const Face& b) { return a.nodes < b.nodes; });
+
+	std::vector<char> isMatched(isWelded.size(), 0);
+	for (std::size_t i = 0; i + 1 < faces.size(); ++i) {
+		if (faces[i].nodes != faces[i + 1].nodes || faces[i].part == faces[i + 1].part)
+			continue;
+		for (const std::int32_t node : faces[i].nodes) {
+			if (node >= 0)
+				isMatched[node] = 1;
+		}
+	}
+
+	vtkIdType nonMatchingNb = 0;
+	std::array<double, 6> bounds { std::numeric_limits<double>::max(),
+		std::numeric_limits<double>::lowest(), std::numeric_limits<double>::max(),
+		std::numeric_limits<double>::lowest(), std::numeric_limits<double>::max(),
+		std::numeric_limits<double>::lowest() };
+	for (std::size_t node = 0; node < isWelded.size(); ++node) {
+		if (!isWelded[node] || isMatched[node])
+			continue;
+		++nonMatchingNb;
+		for (int k = 0; k < 3; ++k) {
+			bounds[2 * k] = std::min(bounds[2 * k], mergedNodes[3 * node + k]);
+			bounds[2 * k + 1] = std::max(bounds[2 * k + 1], mergedNodes[3 * node + k]);
+		}
+	}
+	if (nonMatchingNb > 0)
+		SPDLOG_WARN("{} welded nodes are not on matching interface faces, parts touch with "
+					"non-matching meshes within ({}, {}, {}) - ({}, {}, {})",
+			nonMatchingNb, bounds[0], bounds[2], bounds[4], bounds[1], bounds[3], bounds[5]);
+}
+
+}
+
 //----------------------------------------------------------------------------
 MGTMesh_ProxyMesh::MGTMesh_ProxyMesh(MGTMesh_MeshObject* mgtMesh) {
 	if (!mgtMesh) {
@@ -51,11 +254,35 @@ MGTMesh_ProxyMesh::~MGTMesh_ProxyMesh() = default;
 
 //----------------------------------------------------------------------------
 MGTMesh_ProxyMesh::MGTMesh_ProxyMesh(
-	const std::unordered_map<int, vtkSmartPointer<MGTMesh_MeshObject>>&
-		meshObjectsMap) {
+	const std::unordered_map<int, vtkSmartPointer<MGTMesh_MeshObject>>& meshObjectsMap,
+	const MergeMode mode, const TagMode tagMode) {
 	if (meshObjectsMap.empty())
 		return;
 
+	// Single mesh object is displayed directly, so its views of native mesh data are
+	// not copied to 64-bit arrays by the append filters
+	if (meshObjectsMap.size() == 1 && meshObjectsMap.begin()->second) {
+		_mgtMesh = meshObjectsMap.begin()->second;
+		return;
+	}
+
+	if (mode == MergeMode::Weld) {
+		// Mesh objects are merged in order of their keys, so that the result is the same
+		// for the same map
+		std::vector<int> keys;
+		for (const auto& [key, meshObject] : meshObjectsMap) {
+			if (meshObject)
+				keys.push_back(key);
+		}
+		std::ranges::sort(keys);
+		std::vector<MGTMesh_MeshObject*> meshObjects;
+		for (const int key : keys)
+			meshObjects.push_back(meshObjectsMap.at(key));
+		if (this->Weld(meshObjects, tagMode))
+			return;
+		SPDLOG_WARN("Mesh objects without native mesh data are appended without welding");
+	}
+
 	const auto appendUnstructuredGrid = vtkSmartPointer<vtkAppendFilter>::New();
 	const auto appendPolyData = vtkSmartPointer<vtkAppendPolyData>::New();
 
@@ -107,6 +334,130 @@ MGTMesh_ProxyMesh::MGTMesh_ProxyMesh(
 	}
 }
 
+//----------------------------------------------------------------------------
+bool MGTMesh_ProxyMesh::Weld(
+	const std::vector<MGTMesh_MeshObject*>& meshObjects, const TagMode tagMode) {
+	std::vector<Part> parts;
+	vtkIdType nodesNb = 0;
+	std::array<std::int32_t, 2> tagOffsets { 0, 0 };
+	double minEdgeLength = std::numeric_limits<double>::infinity();
+	for (const MGTMesh_MeshObject* meshObject : meshObjects) {
+		const vtkSmartPointer<MGTMesh_MeshData> meshData = meshObject->GetMeshData();
+		if (!meshData)
+			return false;
+		parts.push_back({ meshData, nodesNb, tagOffsets });
+		nodesNb += meshData->GetNumberOfNodes();
+		if (tagMode == TagMode::Offset) {
+			for (const Dimension dimension : { Dimension::Volume, Dimension::Surface })
+				tagOffsets[static_cast<int>(dimension)] += GetMaxTag(meshData, dimension);
+		}
+		minEdgeLength = std::min(minEdgeLength, GetMinEdgeLength(meshData));
+	}
+	if (nodesNb > std::numeric_limits<std::int32_t>::max()) {
+		SPDLOG_ERROR("Merged mesh has too many nodes for 32-bit connectivity");
+		return false;
+	}
+
+	// Without surface elements there is nothing to weld, tolerance is then irrelevant
+	const double tolerance
+		= std::isfinite(minEdgeLength) ? WeldFraction * minEdgeLength : 1.0;
+	const std::vector<vtkIdType> representatives = FindRepresentatives(
+		parts, HashBoundaryNodes(parts, tolerance), nodesNb, tolerance);
+
+	std::vector<std::int32_t> newIds(nodesNb);
+	std::int32_t mergedNodesNb = 0;
+	for (vtkIdType node = 0; node < nodesNb; ++node)
+		newIds[node] = representatives[node] == node ? mergedNodesNb++
+													 : newIds[representatives[node]];
+
+	auto merged = vtkSmartPointer<MGTMesh_MeshData>::New();
+	const std::span<double> mergedNodes = merged->AllocateNodes(mergedNodesNb);
+	std::vector<char> isWelded(mergedNodesNb, 0);
+	for (vtkIdType node = 0; node < nodesNb; ++node) {
+		if (representatives[node] != node)
+			isWelded[newIds[node]] = 1;
+	}
+	for (const Part& part : parts) {
+		const std::span<const double> nodes = part.meshData->GetNodes();
+		vtkSMPTools::For(0, part.meshData->GetNumberOfNodes(),
+			[&](const vtkIdType begin, const vtkIdType end) {
+				for (vtkIdType node = begin; node < end; ++node) {
+					const vtkIdType global = part.firstNode + node;
+					if (representatives[global] == global)
+						std::copy_n(nodes.begin() + 3 * node, 3,
+							mergedNodes.begin() + 3 * static_cast<std::size_t>(newIds[global]));
+				}
+			});
+	}
+
+	// Blocks of the same cell type of all parts are merged into one block
+	for (const Dimension dimension : { Dimension::Volume, Dimension::Surface }) {
+		std::vector<std::pair<int, vtkIdType>> cellTypes;
+		for (const Part& part : parts) {
+			for (const auto& block : part.meshData->GetBlocks(dimension)) {
+				const auto found = std::ranges::find(
+					cellTypes, block.cellType, &std::pair<int, vtkIdType>::first);
+				if (found == cellTypes.end())
+					cellTypes.emplace_back(block.cellType, block.elementsNb);
+				else
+					found->second += block.elementsNb;
+			}
+		}
+
+		for (const auto& [cellType, elementsNb] : cellTypes) {
+			const MGTMesh_MeshData::BlockData target
+				= merged->AppendBlock(dimension, cellType, elementsNb);
+			const int elementNodesNb = MGTMesh_MeshData::GetNodesNb(cellType);
+			vtkIdType filled = 0;
+			for (const Part& part : parts) {
+				const std::span<const std::int32_t> connectivity
+					= part.meshData->GetConnectivity(dimension);
+				const std::span<const std::int32_t> tags = part.meshData->GetTags(dimension);
+				vtkIdType offset = 0;
+				for (const auto& block : part.meshData->GetBlocks(dimension)) {
+					if (block.cellType == cellType) {
+						vtkSMPTools::For(0, block.elementsNb * elementNodesNb,
+							[&](const vtkIdType begin, const vtkIdType end) {
+								for (vtkIdType i = begin; i < end; ++i)
+									target.connectivity[filled * elementNodesNb + i]
+										= newIds[part.firstNode + connectivity[offset + i]];
+							});
+						const std::int32_t tagOffset
+							= part.tagOffsets[static_cast<int>(dimension)];
+						std::transform(tags.begin() + block.firstElement,
+							tags.begin() + block.firstElement + block.elementsNb,
+							target.tags.begin() + filled,
+							[tagOffset](const std::int32_t tag) { return tag + tagOffset; });
+						filled += block.elementsNb;
+					}
+					offset += block.elementsNb * block.nodesNb;
+				}
+			}
+		}
+	}
+
+	ReportNonMatchingInterfaces(parts, newIds, isWelded, mergedNodes);
+	SPDLOG_INFO("Merged {} meshes, {} nodes welded at interfaces", parts.size(),
+		nodesNb - mergedNodesNb);
+
+	_mgtMesh = vtkSmartPointer<MGTMesh_MeshObject>::New();
+	_mgtMesh->SetMeshData(merged);
+	return true;
+}
+
+//----------------------------------------------------------------------------
+vtkMTimeType MGTMesh_ProxyMesh::GetMTime() const {
+	return _mgtMesh ? _mgtMesh->GetMTime() : 0;
+}
+
+//----------------------------------------------------------------------------
+MGTMesh_MeshObject* MGTMesh_ProxyMesh::GetMeshObject() const { return _mgtMesh; }
+
+//----------------------------------------------------------------------------
+std::unique_ptr<MGTMesh_SectionView> MGTMesh_ProxyMesh::CreateSectionView() const {
+	return std::make_unique<MGTMesh_SectionView>(_mgtMesh);
+}
+
 //----------------------------------------------------------------------------
 vtkSmartPointer<vtkActor> MGTMesh_ProxyMesh::GetProxyMeshActor() const {
 	vtkSmartPointer<vtkActor> actor = vtkSmartPointer<vtkActor>::New();
@@ -26,20 +26,46 @@
 
 #include <vtkSmartPointer.h>
 
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 class vtkActor;
 class MGTMesh_MeshObject;
+class MGTMesh_SectionView;
 
 class MGTMesh_ProxyMesh {
 public:
+	// Append keeps nodes of mesh objects separate, Weld merges coincident boundary nodes
+	// of different mesh objects so that touching parts are connected
+	enum class MergeMode { Append, Weld };
+
+	// Welded element tags are offset past the tags of preceding mesh objects, unless the
+	// mesh objects were tagged on the same shape and already share its numbering
+	enum class TagMode { Offset, Shared };
+
 	explicit MGTMesh_ProxyMesh(MGTMesh_MeshObject* mgtMesh);
 	explicit MGTMesh_ProxyMesh(
-		const std::unordered_map<int, vtkSmartPointer<MGTMesh_MeshObject>>& meshObjectsMap);
+		const std::unordered_map<int, vtkSmartPointer<MGTMesh_MeshObject>>& meshObjectsMap,
+		MergeMode mode = MergeMode::Append, TagMode tagMode = TagMode::Offset);
 	~MGTMesh_ProxyMesh();
 
 	[[nodiscard]] vtkSmartPointer<vtkActor> GetProxyMeshActor() const;
 
+	// Merged mesh object, nullptr if there were no mesh objects
+	[[nodiscard]] MGTMesh_MeshObject* GetMeshObject() const;
+
+	// Modification time of merged mesh object (0 if there is none)
+	[[nodiscard]] vtkMTimeType GetMTime() const;
+
+	// Section view sharing data with merged mesh object
+	[[nodiscard]] std::unique_ptr<MGTMesh_SectionView> CreateSectionView() const;
+
+private:
+	// Merges native mesh data of mesh objects in one pass, returns false if some mesh
+	// object has no native mesh data
+	bool Weld(const std::vector<MGTMesh_MeshObject*>& meshObjects, TagMode tagMode);
+
 private:
 	vtkSmartPointer<MGTMesh_MeshObject> _mgtMesh;
 };
@@ -0,0 +1,696 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_Quality.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#include "MGTMesh_Quality.hpp"
+#include "MGTMesh_MeshObject.hpp"
+
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
+#include <vtkCellType.h>
+#include <vtkDoubleArray.h>
+#include <vtkFloatArray.h>
+#include <vtkIdList.h>
+#include <vtkPoints.h>
+#include <vtkSMPThreadLocal.h>
+#include <vtkSMPThreadLocalObject.h>
+#include <vtkSMPTools.h>
+#include <vtkUnsignedCharArray.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numbers>
+
+namespace {
+
+using Metric = MGTMesh_Quality::Metric;
+using Report = MGTMesh_Quality::Report;
+using Histogram = MGTMesh_Quality::Histogram;
+
+// Number of elements evaluated at once by metric kernels
+constexpr std::size_t BatchSize = 64;
+
+constexpr double Tiny = std::numeric_limits<double>::min();
+
+// Aspect ratio of degenerated elements
+constexpr double MaxAspectRatio = std::numeric_limits<float>::max();
+
+// Upper bound of aspect ratio histogram, higher values are counted in the last bin
+constexpr double MaxHistogramAspectRatio = 100.0;
+
+constexpr double Sqrt2 = std::numbers::sqrt2;
+constexpr double Sqrt3 = std::numbers::sqrt3;
+constexpr double Sqrt6 = Sqrt2 * Sqrt3;
+
+struct Vec {
+	double x;
+	double y;
+	double z;
+};
+
+inline Vec operator-(const Vec& a, const Vec& b) {
+	return { a.x - b.x, a.y - b.y, a.z - b.z };
+}
+
+inline Vec Cross(const Vec& a, const Vec& b) {
+	return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+}
+
+inline double Dot(const Vec& a, const Vec& b) {
+	return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+inline double Length(const Vec& a) {
+	return std::sqrt(Dot(a, a));
+}
+
+// Kernels are kept free of branches, so that they are vectorized
+inline double SafeInverse(const double value) {
+	return 1.0 / std::max(value, Tiny);
+}
+
+inline double Clamp(const double value) {
+	return std::min(std::max(value, -1.0), 1.0);
+}
+
+// Coordinates of nodes of batch of elements, one array per node and coordinate
+template <int NodesNb>
+struct Batch {
+	double x[NodesNb][BatchSize];
+	double y[NodesNb][BatchSize];
+	double z[NodesNb][BatchSize];
+	vtkIdType cellIds[BatchSize];
+	std::size_t size = 0;
+
+	[[nodiscard]] Vec Get(const int node, const std::size_t lane) const {
+		return { x[node][lane], y[node][lane], z[node][lane] };
+	}
+
+	void Add(const vtkIdType cellId, vtkIdList* nodeIds, const double* coords) {
+		for (int node = 0; node < NodesNb; ++node) {
+			const double* point = coords + 3 * nodeIds->GetId(node);
+			x[node][size] = point[0];
+			y[node][size] = point[1];
+			z[node][size] = point[2];
+		}
+		cellIds[size++] = cellId;
+	}
+};
+
+/*
+ * Metric kernels of element types, evaluated for whole batch. Aspect ratio and scaled
+ * Jacobian are 1 for ideal elements, Cosines gives extreme cosines of element angles.
+ */
+
+// Batch kernels of elements whose metrics are computed lane by lane
+template <typename Element>
+struct LaneKernels {
+	template <typename ElementBatch>
+	static void AspectRatio(const ElementBatch& b, double* results) {
+		for (std::size_t l = 0; l < b.size; ++l)
+			results[l] = Element::LaneAspectRatio(b, l);
+	}
+
+	template <typename ElementBatch>
+	static void ScaledJacobian(const ElementBatch& b, double* results) {
+		for (std::size_t l = 0; l < b.size; ++l)
+			results[l] = Element::LaneScaledJacobian(b, l);
+	}
+
+	template <typename ElementBatch>
+	static void Cosines(const ElementBatch& b, double* minCos, double* maxCos) {
+		for (std::size_t l = 0; l < b.size; ++l)
+			Element::LaneCosines(b, l, minCos[l], maxCos[l]);
+	}
+};
+
+struct Tetra : LaneKernels<Tetra> {
+	static constexpr int NodesNb = 4;
+	static constexpr double IdealAngle = 70.528779365509308; // acos(1/3)
+
+	static double LaneAspectRatio(const Batch<NodesNb>& b, const std::size_t l) {
+		const Vec e01 = b.Get(1, l) - b.Get(0, l);
+		const Vec e02 = b.Get(2, l) - b.Get(0, l);
+		const Vec e03 = b.Get(3, l) - b.Get(0, l);
+		const Vec e12 = b.Get(2, l) - b.Get(1, l);
+		const Vec e13 = b.Get(3, l) - b.Get(1, l);
+		const Vec e23 = b.Get(3, l) - b.Get(2, l);
+
+		const double maxEdge2 = std::max(std::max(std::max(Dot(e01, e01), Dot(e02, e02)),
+											 std::max(Dot(e03, e03), Dot(e12, e12))),
+			std::max(Dot(e13, e13), Dot(e23, e23)));
+		const double doubleArea = Length(Cross(e12, e13)) + Length(Cross(e03, e02))
+			+ Length(Cross(e01, e03)) + Length(Cross(e02, e01));
+		const double det = std::abs(Dot(e01, Cross(e02, e03)));
+
+		// Longest edge over inradius, normalized
+		const double ratio = std::sqrt(maxEdge2) * 0.5 * doubleArea * SafeInverse(Sqrt6 * det);
+		return det > Tiny ? std::min(ratio, MaxAspectRatio) : MaxAspectRatio;
+	}
+
+	static double LaneScaledJacobian(const Batch<NodesNb>& b, const std::size_t l) {
+		const Vec e01 = b.Get(1, l) - b.Get(0, l);
+		const Vec e02 = b.Get(2, l) - b.Get(0, l);
+		const Vec e03 = b.Get(3, l) - b.Get(0, l);
+		const double l01 = Length(e01);
+		const double l02 = Length(e02);
+		const double l03 = Length(e03);
+		const double l12 = Length(b.Get(2, l) - b.Get(1, l));
+		const double l13 = Length(b.Get(3, l) - b.Get(1, l));
+		const double l23 = Length(b.Get(3, l) - b.Get(2, l));
+
+		const double lengths = std::max(std::max(l01 * l02 * l03, l01 * l12 * l13),
+			std::max(l02 * l12 * l23, l03 * l13 * l23));
+		const double jacobian = Dot(e01, Cross(e02, e03)) * Sqrt2;
+		return Clamp(jacobian * SafeInverse(lengths));
+	}
+
+	static void LaneCosines(
+		const Batch<NodesNb>& b, const std::size_t l, double& minCos, double& maxCos) {
+		const Vec e01 = b.Get(1, l) - b.Get(0, l);
+		const Vec e02 = b.Get(2, l) - b.Get(0, l);
+		const Vec e03 = b.Get(3, l) - b.Get(0, l);
+		const Vec e12 = b.Get(2, l) - b.Get(1, l);
+		const Vec e13 = b.Get(3, l) - b.Get(1, l);
+
+		// Normals of faces opposite to each node, all outward (or all inward)
+		const Vec n0 = Cross(e12, e13);
+		const Vec n1 = Cross(e03, e02);
+		const Vec n2 = Cross(e01, e03);
+		const Vec n3 = Cross(e02, e01);
+		const double i0 = SafeInverse(Length(n0));
+		const double i1 = SafeInverse(Length(n1));
+		const double i2 = SafeInverse(Length(n2));
+		const double i3 = SafeInverse(Length(n3));
+
+		// Dihedral angle at the edge shared by two faces is acos(-n.m)
+		const double c01 = -Dot(n0, n1) * i0 * i1;
+		const double c02 = -Dot(n0, n2) * i0 * i2;
+		const double c03 = -Dot(n0, n3) * i0 * i3;
+		const double c12 = -Dot(n1, n2) * i1 * i2;
+		const double c13 = -Dot(n1, n3) * i1 * i3;
+		const double c23 = -Dot(n2, n3) * i2 * i3;
+		minCos = std::min(std::min(std::min(c01, c02), std::min(c03, c12)), std::min(c13, c23));
+		maxCos = std::max(std::max(std::max(c01, c02), std::max(c03, c12)), std::max(c13, c23));
+	}
+};
+
+struct Hexa {
+	static constexpr int NodesNb = 8;
+	static constexpr double IdealAngle = 90.0;
+
+	static constexpr int Edges[12][2] = { { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 }, { 4, 5 },
+		{ 5, 6 }, { 6, 7 }, { 7, 4 }, { 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 } };
+
+	// Neighbours of each node, in right-handed order
+	static constexpr int Corners[8][4] = { { 0, 1, 3, 4 }, { 1, 2, 0, 5 }, { 2, 3, 1, 6 },
+		{ 3, 0, 2, 7 }, { 4, 7, 5, 0 }, { 5, 4, 6, 1 }, { 6, 5, 7, 2 }, { 7, 6, 4, 3 } };
+
+	// Faces with outward normals, as in vtkHexahedron
+	static constexpr int Faces[6][4] = { { 0, 4, 7, 3 }, { 1, 2, 6, 5 }, { 0, 1, 5, 4 },
+		{ 3, 7, 6, 2 }, { 0, 3, 2, 1 }, { 4, 5, 6, 7 } };
+
+	// Faces sharing each edge
+	static constexpr int AdjacentFaces[12][2] = { { 0, 2 }, { 0, 3 }, { 0, 4 }, { 0, 5 },
+		{ 1, 2 }, { 1, 3 }, { 1, 4 }, { 1, 5 }, { 2, 4 }, { 2, 5 }, { 3, 4 }, { 3, 5 } };
+
+	// Loops over edges, corners and faces enclose loops over lanes, which are vectorized
+
+	static void AspectRatio(const Batch<NodesNb>& b, double* results) {
+		double minEdge2[BatchSize];
+		double maxEdge2[BatchSize];
+		std::fill_n(minEdge2, b.size, std::numeric_limits<double>::max());
+		std::fill_n(maxEdge2, b.size, 0.0);
+		for (const auto& [first, second] : Edges) {
+			for (std::size_t l = 0; l < b.size; ++l) {
+				const Vec edge = b.Get(second, l) - b.Get(first, l);
+				minEdge2[l] = std::min(minEdge2[l], Dot(edge, edge));
+				maxEdge2[l] = std::max(maxEdge2[l], Dot(edge, edge));
+			}
+		}
+		for (std::size_t l = 0; l < b.size; ++l) {
+			const double ratio = std::sqrt(maxEdge2[l] * SafeInverse(minEdge2[l]));
+			results[l] = minEdge2[l] > Tiny ? std::min(ratio, MaxAspectRatio) : MaxAspectRatio;
+		}
+	}
+
+	static void ScaledJacobian(const Batch<NodesNb>& b, double* results) {
+		std::fill_n(results, b.size, 1.0);
+		for (const auto& [node, first, second, third] : Corners) {
+			for (std::size_t l = 0; l < b.size; ++l) {
+				const Vec e1 = b.Get(first, l) - b.Get(node, l);
+				const Vec e2 = b.Get(second, l) - b.Get(node, l);
+				const Vec e3 = b.Get(third, l) - b.Get(node, l);
+				const double lengths = Length(e1) * Length(e2) * Length(e3);
+				results[l] = std::min(results[l], Dot(e1, Cross(e2, e3)) * SafeInverse(lengths));
+			}
+		}
+		for (std::size_t l = 0; l < b.size; ++l)
+			results[l] = std::max(results[l], -1.0);
+	}
+
+	static void Cosines(const Batch<NodesNb>& b, double* minCos, double* maxCos) {
+		// Unit normals of faces
+		double nx[6][BatchSize];
+		double ny[6][BatchSize];
+		double nz[6][BatchSize];
+		for (int f = 0; f < 6; ++f) {
+			const auto& [n0, n1, n2, n3] = Faces[f];
+			for (std::size_t l = 0; l < b.size; ++l) {
+				const Vec normal
+					= Cross(b.Get(n2, l) - b.Get(n0, l), b.Get(n3, l) - b.Get(n1, l));
+				const double inverse = SafeInverse(Length(normal));
+				nx[f][l] = normal.x * inverse;
+				ny[f][l] = normal.y * inverse;
+				nz[f][l] = normal.z * inverse;
+			}
+		}
+
+		std::fill_n(minCos, b.size, 1.0);
+		std::fill_n(maxCos, b.size, -1.0);
+		for (const auto& [f, g] : AdjacentFaces) {
+			for (std::size_t l = 0; l < b.size; ++l) {
+				const double cos = -(nx[f][l] * nx[g][l] + ny[f][l] * ny[g][l] + nz[f][l] * nz[g][l]);
+				minCos[l] = std::min(minCos[l], cos);
+				maxCos[l] = std::max(maxCos[l], cos);
+			}
+		}
+	}
+};
+
+struct Triangle : LaneKernels<Triangle> {
+	static constexpr int NodesNb = 3;
+	static constexpr double IdealAngle = 60.0;
+
+	static double LaneAspectRatio(const Batch<NodesNb>& b, const std::size_t l) {
+		const Vec e01 = b.Get(1, l) - b.Get(0, l);
+		const Vec e02 = b.Get(2, l) - b.Get(0, l);
+		const double l01 = Length(e01);
+		const double l02 = Length(e02);
+		const double l12 = Length(b.Get(2, l) - b.Get(1, l));
+		const double doubleArea = Length(Cross(e01, e02));
+
+		// Longest edge over inradius, normalized
+		const double ratio = std::max(std::max(l01, l02), l12) * (l01 + l02 + l12)
+			* SafeInverse(2.0 * Sqrt3 * doubleArea);
+		return doubleArea > Tiny ? std::min(ratio, MaxAspectRatio) : MaxAspectRatio;
+	}
+
+	static double LaneScaledJacobian(const Batch<NodesNb>& b, const std::size_t l) {
+		const Vec e01 = b.Get(1, l) - b.Get(0, l);
+		const Vec e02 = b.Get(2, l) - b.Get(0, l);
+		const double l01 = Length(e01);
+		const double l02 = Length(e02);
+		const double l12 = Length(b.Get(2, l) - b.Get(1, l));
+		const double lengths = std::max(std::max(l01 * l02, l01 * l12), l02 * l12);
+		return Length(Cross(e01, e02)) * 2.0 / Sqrt3 * SafeInverse(lengths);
+	}
+
+	static void LaneCosines(
+		const Batch<NodesNb>& b, const std::size_t l, double& minCos, double& maxCos) {
+		const Vec e01 = b.Get(1, l) - b.Get(0, l);
+		const Vec e02 = b.Get(2, l) - b.Get(0, l);
+		const Vec e12 = b.Get(2, l) - b.Get(1, l);
+		const double i01 = SafeInverse(Length(e01));
+		const double i02 = SafeInverse(Length(e02));
+		const double i12 = SafeInverse(Length(e12));
+
+		const double c0 = Dot(e01, e02) * i01 * i02;
+		const double c1 = -Dot(e01, e12) * i01 * i12;
+		const double c2 = Dot(e02, e12) * i02 * i12;
+		minCos = std::min(std::min(c0, c1), c2);
+		maxCos = std::max(std::max(c0, c1), c2);
+	}
+};
+
+struct Quad : LaneKernels<Quad> {
+	static constexpr int NodesNb = 4;
+	static constexpr double IdealAngle = 90.0;
+
+	static double LaneAspectRatio(const Batch<NodesNb>& b, const std::size_t l) {
+		double minEdge2 = std::numeric_limits<double>::max();
+		double maxEdge2 = 0.0;
+		for (int i = 0; i < 4; ++i) {
+			const Vec edge = b.Get((i + 1) % 4, l) - b.Get(i, l);
+			minEdge2 = std::min(minEdge2, Dot(edge, edge));
+			maxEdge2 = std::max(maxEdge2, Dot(edge, edge));
+		}
+		const double ratio = std::sqrt(maxEdge2 * SafeInverse(minEdge2));
+		return minEdge2 > Tiny ? std::min(ratio, MaxAspectRatio) : MaxAspectRatio;
+	}
+
+	static double LaneScaledJacobian(const Batch<NodesNb>& b, const std::size_t l) {
+		const Vec normal = Cross(b.Get(2, l) - b.Get(0, l), b.Get(3, l) - b.Get(1, l));
+		const double inverse = SafeInverse(Length(normal));
+
+		double minJacobian = 1.0;
+		for (int i = 0; i < 4; ++i) {
+			const Vec e1 = b.Get((i + 1) % 4, l) - b.Get(i, l);
+			const Vec e2 = b.Get((i + 3) % 4, l) - b.Get(i, l);
+			const double jacobian = Dot(Cross(e1, e2), normal) * inverse
+				* SafeInverse(Length(e1) * Length(e2));
+			minJacobian = std::min(minJacobian, jacobian);
+		}
+		return std::max(minJacobian, -1.0);
+	}
+
+	static void LaneCosines(
+		const Batch<NodesNb>& b, const std::size_t l, double& minCos, double& maxCos) {
+		minCos = 1.0;
+		maxCos = -1.0;
+		for (int i = 0; i < 4; ++i) {
+			const Vec e1 = b.Get((i + 1) % 4, l) - b.Get(i, l);
+			const Vec e2 = b.Get((i + 3) % 4, l) - b.Get(i, l);
+			const double cos = Dot(e1, e2) * SafeInverse(Length(e1) * Length(e2));
+			minCos = std::min(minCos, cos);
+			maxCos = std::max(maxCos, cos);
+		}
+	}
+};
+
+double ToDegrees(const double cos) {
+	return std::acos(std::clamp(cos, -1.0, 1.0)) * 180.0 / std::numbers::pi;
+}
+
+double GetAngleMetric(
+	const Metric metric, const double minCos, const double maxCos, const double idealAngle) {
+	switch (metric) {
+	case Metric::MinDihedralAngle:
+		return ToDegrees(maxCos);
+	case Metric::MaxDihedralAngle:
+		return ToDegrees(minCos);
+	default: {
+		const double minAngle = ToDegrees(maxCos);
+		const double maxAngle = ToDegrees(minCos);
+		return std::max(
+			(maxAngle - idealAngle) / (180.0 - idealAngle), (idealAngle - minAngle) / idealAngle);
+	}
+	}
+}
+
+template <typename Element>
+void EvaluateBatch(const Batch<Element::NodesNb>& batch, const Metric metric, float* values) {
+	const std::size_t size = batch.size;
+	double results[BatchSize];
+
+	switch (metric) {
+	case Metric::AspectRatio:
+		Element::AspectRatio(batch, results);
+		break;
+	case Metric::ScaledJacobian:
+		Element::ScaledJacobian(batch, results);
+		break;
+	default: {
+		// Cosines are vectorized, arc cosines are not
+		double minCos[BatchSize];
+		double maxCos[BatchSize];
+		Element::Cosines(batch, minCos, maxCos);
+		for (std::size_t l = 0; l < size; ++l)
+			results[l] = GetAngleMetric(metric, minCos[l], maxCos[l], Element::IdealAngle);
+	}
+	}
+
+	for (std::size_t l = 0; l < size; ++l)
+		values[batch.cellIds[l]] = static_cast<float>(results[l]);
+}
+
+template <typename Element>
+void AddToBatch(Batch<Element::NodesNb>& batch, const vtkIdType cellId, vtkIdList* nodeIds,
+	const double* coords, const Metric metric, float* values) {
+	batch.Add(cellId, nodeIds, coords);
+	if (batch.size == BatchSize) {
+		EvaluateBatch<Element>(batch, metric, values);
+		batch.size = 0;
+	}
+}
+
+template <typename Element>
+void FlushBatch(Batch<Element::NodesNb>& batch, const Metric metric, float* values) {
+	if (batch.size > 0)
+		EvaluateBatch<Element>(batch, metric, values);
+	batch.size = 0;
+}
+
+struct Batches {
+	Batch<Tetra::NodesNb> tetras;
+	Batch<Hexa::NodesNb> hexas;
+	Batch<Triangle::NodesNb> triangles;
+	Batch<Quad::NodesNb> quads;
+};
+
+// Boundary block holds polygons only, without types array, their type follows from size
+int GetCellType(vtkUnsignedCharArray* types, const vtkIdType cellId, const vtkIdType nodesNb) {
+	if (types)
+		return types->GetValue(cellId);
+	switch (nodesNb) {
+	case 3:
+		return VTK_TRIANGLE;
+	case 4:
+		return VTK_QUAD;
+	default:
+		return VTK_POLYGON;
+	}
+}
+
+void EvaluateCells(vtkCellArray* cells, vtkUnsignedCharArray* types, const double* coords,
+	const Metric metric, float* values) {
+	vtkSMPThreadLocalObject<vtkIdList> localNodeIds;
+	vtkSMPTools::For(0, cells->GetNumberOfCells(), [&](const vtkIdType begin, const vtkIdType end) {
+		vtkIdList* nodeIds = localNodeIds.Local();
+		const auto batches = std::make_unique<Batches>();
+
+		for (vtkIdType cellId = begin; cellId < end; ++cellId) {
+			cells->GetCellAtId(cellId, nodeIds);
+			const vtkIdType nodesNb = nodeIds->GetNumberOfIds();
+			const int type = GetCellType(types, cellId, nodesNb);
+
+			if (type == VTK_TETRA && nodesNb == Tetra::NodesNb) {
+				AddToBatch<Tetra>(batches->tetras, cellId, nodeIds, coords, metric, values);
+			} else if (type == VTK_HEXAHEDRON && nodesNb == Hexa::NodesNb) {
+				AddToBatch<Hexa>(batches->hexas, cellId, nodeIds, coords, metric, values);
+			} else if (type == VTK_TRIANGLE && nodesNb == Triangle::NodesNb) {
+				AddToBatch<Triangle>(batches->triangles, cellId, nodeIds, coords, metric, values);
+			} else if (type == VTK_QUAD && nodesNb == Quad::NodesNb) {
+				AddToBatch<Quad>(batches->quads, cellId, nodeIds, coords, metric, values);
+			} else {
+				values[cellId] = std::numeric_limits<float>::quiet_NaN();
+			}
+		}
+
+		FlushBatch<Tetra>(batches->tetras, metric, values);
+		FlushBatch<Hexa>(batches->hexas, metric, values);
+		FlushBatch<Triangle>(batches->triangles, metric, values);
+		FlushBatch<Quad>(batches->quads, metric, values);
+	});
+}
+
+// Coordinates of points as contiguous doubles, copied only if stored in other type
+const double* GetCoordinates(vtkPoints* points, std::vector<double>& copy) {
+	if (vtkDoubleArray* data = vtkDoubleArray::FastDownCast(points->GetData()))
+		return data->GetPointer(0);
+
+	const vtkIdType pointsNb = points->GetNumberOfPoints();
+	copy.resize(3 * pointsNb);
+	vtkSMPTools::For(0, pointsNb, [&](const vtkIdType begin, const vtkIdType end) {
+		for (vtkIdType i = begin; i < end; ++i)
+			points->GetPoint(i, copy.data() + 3 * i);
+	});
+	return copy.data();
+}
+
+struct Accumulator {
+	double min = std::numeric_limits<double>::max();
+	double max = std::numeric_limits<double>::lowest();
+	double sum = 0.0;
+	vtkIdType count = 0;
+	vtkIdType degeneratedNb = 0;
+	// Heap with the least bad of the worst elements on top
+	std::vector<std::pair<vtkIdType, double>> worstElements;
+};
+
+Report CreateReport(const float* values, const vtkIdType valuesNb, const Metric metric,
+	const int binsNb, const int worstNb) {
+	const auto isLessBad = [metric](const std::pair<vtkIdType, double>& a,
+							   const std::pair<vtkIdType, double>& b) {
+		return MGTMesh_Quality::IsWorse(metric, a.second, b.second);
+	};
+
+	vtkSMPThreadLocal<Accumulator> localAccumulators;
+	vtkSMPTools::For(0, valuesNb, [&](const vtkIdType begin, const vtkIdType end) {
+		Accumulator& accumulator = localAccumulators.Local();
+		for (vtkIdType i = begin; i < end; ++i) {
+			const double value = values[i];
+			if (!std::isfinite(value))
+				continue;
+
+			accumulator.min = std::min(accumulator.min, value);
+			accumulator.max = std::max(accumulator.max, value);
+			++accumulator.count;
+			if (metric == Metric::AspectRatio && value >= MaxAspectRatio)
+				++accumulator.degeneratedNb;
+			else
+				accumulator.sum += value;
+
+			std::vector<std::pair<vtkIdType, double>>& worst = accumulator.worstElements;
+			if (static_cast<int>(worst.size()) < worstNb) {
+				worst.emplace_back(i, value);
+				std::ranges::push_heap(worst, isLessBad);
+			} else if (!worst.empty()
+				&& MGTMesh_Quality::IsWorse(metric, value, worst.front().second)) {
+				std::ranges::pop_heap(worst, isLessBad);
+				worst.back() = { i, value };
+				std::ranges::push_heap(worst, isLessBad);
+			}
+		}
+	});
+
+	Report report;
+	double sum = 0.0;
+	report.min = std::numeric_limits<double>::max();
+	report.max = std::numeric_limits<double>::lowest();
+	for (const Accumulator& accumulator : localAccumulators) {
+		if (accumulator.count == 0)
+			continue;
+		report.min = std::min(report.min, accumulator.min);
+		report.max = std::max(report.max, accumulator.max);
+		sum += accumulator.sum;
+		report.elementsNb += accumulator.count;
+		report.degeneratedNb += accumulator.degeneratedNb;
+		report.worstElements.insert(report.worstElements.end(),
+			accumulator.worstElements.begin(), accumulator.worstElements.end());
+	}
+	if (report.elementsNb == 0)
+		return {};
+
+	// Aspect ratio sentinels of degenerated elements would swamp the mean
+	const vtkIdType regularNb = report.elementsNb - report.degeneratedNb;
+	report.mean = regularNb > 0 ? sum / static_cast<double>(regularNb) : report.max;
+	std::ranges::sort(report.worstElements, isLessBad);
+	if (static_cast<int>(report.worstElements.size()) > worstNb)
+		report.worstElements.resize(worstNb);
+
+	Histogram& histogram = report.histogram;
+	histogram.min = report.min;
+	histogram.max = metric == Metric::AspectRatio
+		? std::max(std::min(report.max, MaxHistogramAspectRatio), report.min)
+		: report.max;
+	histogram.counts.assign(std::max(binsNb, 1), 0);
+	const double range = histogram.max - histogram.min;
+	const double scale = range > 0.0 ? static_cast<double>(binsNb) / range : 0.0;
+
+	vtkSMPThreadLocal<std::vector<vtkIdType>> localCounts(histogram.counts);
+	vtkSMPTools::For(0, valuesNb, [&](const vtkIdType begin, const vtkIdType end) {
+		std::vector<vtkIdType>& counts = localCounts.Local();
+		const auto lastBin = static_cast<double>(counts.size() - 1);
+		for (vtkIdType i = begin; i < end; ++i) {
+			if (std::isfinite(values[i])) {
+				// Clamped before the cast, sentinels lie far beyond the histogram range
+				const double bin = std::clamp((values[i] - histogram.min) * scale, 0.0, lastBin);
+				++counts[static_cast<std::size_t>(bin)];
+			}
+		}
+	});
+	for (const std::vector<vtkIdType>& counts : localCounts) {
+		for (std::size_t bin = 0; bin < counts.size(); ++bin)
+			histogram.counts[bin] += counts[bin];
+	}
+	return report;
+}
+
+Report EvaluateBlock(vtkCellArray* cells, vtkUnsignedCharArray* types, vtkPoints* points,
+	vtkCellData* cellData, const Metric metric, const int binsNb, const int worstNb) {
+	const vtkIdType cellsNb = cells ? cells->GetNumberOfCells() : 0;
+	if (cellsNb == 0 || !points)
+		return {};
+
+	auto values = vtkSmartPointer<vtkFloatArray>::New();
+	values->SetName(MGTMesh_Quality::GetArrayName(metric).c_str());
+	values->SetNumberOfValues(cellsNb);
+
+	std::vector<double> coordsCopy;
+	const double* coords = GetCoordinates(points, coordsCopy);
+	EvaluateCells(cells, types, coords, metric, values->GetPointer(0));
+	cellData->AddArray(values);
+
+	return CreateReport(values->GetPointer(0), cellsNb, metric, binsNb, worstNb);
+}
+
+}
+
+//----------------------------------------------------------------------------
+MGTMesh_Quality::MGTMesh_Quality(const Metric metric)
+	: _metric(metric)
+	, _binsNb(10)
+	, _worstNb(10) { }
+
+//----------------------------------------------------------------------------
+bool MGTMesh_Quality::Evaluate(MGTMesh_MeshObject* mesh) {
+	_internalReport = {};
+	_boundaryReport = {};
+	if (!mesh || mesh->IsEmpty())
+		return false;
+
+	if (const vtkSmartPointer<vtkUnstructuredGrid> grid = mesh->GetInternalMesh()) {
+		_internalReport = EvaluateBlock(grid->GetCells(), grid->GetCellTypesArray(),
+			grid->GetPoints(), grid->GetCellData(), _metric, _binsNb, _worstNb);
+	}
+	if (const vtkSmartPointer<vtkPolyData> boundary = mesh->GetBoundaryMesh()) {
+		_boundaryReport = EvaluateBlock(boundary->GetPolys(), nullptr, boundary->GetPoints(),
+			boundary->GetCellData(), _metric, _binsNb, _worstNb);
+	}
+	return _internalReport.elementsNb > 0 || _boundaryReport.elementsNb > 0;
+}
+
+//----------------------------------------------------------------------------
+std::string MGTMesh_Quality::GetMetricName(const Metric metric) {
+	switch (metric) {
+	case Metric::AspectRatio:
+		return "AspectRatio";
+	case Metric::ScaledJacobian:
+		return "ScaledJacobian";
+	case Metric::MinDihedralAngle:
+		return "MinDihedralAngle";
+	case Metric::MaxDihedralAngle:
+		return "MaxDihedralAngle";
+	case Metric::Skewness:
+		return "Skewness";
+	}
+	return {};
+}
+
+//----------------------------------------------------------------------------
+std::string MGTMesh_Quality::GetArrayName(const Metric metric) {
+	return "Quality" + GetMetricName(metric);
+}
+
+//----------------------------------------------------------------------------
+bool MGTMesh_Quality::IsWorse(const Metric metric, const double a, const double b) {
+	switch (metric) {
+	case Metric::ScaledJacobian:
+	case Metric::MinDihedralAngle:
+		return a < b;
+	default:
+		return a > b;
+	}
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_Quality.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef MGTMESH_QUALITY_HPP
+#define MGTMESH_QUALITY_HPP
+
+#include <vtkType.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+class MGTMesh_MeshObject;
+
+/**
+ * Evaluates quality metric of elements of internal (tetrahedra, hexahedra) and
+ * boundary (triangles, quads) blocks of the mesh. Elements are gathered in batches
+ * with coordinates stored as structure of arrays, metric kernels loop over batch
+ * lanes so that compiler vectorizes them; batches are evaluated in parallel.
+ * Metric values are attached to blocks as "Quality<Metric>" cell array, elements of
+ * other types get NaN and are skipped in reports.
+ */
+class MGTMesh_Quality {
+public:
+	// Dihedral angles are evaluated for volume elements and interior angles for surface
+	// elements, in degrees. Skewness is the equiangle skewness computed from them.
+	enum class Metric { AspectRatio, ScaledJacobian, MinDihedralAngle, MaxDihedralAngle, Skewness };
+
+	// Bins split [min, max] range evenly, aspect ratios above 100 fall into the last bin
+	struct Histogram {
+		double min = 0.0;
+		double max = 0.0;
+		std::vector<vtkIdType> counts;
+	};
+
+	struct Report {
+		vtkIdType elementsNb = 0;
+		// Elements with aspect ratio sentinel, counted in histogram but not in the mean
+		vtkIdType degeneratedNb = 0;
+		double min = 0.0;
+		double max = 0.0;
+		double mean = 0.0;
+		Histogram histogram;
+		// Element IDs with their values, the worst one first
+		std::vector<std::pair<vtkIdType, double>> worstElements;
+	};
+
+	explicit MGTMesh_Quality(Metric metric);
+
+	void SetBinsNumber(int binsNb) { _binsNb = binsNb; }
+	void SetWorstElementsNumber(int worstNb) { _worstNb = worstNb; }
+
+	// Returns false if mesh has no elements
+	bool Evaluate(MGTMesh_MeshObject* mesh);
+
+	[[nodiscard]] const Report& GetInternalReport() const { return _internalReport; }
+	[[nodiscard]] const Report& GetBoundaryReport() const { return _boundaryReport; }
+
+	[[nodiscard]] static std::string GetMetricName(Metric metric);
+	[[nodiscard]] static std::string GetArrayName(Metric metric);
+
+	// True if value a means worse element than value b
+	[[nodiscard]] static bool IsWorse(Metric metric, double a, double b);
+
+private:
+	Metric _metric;
+	int _binsNb;
+	int _worstNb;
+	Report _internalReport;
+	Report _boundaryReport;
+};
+
+#endif
@@ -0,0 +1,500 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_Refiner.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "MGTMesh_Refiner.hpp"
+#include "MGTMesh_MeshData.hpp"
+#include "MGTMesh_MeshObject.hpp"
+
+#include <vtkCellType.h>
+#include <vtkSMPTools.h>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using Dimension = MGTMesh_MeshData::Dimension;
+using Edge = std::array<std::int32_t, 2>;
+
+// Local edges of tetrahedron, midpoint of edge i is local node 4 + i and the
+// opposite edge is 5 - i
+constexpr std::array<Edge, 6> TetraEdges { { { 0, 1 }, { 0, 2 }, { 0, 3 }, { 1, 2 },
+	{ 1, 3 }, { 2, 3 } } };
+
+// Edges of tetrahedron faces, face i is opposite to node i
+constexpr std::array<std::array<int, 3>, 4> TetraFaceEdges { { { 3, 4, 5 }, { 1, 2, 5 },
+	{ 0, 2, 4 }, { 0, 1, 3 } } };
+
+// Local edges of triangle, midpoint of edge i is local node 3 + i
+constexpr std::array<Edge, 3> TriangleEdges { { { 0, 1 }, { 1, 2 }, { 2, 0 } } };
+
+// Projections alternating between two faces to move midpoint onto their common edge
+constexpr int AlternatingProjectionsNb = 3;
+
+// Unique edges of simplices, each element stores indices of its edges
+struct Edges {
+	std::vector<Edge> nodes;
+	std::vector<std::int32_t> tetraEdges;
+	std::vector<std::int32_t> triangleEdges;
+	std::vector<char> isSplit;
+	// Face IDs of surface triangles sharing the edge, -1 if there are more than two
+	std::vector<std::array<int, 2>> faceIds;
+
+	[[nodiscard]] int GetTetraMask(const vtkIdType tetra) const {
+		int mask = 0;
+		for (int i = 0; i < 6; ++i)
+			mask |= isSplit[tetraEdges[6 * tetra + i]] << i;
+		return mask;
+	}
+
+	[[nodiscard]] int GetTriangleMask(const vtkIdType triangle) const {
+		int mask = 0;
+		for (int i = 0; i < 3; ++i)
+			mask |= isSplit[triangleEdges[3 * triangle + i]] << i;
+		return mask;
+	}
+};
+
+// New elements with tags of their parents, counted per block of parents
+struct Children {
+	std::vector<std::int32_t> connectivity;
+	std::vector<std::int32_t> tags;
+	std::vector<vtkIdType> blockSizes;
+	// Sign of parent volume, children keep its orientation
+	std::vector<signed char> orientations;
+};
+
+double GetVolume(const std::span<const double> coords, const std::int32_t* nodes) {
+	const double* p0 = coords.data() + 3 * static_cast<std::size_t>(nodes[0]);
+	std::array<std::array<double, 3>, 3> e {};
+	for (int i = 0; i < 3; ++i) {
+		const double* p = coords.data() + 3 * static_cast<std::size_t>(nodes[i + 1]);
+		for (int k = 0; k < 3; ++k)
+			e[i][k] = p[k] - p0[k];
+	}
+	return e[2][0] * (e[0][1] * e[1][2] - e[0][2] * e[1][1])
+		+ e[2][1] * (e[0][2] * e[1][0] - e[0][0] * e[1][2])
+		+ e[2][2] * (e[0][0] * e[1][1] - e[0][1] * e[1][0]);
+}
+
+Edges CollectEdges(const MGTMesh_MeshData* meshData) {
+	Edges edges;
+	std::unordered_map<std::uint64_t, std::int32_t> edgeIds;
+	edgeIds.reserve(static_cast<std::size_t>(meshData->GetNumberOfNodes()) * 7);
+	const auto getEdge = [&](std::int32_t a, std::int32_t b) {
+		if (a > b)
+			std::swap(a, b);
+		const std::uint64_t key
+			= (static_cast<std::uint64_t>(a) << 32) | static_cast<std::uint32_t>(b);
+		const auto [it, isInserted]
+			= edgeIds.try_emplace(key, static_cast<std::int32_t>(edges.nodes.size()));
+		if (isInserted)
+			edges.nodes.push_back({ a, b });
+		return it->second;
+	};
+
+	const std::span<const std::int32_t> tetra = meshData->GetConnectivity(Dimension::Volume);
+	edges.tetraEdges.resize(tetra.size() / 4 * 6);
+	for (std::size_t i = 0; i < tetra.size() / 4; ++i) {
+		for (int j = 0; j < 6; ++j) {
+			edges.tetraEdges[6 * i + j]
+				= getEdge(tetra[4 * i + TetraEdges[j][0]], tetra[4 * i + TetraEdges[j][1]]);
+		}
+	}
+
+	const std::span<const std::int32_t> triangles = meshData->GetConnectivity(Dimension::Surface);
+	edges.triangleEdges.resize(triangles.size());
+	for (std::size_t i = 0; i < triangles.size() / 3; ++i) {
+		for (int j = 0; j < 3; ++j) {
+			edges.triangleEdges[3 * i + j] = getEdge(
+				triangles[3 * i + TriangleEdges[j][0]], triangles[3 * i + TriangleEdges[j][1]]);
+		}
+	}
+
+	edges.isSplit.assign(edges.nodes.size(), 0);
+	edges.faceIds.assign(edges.nodes.size(), { 0, 0 });
+	const std::span<const std::int32_t> faceIds = meshData->GetTags(Dimension::Surface);
+	for (std::size_t i = 0; i < faceIds.size(); ++i) {
+		const int faceId = faceIds[i];
+		for (int j = 0; j < 3 && faceId > 0; ++j) {
+			std::array<int, 2>& edgeFaces = edges.faceIds[edges.triangleEdges[3 * i + j]];
+			if (edgeFaces[0] == 0)
+				edgeFaces[0] = faceId;
+			else if (edgeFaces[0] != faceId && edgeFaces[1] == 0)
+				edgeFaces[1] = faceId;
+			else if (edgeFaces[0] != faceId && edgeFaces[1] != faceId)
+				edgeFaces[0] = -1;
+		}
+	}
+	return edges;
+}
+
+// Face of tetrahedron with exactly its edges split, -1 if there is no such face
+int FindSplitFace(const int mask) {
+	for (int face = 0; face < 4; ++face) {
+		const std::array<int, 3>& faceEdges = TetraFaceEdges[face];
+		if (mask == ((1 << faceEdges[0]) | (1 << faceEdges[1]) | (1 << faceEdges[2])))
+			return face;
+	}
+	return -1;
+}
+
+// Tetrahedron can be split if no edge, one edge, edges of one face or all edges are split
+bool IsSplittable(const int mask) {
+	switch (std::popcount(static_cast<unsigned>(mask))) {
+	case 0:
+	case 1:
+	case 6:
+		return true;
+	case 3:
+		return FindSplitFace(mask) >= 0;
+	default:
+		return false;
+	}
+}
+
+// Splits all edges of elements which cannot be closed by their split edges, returns number
+// of additionally refined elements
+vtkIdType CloseRefinement(Edges& edges) {
+	const auto tetraNb = static_cast<vtkIdType>(edges.tetraEdges.size() / 6);
+	const auto trianglesNb = static_cast<vtkIdType>(edges.triangleEdges.size() / 3);
+	vtkIdType refinedNb = 0;
+	bool isChanged = true;
+	while (isChanged) {
+		isChanged = false;
+		for (vtkIdType tetra = 0; tetra < tetraNb; ++tetra) {
+			const int mask = edges.GetTetraMask(tetra);
+			if (IsSplittable(mask))
+				continue;
+			for (int i = 0; i < 6; ++i)
+				edges.isSplit[edges.tetraEdges[6 * tetra + i]] = 1;
+			isChanged = true;
+			++refinedNb;
+		}
+		for (vtkIdType triangle = 0; triangle < trianglesNb; ++triangle) {
+			if (std::popcount(static_cast<unsigned>(edges.GetTriangleMask(triangle))) != 2)
+				continue;
+			for (int i = 0; i < 3; ++i)
+				edges.isSplit[edges.triangleEdges[3 * triangle + i]] = 1;
+			isChanged = true;
+			++refinedNb;
+		}
+	}
+	return refinedNb;
+}
+
+// Local node of tetrahedron midpoint between two of its nodes
+int GetTetraMidpoint(const int a, const int b) {
+	const auto edge = std::ranges::find_if(TetraEdges, [a, b](const Edge& e) {
+		return (e[0] == a && e[1] == b) || (e[0] == b && e[1] == a);
+	});
+	return 4 + static_cast<int>(edge - TetraEdges.begin());
+}
+
+double GetSquaredDistance(
+	const std::span<const double> coords, const std::int32_t a, const std::int32_t b) {
+	double distance = 0.0;
+	for (int k = 0; k < 3; ++k) {
+		const double d = coords[3 * static_cast<std::size_t>(a) + k]
+			- coords[3 * static_cast<std::size_t>(b) + k];
+		distance += d * d;
+	}
+	return distance;
+}
+
+void SplitTetra(const std::array<std::int32_t, 10>& nodes, const int mask,
+	const std::span<const double> coords, const std::int32_t tag, Children& children) {
+	const double volume = GetVolume(coords, nodes.data());
+	const auto add = [&](const int a, const int b, const int c, const int d) {
+		std::array<std::int32_t, 4> child { nodes[a], nodes[b], nodes[c], nodes[d] };
+		if (GetVolume(coords, child.data()) * volume < 0.0)
+			std::swap(child[2], child[3]);
+		children.connectivity.insert(children.connectivity.end(), child.begin(), child.end());
+		children.tags.push_back(tag);
+		children.orientations.push_back(volume < 0.0 ? -1 : 1);
+	};
+
+	const int splitNb = std::popcount(static_cast<unsigned>(mask));
+	if (splitNb == 0) {
+		add(0, 1, 2, 3);
+	} else if (splitNb == 1) {
+		// Bisection by the midpoint of the split edge
+		const int edge = std::countr_zero(static_cast<unsigned>(mask));
+		const auto [i, j] = TetraEdges[edge];
+		const auto [k, l] = TetraEdges[5 - edge];
+		add(i, 4 + edge, k, l);
+		add(4 + edge, j, k, l);
+	} else if (splitNb == 3) {
+		// Refined face connected to the opposite node
+		const int apex = FindSplitFace(mask);
+		std::array<int, 3> face {};
+		for (int i = 0, j = 0; i < 4; ++i) {
+			if (i != apex)
+				face[j++] = i;
+		}
+		const int m01 = GetTetraMidpoint(face[0], face[1]);
+		const int m12 = GetTetraMidpoint(face[1], face[2]);
+		const int m20 = GetTetraMidpoint(face[2], face[0]);
+		add(face[0], m01, m20, apex);
+		add(m01, face[1], m12, apex);
+		add(m20, m12, face[2], apex);
+		add(m01, m12, m20, apex);
+	} else {
+		// Corners and octahedron split along its shortest diagonal
+		add(0, 4, 5, 6);
+		add(4, 1, 7, 8);
+		add(5, 7, 2, 9);
+		add(6, 8, 9, 3);
+
+		int diagonal = 0;
+		for (int i = 1; i < 3; ++i) {
+			if (GetSquaredDistance(coords, nodes[4 + i], nodes[9 - i])
+				< GetSquaredDistance(coords, nodes[4 + diagonal], nodes[9 - diagonal]))
+				diagonal = i;
+		}
+		const int p = (diagonal + 1) % 3;
+		const int q = (diagonal + 2) % 3;
+		const std::array<int, 4> cycle { 4 + p, 4 + q, 9 - p, 9 - q };
+		for (int i = 0; i < 4; ++i)
+			add(4 + diagonal, 9 - diagonal, cycle[i], cycle[(i + 1) % 4]);
+	}
+}
+
+void SplitTriangle(const std::array<std::int32_t, 6>& nodes, const int mask,
+	const std::int32_t tag, Children& children) {
+	const auto add = [&](const int a, const int b, const int c) {
+		children.connectivity.insert(children.connectivity.end(), { nodes[a], nodes[b], nodes[c] });
+		children.tags.push_back(tag);
+	};
+
+	const int splitNb = std::popcount(static_cast<unsigned>(mask));
+	if (splitNb == 0) {
+		add(0, 1, 2);
+	} else if (splitNb == 1) {
+		const int edge = std::countr_zero(static_cast<unsigned>(mask));
+		add(edge, 3 + edge, (edge + 2) % 3);
+		add(3 + edge, (edge + 1) % 3, (edge + 2) % 3);
+	} else {
+		add(0, 3, 5);
+		add(3, 1, 4);
+		add(5, 4, 2);
+		add(3, 4, 5);
+	}
+}
+
+// Moves midpoint onto faces of its edge, false if it stays on the straight edge
+bool ProjectMidpoint(const MGTMesh_Refiner::Projection& projection,
+	const std::array<int, 2>& faceIds, double* point) {
+	if (faceIds[0] <= 0)
+		return false;
+
+	std::array<double, 3> projected { point[0], point[1], point[2] };
+	const int passesNb = faceIds[1] > 0 ? AlternatingProjectionsNb : 1;
+	for (int pass = 0; pass < passesNb; ++pass) {
+		for (const int faceId : faceIds) {
+			if (faceId > 0 && !projection(faceId, projected.data()))
+				return false;
+		}
+	}
+	std::ranges::copy(projected, point);
+	return true;
+}
+
+}
+
+//----------------------------------------------------------------------------
+bool MGTMesh_Refiner::Refine(MGTMesh_MeshObject* mesh) {
+	const vtkSmartPointer<MGTMesh_MeshData> meshData = mesh ? mesh->GetMeshData() : nullptr;
+	if (!meshData) {
+		SPDLOG_ERROR("Refinement requires native data of generated mesh");
+		return false;
+	}
+
+	const auto isSimplexMesh = [&meshData](const Dimension dimension, const int cellType) {
+		return std::ranges::all_of(meshData->GetBlocks(dimension),
+			[cellType](const MGTMesh_MeshData::ElementBlock& block) {
+				return block.cellType == cellType;
+			});
+	};
+	if (!isSimplexMesh(Dimension::Volume, VTK_TETRA)
+		|| !isSimplexMesh(Dimension::Surface, VTK_TRIANGLE)) {
+		SPDLOG_ERROR("Only tetrahedral and triangular meshes can be refined");
+		return false;
+	}
+
+	Edges edges = CollectEdges(meshData);
+	const vtkIdType tetraNb = meshData->GetNumberOfElements(Dimension::Volume);
+	const vtkIdType trianglesNb = meshData->GetNumberOfElements(Dimension::Surface);
+	if (_marked.empty()) {
+		std::ranges::fill(edges.isSplit, 1);
+	} else {
+		for (const vtkIdType tetra : _marked) {
+			if (tetra < 0 || tetra >= tetraNb) {
+				SPDLOG_WARN("Marked element {} is not a volume element", tetra);
+				continue;
+			}
+			for (int i = 0; i < 6; ++i)
+				edges.isSplit[edges.tetraEdges[6 * tetra + i]] = 1;
+		}
+	}
+	const vtkIdType closedNb = _marked.empty() ? 0 : CloseRefinement(edges);
+
+	// Midpoints of split edges are appended to existing nodes
+	const vtkIdType nodesNb = meshData->GetNumberOfNodes();
+	std::vector<std::int32_t> midpoints(edges.nodes.size(), -1);
+	std::vector<std::int32_t> splitEdges;
+	for (std::size_t edge = 0; edge < edges.nodes.size(); ++edge) {
+		if (edges.isSplit[edge]) {
+			midpoints[edge] = static_cast<std::int32_t>(nodesNb + splitEdges.size());
+			splitEdges.push_back(static_cast<std::int32_t>(edge));
+		}
+	}
+	if (splitEdges.empty()) {
+		SPDLOG_WARN("No element was marked for refinement");
+		return false;
+	}
+
+	std::vector<double> coords(meshData->GetNodes().begin(), meshData->GetNodes().end());
+	coords.resize(3 * (nodesNb + splitEdges.size()));
+	for (const std::int32_t edge : splitEdges) {
+		for (int k = 0; k < 3; ++k) {
+			coords[3 * static_cast<std::size_t>(midpoints[edge]) + k] = 0.5
+				* (coords[3 * static_cast<std::size_t>(edges.nodes[edge][0]) + k]
+					+ coords[3 * static_cast<std::size_t>(edges.nodes[edge][1]) + k]);
+		}
+	}
+
+	// Children are oriented on straight edges, projection may only fold them afterwards
+	Children volumeChildren;
+	const std::span<const std::int32_t> tetra = meshData->GetConnectivity(Dimension::Volume);
+	const std::span<const std::int32_t> solidIds = meshData->GetTags(Dimension::Volume);
+	for (const MGTMesh_MeshData::ElementBlock& block : meshData->GetBlocks(Dimension::Volume)) {
+		const std::size_t childrenNb = volumeChildren.tags.size();
+		for (vtkIdType element = block.firstElement;
+			element < block.firstElement + block.elementsNb; ++element) {
+			std::array<std::int32_t, 10> nodes {};
+			std::copy_n(tetra.begin() + 4 * element, 4, nodes.begin());
+			for (int i = 0; i < 6; ++i)
+				nodes[4 + i] = midpoints[edges.tetraEdges[6 * element + i]];
+			SplitTetra(nodes, edges.GetTetraMask(element), coords, solidIds[element],
+				volumeChildren);
+		}
+		volumeChildren.blockSizes.push_back(
+			static_cast<vtkIdType>(volumeChildren.tags.size() - childrenNb));
+	}
+
+	Children surfaceChildren;
+	const std::span<const std::int32_t> triangles = meshData->GetConnectivity(Dimension::Surface);
+	const std::span<const std::int32_t> faceIds = meshData->GetTags(Dimension::Surface);
+	for (const MGTMesh_MeshData::ElementBlock& block : meshData->GetBlocks(Dimension::Surface)) {
+		const std::size_t childrenNb = surfaceChildren.tags.size();
+		for (vtkIdType element = block.firstElement;
+			element < block.firstElement + block.elementsNb; ++element) {
+			std::array<std::int32_t, 6> nodes {};
+			std::copy_n(triangles.begin() + 3 * element, 3, nodes.begin());
+			for (int i = 0; i < 3; ++i)
+				nodes[3 + i] = midpoints[edges.triangleEdges[3 * element + i]];
+			SplitTriangle(
+				nodes, edges.GetTriangleMask(element), faceIds[element], surfaceChildren);
+		}
+		surfaceChildren.blockSizes.push_back(
+			static_cast<vtkIdType>(surfaceChildren.tags.size() - childrenNb));
+	}
+
+	if (_projection) {
+		const std::vector<double> straight(coords.begin() + 3 * nodesNb, coords.end());
+		std::vector<char> isProjected(splitEdges.size(), 0);
+		vtkSMPTools::For(0, static_cast<vtkIdType>(splitEdges.size()),
+			[&](vtkIdType begin, vtkIdType end) {
+				for (vtkIdType i = begin; i < end; ++i) {
+					const std::int32_t edge = splitEdges[i];
+					isProjected[i] = ProjectMidpoint(_projection, edges.faceIds[edge],
+						coords.data() + 3 * static_cast<std::size_t>(midpoints[edge]));
+				}
+			});
+
+		// Midpoints of folded children return to their edges until no child is folded
+		vtkIdType restoredNb = 0;
+		bool isRestored = true;
+		while (isRestored) {
+			isRestored = false;
+			for (std::size_t child = 0; child < volumeChildren.tags.size(); ++child) {
+				const std::int32_t* childNodes = volumeChildren.connectivity.data() + 4 * child;
+				if (GetVolume(coords, childNodes) * volumeChildren.orientations[child] > 0.0)
+					continue;
+				for (int j = 0; j < 4; ++j) {
+					const vtkIdType midpoint = childNodes[j] - nodesNb;
+					if (midpoint < 0 || !isProjected[midpoint])
+						continue;
+					std::copy_n(straight.begin() + 3 * midpoint, 3,
+						coords.begin() + 3 * static_cast<std::size_t>(childNodes[j]));
+					isProjected[midpoint] = 0;
+					isRestored = true;
+					++restoredNb;
+				}
+			}
+		}
+		if (restoredNb > 0)
+			spdlog::debug("{} midpoints left on straight edges to avoid folded elements", restoredNb);
+	}
+
+	auto refined = vtkSmartPointer<MGTMesh_MeshData>::New();
+	const std::span<double> refinedNodes
+		= refined->AllocateNodes(static_cast<vtkIdType>(coords.size() / 3));
+	if (refinedNodes.empty())
+		return false;
+	std::ranges::copy(coords, refinedNodes.begin());
+
+	const auto appendChildren = [&refined](const Dimension dimension, const int cellType,
+									const Children& children) {
+		const int nodesNb = MGTMesh_MeshData::GetNodesNb(cellType);
+		vtkIdType first = 0;
+		for (const vtkIdType blockSize : children.blockSizes) {
+			if (blockSize == 0)
+				continue;
+			const MGTMesh_MeshData::BlockData target
+				= refined->AppendBlock(dimension, cellType, blockSize);
+			std::copy_n(children.connectivity.begin() + first * nodesNb, blockSize * nodesNb,
+				target.connectivity.begin());
+			std::copy_n(children.tags.begin() + first, blockSize, target.tags.begin());
+			first += blockSize;
+		}
+	};
+	appendChildren(Dimension::Volume, VTK_TETRA, volumeChildren);
+	appendChildren(Dimension::Surface, VTK_TRIANGLE, surfaceChildren);
+	mesh->SetMeshData(refined);
+
+	SPDLOG_INFO("Mesh refined, {} edges split ({} elements refined for conformity), "
+				"tetrahedra: {} -> {}, triangles: {} -> {}",
+		splitEdges.size(), closedNb, tetraNb, volumeChildren.tags.size(), trianglesNb,
+		surfaceChildren.tags.size());
+	return true;
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_Refiner.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#ifndef MGTMESH_REFINER_HPP
+#define MGTMESH_REFINER_HPP
+
+#include <vtkType.h>
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+class MGTMesh_MeshObject;
+
+/**
+ * Refinement of tetrahedral and triangular meshes stored in native mesh data. Marked
+ * elements are split into 8 tetrahedra (4 triangles) by their edge midpoints, the
+ * neighbouring elements are closed by bisection or by splitting one face, or refined
+ * too if their split edges do not allow it. New elements inherit tags of their parents.
+ * Midpoints of surface edges are projected onto the geometric faces of the edge, unless
+ * it would invert an element.
+ */
+class MGTMesh_Refiner {
+public:
+	// Moves point onto geometric face with given ID, false if it could not be projected.
+	// It is called concurrently.
+	using Projection = std::function<bool(int faceId, double point[3])>;
+
+	MGTMesh_Refiner() = default;
+
+	// Indices of volume elements to refine, all elements are refined if empty
+	void SetMarkedElements(std::vector<vtkIdType> elements) { _marked = std::move(elements); }
+
+	// Midpoints stay on straight edges without projection
+	void SetProjection(Projection projection) { _projection = std::move(projection); }
+
+	// Returns false if mesh has no native data or contains other than simplex elements
+	bool Refine(MGTMesh_MeshObject* mesh);
+
+private:
+	std::vector<vtkIdType> _marked;
+	Projection _projection;
+};
+
+#endif
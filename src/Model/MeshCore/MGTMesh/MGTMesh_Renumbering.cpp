@@ -0,0 +1,416 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_Renumbering.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#include "MGTMesh_Renumbering.hpp"
+
+#include <vtkSMPThreadLocal.h>
+#include <vtkSMPTools.h>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <utility>
+
+namespace {
+
+using Dimension = MGTMesh_MeshData::Dimension;
+
+// Bits of each quantized coordinate, Hilbert keys fit 63 bits
+constexpr int HilbertBits = 21;
+
+// Elements defining node adjacency: volume elements, surface elements of surface meshes
+Dimension GetGraphDimension(const MGTMesh_MeshData* meshData) {
+	return meshData->GetNumberOfElements(Dimension::Volume) > 0 ? Dimension::Volume
+																: Dimension::Surface;
+}
+
+// Position of nodes of each element in connectivity array
+std::vector<vtkIdType> GetElementOffsets(
+	const MGTMesh_MeshData* meshData, const Dimension dimension) {
+	std::vector<vtkIdType> offsets(meshData->GetNumberOfElements(dimension) + 1, 0);
+	vtkIdType offset = 0;
+	for (const MGTMesh_MeshData::ElementBlock& block : meshData->GetBlocks(dimension)) {
+		for (vtkIdType i = 0; i < block.elementsNb; ++i) {
+			offsets[block.firstElement + i] = offset;
+			offset += block.nodesNb;
+		}
+	}
+	offsets.back() = offset;
+	return offsets;
+}
+
+// Node adjacency in compressed rows, neighbours are sorted
+struct Graph {
+	std::vector<vtkIdType> offsets;
+	std::vector<std::int32_t> adjacency;
+
+	[[nodiscard]] vtkIdType GetDegree(const std::int32_t node) const {
+		return offsets[node + 1] - offsets[node];
+	}
+
+	[[nodiscard]] std::span<const std::int32_t> GetNeighbors(const std::int32_t node) const {
+		return std::span(adjacency).subspan(offsets[node], this->GetDegree(node));
+	}
+};
+
+Graph BuildGraph(const MGTMesh_MeshData* meshData) {
+	const vtkIdType nodesNb = meshData->GetNumberOfNodes();
+	const Dimension dimension = GetGraphDimension(meshData);
+	const std::span<const std::int32_t> connectivity = meshData->GetConnectivity(dimension);
+	const std::vector<vtkIdType> elementOffsets = GetElementOffsets(meshData, dimension);
+	const auto elementsNb = static_cast<vtkIdType>(elementOffsets.size()) - 1;
+
+	// Elements of each node
+	std::vector<vtkIdType> incidenceOffsets(nodesNb + 1, 0);
+	for (const std::int32_t node : connectivity)
+		++incidenceOffsets[node + 1];
+	std::partial_sum(incidenceOffsets.begin(), incidenceOffsets.end(), incidenceOffsets.begin());
+
+	std::vector<vtkIdType> incidence(connectivity.size());
+	std::vector<vtkIdType> cursor(incidenceOffsets.begin(), incidenceOffsets.end() - 1);
+	for (vtkIdType element = 0; element < elementsNb; ++element) {
+		for (vtkIdType i = elementOffsets[element]; i < elementOffsets[element + 1]; ++i)
+			incidence[cursor[connectivity[i]]++] = element;
+	}
+
+	// Neighbours are collected twice: to size rows and to fill them
+	vtkSMPThreadLocal<std::vector<std::int32_t>> scratch;
+	const auto collectNeighbors = [&](const vtkIdType node, std::vector<std::int32_t>& neighbors) {
+		neighbors.clear();
+		for (vtkIdType k = incidenceOffsets[node]; k < incidenceOffsets[node + 1]; ++k) {
+			const vtkIdType element = incidence[k];
+			for (vtkIdType i = elementOffsets[element]; i < elementOffsets[element + 1]; ++i) {
+				if (connectivity[i] != node)
+					neighbors.push_back(connectivity[i]);
+			}
+		}
+		std::ranges::sort(neighbors);
+		neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+	};
+
+	Graph graph;
+	graph.offsets.assign(nodesNb + 1, 0);
+	vtkSMPTools::For(0, nodesNb, [&](vtkIdType begin, vtkIdType end) {
+		std::vector<std::int32_t>& neighbors = scratch.Local();
+		for (vtkIdType node = begin; node < end; ++node) {
+			collectNeighbors(node, neighbors);
+			graph.offsets[node + 1] = static_cast<vtkIdType>(neighbors.size());
+		}
+	});
+	std::partial_sum(graph.offsets.begin(), graph.offsets.end(), graph.offsets.begin());
+
+	graph.adjacency.resize(graph.offsets.back());
+	vtkSMPTools::For(0, nodesNb, [&](vtkIdType begin, vtkIdType end) {
+		std::vector<std::int32_t>& neighbors = scratch.Local();
+		for (vtkIdType node = begin; node < end; ++node) {
+			collectNeighbors(node, neighbors);
+			std::ranges::copy(neighbors, graph.adjacency.begin() + graph.offsets[node]);
+		}
+	});
+	return graph;
+}
+
+// Breadth-first search from the root, returns depth of the search and fills nodes
+// of the deepest level. Levels of visited nodes are reset before returning.
+int BreadthFirstSearch(const Graph& graph, const std::int32_t root, std::vector<int>& levels,
+	std::vector<std::int32_t>& queue, std::vector<std::int32_t>& lastLevel) {
+	queue.clear();
+	queue.push_back(root);
+	levels[root] = 0;
+
+	for (std::size_t head = 0; head < queue.size(); ++head) {
+		const std::int32_t node = queue[head];
+		for (const std::int32_t neighbor : graph.GetNeighbors(node)) {
+			if (levels[neighbor] < 0) {
+				levels[neighbor] = levels[node] + 1;
+				queue.push_back(neighbor);
+			}
+		}
+	}
+
+	const int depth = levels[queue.back()];
+	lastLevel.clear();
+	for (auto it = queue.rbegin(); it != queue.rend() && levels[*it] == depth; ++it)
+		lastLevel.push_back(*it);
+
+	for (const std::int32_t node : queue)
+		levels[node] = -1;
+	return depth;
+}
+
+// George-Liu search of a node with (nearly) maximal eccentricity in the component
+std::int32_t FindPseudoPeripheralNode(const Graph& graph, const std::int32_t start,
+	std::vector<int>& levels, std::vector<std::int32_t>& queue) {
+	constexpr int MaxIterations = 8;
+
+	std::vector<std::int32_t> lastLevel;
+	std::int32_t root = start;
+	int depth = BreadthFirstSearch(graph, root, levels, queue, lastLevel);
+
+	for (int iteration = 0; iteration < MaxIterations; ++iteration) {
+		const std::int32_t candidate = *std::ranges::min_element(lastLevel,
+			[&graph](std::int32_t a, std::int32_t b) { return graph.GetDegree(a) < graph.GetDegree(b); });
+		const int candidateDepth = BreadthFirstSearch(graph, candidate, levels, queue, lastLevel);
+		if (candidateDepth <= depth)
+			break;
+
+		root = candidate;
+		depth = candidateDepth;
+	}
+	return root;
+}
+
+// Skilling's transform of quantized coordinates to Hilbert curve index
+std::uint64_t GetHilbertKey(std::array<std::uint32_t, 3> x) {
+	constexpr std::uint32_t M = 1u << (HilbertBits - 1);
+
+	for (std::uint32_t q = M; q > 1; q >>= 1) {
+		const std::uint32_t p = q - 1;
+		for (int i = 0; i < 3; ++i) {
+			if (x[i] & q) {
+				x[0] ^= p;
+			} else {
+				const std::uint32_t t = (x[0] ^ x[i]) & p;
+				x[0] ^= t;
+				x[i] ^= t;
+			}
+		}
+	}
+
+	x[1] ^= x[0];
+	x[2] ^= x[1];
+	std::uint32_t t = 0;
+	for (std::uint32_t q = M; q > 1; q >>= 1) {
+		if (x[2] & q)
+			t ^= q - 1;
+	}
+	for (std::uint32_t& value : x)
+		value ^= t;
+
+	std::uint64_t key = 0;
+	for (int bit = HilbertBits - 1; bit >= 0; --bit) {
+		for (const std::uint32_t value : x)
+			key = (key << 1) | ((value >> bit) & 1u);
+	}
+	return key;
+}
+
+std::array<double, 6> ComputeBounds(const std::span<const double> nodes) {
+	constexpr double Max = std::numeric_limits<double>::max();
+	const std::array<double, 6> empty { Max, -Max, Max, -Max, Max, -Max };
+
+	vtkSMPThreadLocal<std::array<double, 6>> localBounds(empty);
+	vtkSMPTools::For(0, static_cast<vtkIdType>(nodes.size() / 3), [&](vtkIdType begin, vtkIdType end) {
+		std::array<double, 6>& bounds = localBounds.Local();
+		for (vtkIdType i = begin; i < end; ++i) {
+			for (int axis = 0; axis < 3; ++axis) {
+				bounds[2 * axis] = std::min(bounds[2 * axis], nodes[3 * i + axis]);
+				bounds[2 * axis + 1] = std::max(bounds[2 * axis + 1], nodes[3 * i + axis]);
+			}
+		}
+	});
+
+	std::array<double, 6> bounds = empty;
+	for (const std::array<double, 6>& local : localBounds) {
+		for (int axis = 0; axis < 3; ++axis) {
+			bounds[2 * axis] = std::min(bounds[2 * axis], local[2 * axis]);
+			bounds[2 * axis + 1] = std::max(bounds[2 * axis + 1], local[2 * axis + 1]);
+		}
+	}
+	return bounds;
+}
+
+}
+
+//----------------------------------------------------------------------------
+void MGTMesh_Renumbering::Renumber(MGTMesh_MeshData* meshData) {
+	if (!meshData || meshData->GetNumberOfNodes() == 0)
+		return;
+
+	const Statistics before = ComputeStatistics(meshData);
+
+	meshData->RenumberNodes(ComputeNodesOrder(meshData));
+	for (const Dimension dimension : { Dimension::Volume, Dimension::Surface })
+		meshData->ReorderElements(dimension, ComputeElementsOrder(meshData, dimension));
+
+	const Statistics after = ComputeStatistics(meshData);
+	SPDLOG_INFO("Mesh renumbered: bandwidth {} -> {}, profile {} -> {}", before.bandwidth,
+		after.bandwidth, before.profile, after.profile);
+}
+
+//----------------------------------------------------------------------------
+std::vector<std::int32_t> MGTMesh_Renumbering::ComputeNodesOrder(
+	const MGTMesh_MeshData* meshData) {
+	const auto nodesNb = static_cast<std::int32_t>(meshData->GetNumberOfNodes());
+	const Graph graph = BuildGraph(meshData);
+
+	std::vector<std::int32_t> order;
+	order.reserve(nodesNb);
+	std::vector<char> visited(nodesNb, 0);
+	std::vector<int> levels(nodesNb, -1);
+	std::vector<std::int32_t> queue;
+	std::vector<std::int32_t> neighbors;
+
+	// Cuthill-McKee ordering of each connected component
+	for (std::int32_t node = 0; node < nodesNb; ++node) {
+		if (visited[node])
+			continue;
+
+		const std::int32_t root = graph.GetDegree(node) > 0
+			? FindPseudoPeripheralNode(graph, node, levels, queue)
+			: node;
+		visited[root] = 1;
+		order.push_back(root);
+
+		for (std::size_t head = order.size() - 1; head < order.size(); ++head) {
+			neighbors.clear();
+			for (const std::int32_t neighbor : graph.GetNeighbors(order[head])) {
+				if (!visited[neighbor]) {
+					visited[neighbor] = 1;
+					neighbors.push_back(neighbor);
+				}
+			}
+
+			std::ranges::sort(neighbors, [&graph](std::int32_t a, std::int32_t b) {
+				const vtkIdType degreeA = graph.GetDegree(a);
+				const vtkIdType degreeB = graph.GetDegree(b);
+				return degreeA != degreeB ? degreeA < degreeB : a < b;
+			});
+			order.insert(order.end(), neighbors.begin(), neighbors.end());
+		}
+	}
+
+	// Reversed order has the same bandwidth and smaller profile
+	std::vector<std::int32_t> newIds(nodesNb);
+	vtkSMPTools::For(0, nodesNb, [&](vtkIdType begin, vtkIdType end) {
+		for (vtkIdType i = begin; i < end; ++i)
+			newIds[order[nodesNb - 1 - i]] = static_cast<std::int32_t>(i);
+	});
+	return newIds;
+}
+
+//----------------------------------------------------------------------------
+std::vector<vtkIdType> MGTMesh_Renumbering::ComputeElementsOrder(
+	const MGTMesh_MeshData* meshData, const Dimension dimension) {
+	const vtkIdType elementsNb = meshData->GetNumberOfElements(dimension);
+	std::vector<vtkIdType> order(elementsNb);
+	if (elementsNb == 0)
+		return order;
+
+	const std::span<const double> nodes = meshData->GetNodes();
+	const std::span<const std::int32_t> connectivity = meshData->GetConnectivity(dimension);
+	const std::array<double, 6> bounds = ComputeBounds(nodes);
+
+	std::array<double, 3> scale {};
+	for (int axis = 0; axis < 3; ++axis) {
+		const double extent = bounds[2 * axis + 1] - bounds[2 * axis];
+		scale[axis] = extent > 0 ? ((1u << HilbertBits) - 1) / extent : 0.0;
+	}
+
+	std::vector<std::pair<std::uint64_t, vtkIdType>> keys(elementsNb);
+	vtkIdType blockOffset = 0;
+	for (const MGTMesh_MeshData::ElementBlock& block : meshData->GetBlocks(dimension)) {
+		const int nodesNb = block.nodesNb;
+
+		vtkSMPTools::For(0, block.elementsNb, [&](vtkIdType begin, vtkIdType end) {
+			for (vtkIdType i = begin; i < end; ++i) {
+				std::array<double, 3> centroid {};
+				for (int j = 0; j < nodesNb; ++j) {
+					const std::int32_t node = connectivity[blockOffset + i * nodesNb + j];
+					for (int axis = 0; axis < 3; ++axis)
+						centroid[axis] += nodes[3 * node + axis];
+				}
+
+				std::array<std::uint32_t, 3> quantized {};
+				for (int axis = 0; axis < 3; ++axis) {
+					const double position
+						= (centroid[axis] / nodesNb - bounds[2 * axis]) * scale[axis];
+					quantized[axis] = static_cast<std::uint32_t>(
+						std::clamp(position, 0.0, static_cast<double>((1u << HilbertBits) - 1)));
+				}
+				keys[block.firstElement + i] = { GetHilbertKey(quantized), block.firstElement + i };
+			}
+		});
+
+		vtkSMPTools::Sort(keys.begin() + block.firstElement,
+			keys.begin() + block.firstElement + block.elementsNb);
+		blockOffset += block.elementsNb * nodesNb;
+	}
+
+	vtkSMPTools::For(0, elementsNb, [&](vtkIdType begin, vtkIdType end) {
+		for (vtkIdType i = begin; i < end; ++i)
+			order[i] = keys[i].second;
+	});
+	return order;
+}
+
+//----------------------------------------------------------------------------
+MGTMesh_Renumbering::Statistics MGTMesh_Renumbering::ComputeStatistics(
+	const MGTMesh_MeshData* meshData) {
+	const vtkIdType nodesNb = meshData->GetNumberOfNodes();
+	const Dimension dimension = GetGraphDimension(meshData);
+	const std::span<const std::int32_t> connectivity = meshData->GetConnectivity(dimension);
+	const std::vector<vtkIdType> elementOffsets = GetElementOffsets(meshData, dimension);
+	const auto elementsNb = static_cast<vtkIdType>(elementOffsets.size()) - 1;
+
+	// First column of each row of lower triangle of the adjacency matrix
+	std::vector<std::int32_t> rowStart(nodesNb);
+	std::iota(rowStart.begin(), rowStart.end(), 0);
+
+	vtkSMPThreadLocal<std::int64_t> localBandwidth(0);
+	vtkSMPTools::For(0, elementsNb, [&](vtkIdType begin, vtkIdType end) {
+		std::int64_t& bandwidth = localBandwidth.Local();
+		for (vtkIdType element = begin; element < end; ++element) {
+			const auto first = connectivity.begin() + elementOffsets[element];
+			const auto last = connectivity.begin() + elementOffsets[element + 1];
+			const auto [minNode, maxNode] = std::minmax_element(first, last);
+			bandwidth = std::max<std::int64_t>(bandwidth, *maxNode - *minNode);
+
+			for (auto node = first; node != last; ++node) {
+				std::atomic_ref<std::int32_t> start(rowStart[*node]);
+				std::int32_t current = start.load(std::memory_order_relaxed);
+				while (*minNode < current
+					&& !start.compare_exchange_weak(current, *minNode, std::memory_order_relaxed)) { }
+			}
+		}
+	});
+
+	vtkSMPThreadLocal<std::int64_t> localProfile(0);
+	vtkSMPTools::For(0, nodesNb, [&](vtkIdType begin, vtkIdType end) {
+		std::int64_t& profile = localProfile.Local();
+		for (vtkIdType node = begin; node < end; ++node)
+			profile += node - rowStart[node];
+	});
+
+	Statistics statistics;
+	for (const std::int64_t bandwidth : localBandwidth)
+		statistics.bandwidth = std::max(statistics.bandwidth, bandwidth);
+	for (const std::int64_t profile : localProfile)
+		statistics.profile += profile;
+	return statistics;
+}
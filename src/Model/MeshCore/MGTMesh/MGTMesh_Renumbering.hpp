@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_Renumbering.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef MGTMESH_RENUMBERING_HPP
+#define MGTMESH_RENUMBERING_HPP
+
+#include "MGTMesh_MeshData.hpp"
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * Cache-friendly numbering of mesh data. Nodes are renumbered with Reverse
+ * Cuthill-McKee to reduce bandwidth and profile of node adjacency, elements of
+ * each block are ordered along Hilbert curve of their centroids, so that
+ * neighbouring elements are stored close to each other.
+ */
+class MGTMesh_Renumbering {
+public:
+	// Bandwidth and profile of node adjacency matrix
+	struct Statistics {
+		std::int64_t bandwidth = 0;
+		std::int64_t profile = 0;
+	};
+
+	// Renumbers nodes and elements of both dimensions, reports statistics before and after
+	static void Renumber(MGTMesh_MeshData* meshData);
+
+	// New ID of each node in Reverse Cuthill-McKee order
+	[[nodiscard]] static std::vector<std::int32_t> ComputeNodesOrder(
+		const MGTMesh_MeshData* meshData);
+
+	// Index of element to be placed at each position, elements stay in their blocks
+	[[nodiscard]] static std::vector<vtkIdType> ComputeElementsOrder(
+		const MGTMesh_MeshData* meshData, MGTMesh_MeshData::Dimension dimension);
+
+	[[nodiscard]] static Statistics ComputeStatistics(const MGTMesh_MeshData* meshData);
+};
+
+#endif
@@ -0,0 +1,234 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_SectionView.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "MGTMesh_SectionView.hpp"
+#include "MGTMesh_MeshObject.hpp"
+
+#include <vtkActor.h>
+#include <vtkCutter.h>
+#include <vtkDataSetSurfaceFilter.h>
+#include <vtkExtractCells.h>
+#include <vtkIdList.h>
+#include <vtkPlane.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkProperty.h>
+#include <vtkSMPThreadLocalObject.h>
+#include <vtkSMPTools.h>
+#include <vtkStaticCellLocator.h>
+#include <vtkUnstructuredGrid.h>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+// Marks candidate cells that have vertices on both sides of the plane.
+// Locator returns cells whose bounding boxes touch the plane, so only
+// those are tested against exact vertex positions.
+struct PlaneCrossingFunctor {
+	PlaneCrossingFunctor(vtkUnstructuredGrid* mesh, vtkIdList* candidates,
+		const double origin[3], const double normal[3], std::vector<char>& crossing)
+		: mesh(mesh)
+		, candidates(candidates)
+		, origin { origin[0], origin[1], origin[2] }
+		, normal { normal[0], normal[1], normal[2] }
+		, crossing(crossing) { }
+
+	vtkUnstructuredGrid* mesh;
+	vtkIdList* candidates;
+	double origin[3];
+	double normal[3];
+	std::vector<char>& crossing;
+	vtkSMPThreadLocalObject<vtkIdList> cellPoints;
+
+	void Initialize() { }
+
+	void operator()(vtkIdType begin, vtkIdType end) {
+		vtkIdList* pointIds = cellPoints.Local();
+		double x[3];
+
+		for (vtkIdType i = begin; i < end; ++i) {
+			const vtkIdType cellId = candidates->GetId(i);
+			mesh->GetCellPoints(cellId, pointIds);
+
+			double minD = VTK_DOUBLE_MAX;
+			double maxD = VTK_DOUBLE_MIN;
+			for (vtkIdType j = 0; j < pointIds->GetNumberOfIds(); ++j) {
+				mesh->GetPoints()->GetPoint(pointIds->GetId(j), x);
+				const double d = vtkPlane::Evaluate(normal, origin, x);
+				minD = std::min(minD, d);
+				maxD = std::max(maxD, d);
+			}
+			crossing[i] = minD <= 0.0 && maxD > 0.0;
+		}
+	}
+
+	void Reduce() { }
+};
+
+}
+
+//----------------------------------------------------------------------------
+MGTMesh_SectionView::MGTMesh_SectionView(MGTMesh_MeshObject* mesh)
+	: _plane(vtkSmartPointer<vtkPlane>::New())
+	, _sectionCells(vtkSmartPointer<vtkIdList>::New())
+	, _extractCells(vtkSmartPointer<vtkExtractCells>::New())
+	, _surfaceFilter(vtkSmartPointer<vtkDataSetSurfaceFilter>::New())
+	, _cutter(vtkSmartPointer<vtkCutter>::New())
+	, _sectionMapper(vtkSmartPointer<vtkPolyDataMapper>::New())
+	, _boundaryActor(vtkSmartPointer<vtkActor>::New())
+	, _sectionActor(vtkSmartPointer<vtkActor>::New())
+	, _bounds { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 }
+	, _mode(Mode::Crinkle) {
+
+	if (!mesh || mesh->IsEmpty()) {
+		SPDLOG_WARN("MGTMesh_SectionView created for null or empty mesh.");
+		_internalMesh = vtkSmartPointer<vtkUnstructuredGrid>::New();
+	} else {
+		_internalMesh = mesh->GetInternalMesh();
+		mesh->GetBounds(_bounds);
+	}
+
+	// Boundary mesh is clipped on GPU, no filter has to be re-executed when
+	// plane is moved
+	const auto boundaryMapper = vtkSmartPointer<vtkPolyDataMapper>::New();
+	if (mesh && mesh->GetBoundaryMesh())
+		boundaryMapper->SetInputData(mesh->GetBoundaryMesh());
+	boundaryMapper->AddClippingPlane(_plane);
+	boundaryMapper->ScalarVisibilityOff();
+	_boundaryActor->SetMapper(boundaryMapper);
+	_boundaryActor->GetProperty()->SetEdgeVisibility(true);
+	_boundaryActor->GetProperty()->SetEdgeColor(1.0, 0.0, 0.0);
+
+	_extractCells->SetInputData(_internalMesh);
+	_surfaceFilter->SetInputConnection(_extractCells->GetOutputPort());
+	_cutter->SetInputConnection(_extractCells->GetOutputPort());
+	_cutter->SetCutFunction(_plane);
+	_cutter->GenerateTrianglesOn();
+
+	_sectionMapper->SetInputConnection(_surfaceFilter->GetOutputPort());
+	_sectionMapper->ScalarVisibilityOff();
+	_sectionActor->SetMapper(_sectionMapper);
+	_sectionActor->GetProperty()->SetEdgeVisibility(true);
+	_sectionActor->GetProperty()->SetEdgeColor(1.0, 0.0, 0.0);
+
+	const double origin[3] = { 0.5 * (_bounds[0] + _bounds[1]),
+		0.5 * (_bounds[2] + _bounds[3]), 0.5 * (_bounds[4] + _bounds[5]) };
+	const double normal[3] = { 1.0, 0.0, 0.0 };
+	this->SetPlane(origin, normal);
+}
+
+//----------------------------------------------------------------------------
+MGTMesh_SectionView::~MGTMesh_SectionView() = default;
+
+//----------------------------------------------------------------------------
+void MGTMesh_SectionView::SetMode(const Mode mode) {
+	if (_mode == mode)
+		return;
+
+	_mode = mode;
+	if (_mode == Mode::Crinkle) {
+		_sectionMapper->SetInputConnection(_surfaceFilter->GetOutputPort());
+	} else {
+		_sectionMapper->SetInputConnection(_cutter->GetOutputPort());
+	}
+}
+
+//----------------------------------------------------------------------------
+void MGTMesh_SectionView::SetPlane(
+	const double origin[3], const double normal[3]) {
+	_plane->SetOrigin(origin[0], origin[1], origin[2]);
+	_plane->SetNormal(normal[0], normal[1], normal[2]);
+	this->UpdateSectionCells();
+}
+
+//----------------------------------------------------------------------------
+void MGTMesh_SectionView::UpdateSectionCells() {
+	_sectionCells->Reset();
+
+	if (_internalMesh->GetNumberOfCells() == 0) {
+		_extractCells->SetCellList(_sectionCells);
+		return;
+	}
+
+	// Locator is built once, every other plane update only queries it
+	if (!_locator) {
+		_locator = vtkSmartPointer<vtkStaticCellLocator>::New();
+		_locator->SetDataSet(_internalMesh);
+		_locator->BuildLocator();
+	}
+
+	double origin[3];
+	double normal[3];
+	_plane->GetOrigin(origin);
+	_plane->GetNormal(normal);
+
+	const double diagonal = std::sqrt(
+		std::pow(_bounds[1] - _bounds[0], 2) + std::pow(_bounds[3] - _bounds[2], 2)
+		+ std::pow(_bounds[5] - _bounds[4], 2));
+
+	const auto candidates = vtkSmartPointer<vtkIdList>::New();
+	_locator->FindCellsAlongPlane(origin, normal, 1e-6 * diagonal, candidates);
+
+	const vtkIdType candidatesNb = candidates->GetNumberOfIds();
+	std::vector<char> crossing(candidatesNb, 0);
+	PlaneCrossingFunctor functor(
+		_internalMesh, candidates, origin, normal, crossing);
+	vtkSMPTools::For(0, candidatesNb, functor);
+
+	_sectionCells->Allocate(candidatesNb);
+	for (vtkIdType i = 0; i < candidatesNb; ++i) {
+		if (crossing[i])
+			_sectionCells->InsertNextId(candidates->GetId(i));
+	}
+
+	_extractCells->SetCellList(_sectionCells);
+	spdlog::debug("Section view: {} candidate cells, {} cut by plane",
+		candidatesNb, _sectionCells->GetNumberOfIds());
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkActor> MGTMesh_SectionView::GetBoundaryActor() const {
+	return _boundaryActor;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkActor> MGTMesh_SectionView::GetSectionActor() const {
+	return _sectionActor;
+}
+
+//----------------------------------------------------------------------------
+void MGTMesh_SectionView::GetBounds(double bounds[6]) const {
+	std::copy_n(_bounds, 6, bounds);
+}
+
+//----------------------------------------------------------------------------
+vtkIdType MGTMesh_SectionView::GetNumberOfSectionCells() const {
+	return _sectionCells->GetNumberOfIds();
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_SectionView.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef MGTMESH_SECTIONVIEW_HPP
+#define MGTMESH_SECTIONVIEW_HPP
+
+#include <vtkSmartPointer.h>
+
+class vtkActor;
+class vtkCutter;
+class vtkDataSetSurfaceFilter;
+class vtkExtractCells;
+class vtkIdList;
+class vtkPlane;
+class vtkPolyDataMapper;
+class vtkStaticCellLocator;
+class vtkUnstructuredGrid;
+class MGTMesh_MeshObject;
+
+/**
+ * Section view of a volume mesh. Boundary mesh is clipped by the plane on GPU
+ * (no filtering), only cells cut by the plane are extracted from internal mesh.
+ * Cut cells are found with a static cell locator built once per mesh, so moving the
+ * plane costs a locator query and exact test of candidate cells instead of a scan
+ * of the whole internal mesh.
+ */
+class MGTMesh_SectionView {
+public:
+	enum class Mode {
+		Crinkle, // Whole cells cut by the plane are displayed
+		Cut // Planar section of cells cut by the plane is displayed
+	};
+
+	explicit MGTMesh_SectionView(MGTMesh_MeshObject* mesh);
+	~MGTMesh_SectionView();
+
+	MGTMesh_SectionView(const MGTMesh_SectionView&) = delete;
+	MGTMesh_SectionView& operator=(const MGTMesh_SectionView&) = delete;
+
+	void SetMode(Mode mode);
+	[[nodiscard]] Mode GetMode() const { return _mode; }
+
+	// Part of the mesh on the side pointed by the normal remains visible
+	void SetPlane(const double origin[3], const double normal[3]);
+
+	[[nodiscard]] vtkSmartPointer<vtkActor> GetBoundaryActor() const;
+	[[nodiscard]] vtkSmartPointer<vtkActor> GetSectionActor() const;
+
+	void GetBounds(double bounds[6]) const;
+	[[nodiscard]] vtkIdType GetNumberOfSectionCells() const;
+
+private:
+	void UpdateSectionCells();
+
+private:
+	vtkSmartPointer<vtkUnstructuredGrid> _internalMesh;
+	vtkSmartPointer<vtkStaticCellLocator> _locator;
+	vtkSmartPointer<vtkPlane> _plane;
+	vtkSmartPointer<vtkIdList> _sectionCells;
+
+	vtkSmartPointer<vtkExtractCells> _extractCells;
+	vtkSmartPointer<vtkDataSetSurfaceFilter> _surfaceFilter;
+	vtkSmartPointer<vtkCutter> _cutter;
+
+	vtkSmartPointer<vtkPolyDataMapper> _sectionMapper;
+	vtkSmartPointer<vtkActor> _boundaryActor;
+	vtkSmartPointer<vtkActor> _sectionActor;
+
+	double _bounds[6];
+	Mode _mode;
+};
+
+#endif
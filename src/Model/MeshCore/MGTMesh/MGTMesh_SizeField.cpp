@@ -0,0 +1,312 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_SizeField.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "MGTMesh_SizeField.hpp"
+#include "MGTMeshUtils_ControlPoint.h"
+
+#include <BRepAdaptor_Curve.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepClass3d_SolidClassifier.hxx>
+#include <BRep_Tool.hxx>
+#include <Bnd_Box.hxx>
+#include <GCPnts_UniformAbscissa.hxx>
+#include <Precision.hxx>
+#include <Standard_Failure.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <gp_Pnt.hxx>
+
+#include <vtkSMPTools.h>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+constexpr int LeafSize = 8;
+
+// Edges are sampled as densely as by former Netgen edge sizing
+constexpr double EdgeSamplesPerSize = 1.5;
+
+// Interior of solids is sampled on a lattice with spacing equal to the size, unless
+// it would exceed this number of points
+constexpr double MaxLatticePointsNb = 1e5;
+
+constexpr double Infinity = std::numeric_limits<double>::infinity();
+
+}
+
+//----------------------------------------------------------------------------
+MGTMesh_SizeField::MGTMesh_SizeField(const double growthRate, const double maxSize)
+	: _growthRate(std::max(growthRate, 0.0))
+	, _maxSize(maxSize > 0.0 ? maxSize : Infinity) { }
+
+//----------------------------------------------------------------------------
+void MGTMesh_SizeField::AddSizing(const TopoDS_Shape& shape, const double size) {
+	if (shape.IsNull() || size <= 0.0)
+		return;
+
+	switch (shape.ShapeType()) {
+	case TopAbs_VERTEX: {
+		const gp_Pnt p = BRep_Tool::Pnt(TopoDS::Vertex(shape));
+		const double point[3] { p.X(), p.Y(), p.Z() };
+		this->AddPoint(point, size);
+		break;
+	}
+	case TopAbs_EDGE:
+		this->AddEdge(shape, size);
+		break;
+	case TopAbs_FACE:
+		this->AddFace(shape, size);
+		break;
+	case TopAbs_SOLID:
+		this->AddSolid(shape, size);
+		break;
+	default:
+		for (TopoDS_Iterator it(shape); it.More(); it.Next())
+			this->AddSizing(it.Value(), size);
+	}
+}
+
+//----------------------------------------------------------------------------
+void MGTMesh_SizeField::AddPoint(const double point[3], const double size) {
+	_sources.push_back({ { point[0], point[1], point[2] }, size });
+}
+
+//----------------------------------------------------------------------------
+void MGTMesh_SizeField::AddEdge(const TopoDS_Shape& shape, const double size) {
+	const TopoDS_Edge& edge = TopoDS::Edge(shape);
+	if (BRep_Tool::Degenerated(edge))
+		return;
+
+	for (TopExp_Explorer it(edge, TopAbs_VERTEX); it.More(); it.Next())
+		this->AddSizing(it.Current(), size);
+	if (!BRep_Tool::IsGeometric(edge))
+		return;
+
+	try {
+		const BRepAdaptor_Curve curve(edge);
+		const GCPnts_UniformAbscissa sampler(curve, size / EdgeSamplesPerSize);
+		if (!sampler.IsDone())
+			return;
+		for (int i = 1; i <= sampler.NbPoints(); ++i) {
+			const gp_Pnt p = curve.Value(sampler.Parameter(i));
+			const double point[3] { p.X(), p.Y(), p.Z() };
+			this->AddPoint(point, size);
+		}
+	} catch (const Standard_Failure& ex) {
+		SPDLOG_WARN("Edge could not be sampled for sizing: {}", ex.GetMessageString());
+	}
+}
+
+//----------------------------------------------------------------------------
+void MGTMesh_SizeField::AddFace(const TopoDS_Shape& shape, const double size) {
+	const TopoDS_Face& face = TopoDS::Face(shape);
+	_faceSizes.emplace_back(face, size);
+
+	// Interior of faces is sampled by Build for all faces at once
+	for (TopExp_Explorer it(face, TopAbs_EDGE); it.More(); it.Next())
+		this->AddEdge(it.Current(), size);
+}
+
+//----------------------------------------------------------------------------
+void MGTMesh_SizeField::AddSolid(const TopoDS_Shape& solid, const double size) {
+	for (TopExp_Explorer it(solid, TopAbs_FACE); it.More(); it.Next())
+		this->AddFace(it.Current(), size);
+
+	Bnd_Box box;
+	BRepBndLib::Add(solid, box);
+	if (box.IsVoid())
+		return;
+
+	std::array<double, 3> min {};
+	std::array<double, 3> max {};
+	box.Get(min[0], min[1], min[2], max[0], max[1], max[2]);
+	double spacing = size;
+	const double latticePointsNb = (max[0] - min[0]) * (max[1] - min[1]) * (max[2] - min[2])
+		/ (spacing * spacing * spacing);
+	if (latticePointsNb > MaxLatticePointsNb) {
+		spacing *= std::cbrt(latticePointsNb / MaxLatticePointsNb);
+		spdlog::debug("Interior of solid sampled with spacing {} instead of {}", spacing, size);
+	}
+
+	std::array<int, 3> pointsNb {};
+	for (int k = 0; k < 3; ++k)
+		pointsNb[k] = std::max(1, static_cast<int>((max[k] - min[k]) / spacing));
+
+	BRepClass3d_SolidClassifier classifier(solid);
+	for (int i = 0; i < pointsNb[0]; ++i) {
+		for (int j = 0; j < pointsNb[1]; ++j) {
+			for (int k = 0; k < pointsNb[2]; ++k) {
+				const double point[3] { min[0] + (i + 0.5) * spacing,
+					min[1] + (j + 0.5) * spacing, min[2] + (k + 0.5) * spacing };
+				classifier.Perform(gp_Pnt(point[0], point[1], point[2]), Precision::Confusion());
+				if (classifier.State() == TopAbs_IN)
+					this->AddPoint(point, size);
+			}
+		}
+	}
+}
+
+//----------------------------------------------------------------------------
+void MGTMesh_SizeField::Build() {
+	std::vector<MGTMeshUtils::ControlPoint> facesPoints;
+	MGTMeshUtils::createPointsSampleFromFaces(_faceSizes, facesPoints);
+	for (const MGTMeshUtils::ControlPoint& controlPoint : facesPoints) {
+		const double point[3] { controlPoint.X(), controlPoint.Y(), controlPoint.Z() };
+		this->AddPoint(point, controlPoint.Size());
+	}
+
+	_nodes.clear();
+	if (_sources.empty())
+		return;
+	this->BuildNode(0, static_cast<int>(_sources.size()));
+
+	// Sources dominated by others never give the field value
+	const auto sourcesNb = static_cast<vtkIdType>(_sources.size());
+	std::vector<char> isKept(_sources.size(), 0);
+	vtkSMPTools::For(0, sourcesNb, [&](vtkIdType begin, vtkIdType end) {
+		for (vtkIdType i = begin; i < end; ++i)
+			isKept[i] = this->FindSmallest(_sources[i].point.data()).second == i;
+	});
+
+	std::vector<Source> sources;
+	for (std::size_t i = 0; i < _sources.size(); ++i) {
+		if (isKept[i])
+			sources.push_back(_sources[i]);
+	}
+	_sources = std::move(sources);
+
+	_nodes.clear();
+	if (!_sources.empty())
+		this->BuildNode(0, static_cast<int>(_sources.size()));
+	spdlog::debug("Size field built from {} of {} sources", _sources.size(), sourcesNb);
+}
+
+//----------------------------------------------------------------------------
+int MGTMesh_SizeField::BuildNode(const int first, const int count) {
+	Node node { { Infinity, -Infinity, Infinity, -Infinity, Infinity, -Infinity }, Infinity,
+		first, count, -1, -1 };
+	for (int i = first; i < first + count; ++i) {
+		for (int k = 0; k < 3; ++k) {
+			node.bounds[2 * k] = std::min(node.bounds[2 * k], _sources[i].point[k]);
+			node.bounds[2 * k + 1] = std::max(node.bounds[2 * k + 1], _sources[i].point[k]);
+		}
+		node.minSize = std::min(node.minSize, _sources[i].size);
+	}
+
+	const int index = static_cast<int>(_nodes.size());
+	_nodes.push_back(node);
+	if (count <= LeafSize)
+		return index;
+
+	// Split at the median along the longest side of bounds
+	int axis = 0;
+	for (int k = 1; k < 3; ++k) {
+		if (node.bounds[2 * k + 1] - node.bounds[2 * k]
+			> node.bounds[2 * axis + 1] - node.bounds[2 * axis])
+			axis = k;
+	}
+	const auto begin = _sources.begin() + first;
+	std::nth_element(begin, begin + count / 2, begin + count,
+		[axis](const Source& a, const Source& b) { return a.point[axis] < b.point[axis]; });
+
+	const int left = this->BuildNode(first, count / 2);
+	const int right = this->BuildNode(first + count / 2, count - count / 2);
+	_nodes[index].left = left;
+	_nodes[index].right = right;
+	return index;
+}
+
+//----------------------------------------------------------------------------
+std::pair<double, int> MGTMesh_SizeField::FindSmallest(const double point[3]) const {
+	std::pair<double, int> smallest { _maxSize, -1 };
+	if (_nodes.empty())
+		return smallest;
+
+	const auto getLowerBound = [this, point](const Node& node) {
+		double distance = 0.0;
+		for (int k = 0; k < 3; ++k) {
+			const double d = std::max(
+				{ node.bounds[2 * k] - point[k], point[k] - node.bounds[2 * k + 1], 0.0 });
+			distance += d * d;
+		}
+		return node.minSize + _growthRate * std::sqrt(distance);
+	};
+
+	// Nodes are visited depth first, the closer child first
+	std::array<int, 64> stack {};
+	int stackSize = 0;
+	stack[stackSize++] = 0;
+	while (stackSize > 0) {
+		const Node& node = _nodes[stack[--stackSize]];
+		if (getLowerBound(node) > smallest.first)
+			continue;
+
+		if (node.left < 0) {
+			for (int i = node.first; i < node.first + node.count; ++i) {
+				const Source& source = _sources[i];
+				double distance = 0.0;
+				for (int k = 0; k < 3; ++k)
+					distance += (source.point[k] - point[k]) * (source.point[k] - point[k]);
+				const double size = source.size + _growthRate * std::sqrt(distance);
+				if (size < smallest.first || (size == smallest.first && i < smallest.second))
+					smallest = { size, i };
+			}
+			continue;
+		}
+
+		const bool isLeftCloser
+			= getLowerBound(_nodes[node.left]) <= getLowerBound(_nodes[node.right]);
+		stack[stackSize++] = isLeftCloser ? node.right : node.left;
+		stack[stackSize++] = isLeftCloser ? node.left : node.right;
+	}
+	return smallest;
+}
+
+//----------------------------------------------------------------------------
+double MGTMesh_SizeField::Evaluate(const double point[3]) const {
+	return this->FindSmallest(point).first;
+}
+
+//----------------------------------------------------------------------------
+void MGTMesh_SizeField::Evaluate(
+	const std::span<const double> points, const std::span<double> sizes) const {
+	vtkSMPTools::For(0, static_cast<vtkIdType>(sizes.size()), [&](vtkIdType begin, vtkIdType end) {
+		for (vtkIdType i = begin; i < end; ++i)
+			sizes[i] = this->FindSmallest(points.data() + 3 * i).first;
+	});
+}
+
+//----------------------------------------------------------------------------
+double MGTMesh_SizeField::GetMinSize() const {
+	double minSize = _maxSize;
+	for (const Source& source : _sources)
+		minSize = std::min(minSize, source.size);
+	return minSize;
+}
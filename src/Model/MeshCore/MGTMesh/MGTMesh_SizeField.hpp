@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_SizeField.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#ifndef MGTMESH_SIZEFIELD_HPP
+#define MGTMESH_SIZEFIELD_HPP
+
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <array>
+#include <span>
+#include <utility>
+#include <vector>
+
+/**
+ * Background field of element sizes defined by sizings of shapes. Vertices, edges,
+ * faces and solids are sampled into point sources and size at a point is the smallest
+ * of source sizes increased linearly by growth rate times distance to the source,
+ * limited by the maximal size. Build removes sources dominated by others and indexes
+ * the rest in a kd-tree, so that batches of points are evaluated in parallel.
+ */
+class MGTMesh_SizeField {
+public:
+	struct Source {
+		std::array<double, 3> point;
+		double size;
+	};
+
+	// Sizes are not limited if maximal size is not positive
+	MGTMesh_SizeField(double growthRate, double maxSize);
+
+	// Samples shape of any type, compounds are sampled by their sub-shapes
+	void AddSizing(const TopoDS_Shape& shape, double size);
+
+	// Adds single source, e.g. of sizes computed outside of the field
+	void AddSource(const double point[3], double size) { this->AddPoint(point, size); }
+
+	// Must be called once after sizings were added and before evaluation
+	void Build();
+
+	[[nodiscard]] bool IsEmpty() const { return _sources.empty(); }
+
+	[[nodiscard]] double Evaluate(const double point[3]) const;
+
+	// Sizes at points given by consecutive coordinates
+	void Evaluate(std::span<const double> points, std::span<double> sizes) const;
+
+	// Sources left after build, none of them is smaller anywhere than the field
+	[[nodiscard]] const std::vector<Source>& GetSources() const { return _sources; }
+	[[nodiscard]] double GetMinSize() const;
+
+	// Field grows at most by this rate times distance, so it bounds field inside a box
+	[[nodiscard]] double GetGrowthRate() const { return _growthRate; }
+
+	// Faces with sizings, meshers may limit surface elements on them directly
+	[[nodiscard]] const std::vector<std::pair<TopoDS_Face, double>>& GetFaceSizes() const {
+		return _faceSizes;
+	}
+
+private:
+	struct Node {
+		std::array<double, 6> bounds;
+		double minSize;
+		int first;
+		int count;
+		int left;
+		int right;
+	};
+
+	void AddPoint(const double point[3], double size);
+	void AddEdge(const TopoDS_Shape& edge, double size);
+	void AddFace(const TopoDS_Shape& face, double size);
+	void AddSolid(const TopoDS_Shape& solid, double size);
+
+	int BuildNode(int first, int count);
+
+	// Field value and source giving it, ties are resolved by the lowest source index
+	[[nodiscard]] std::pair<double, int> FindSmallest(const double point[3]) const;
+
+private:
+	double _growthRate;
+	double _maxSize;
+	std::vector<Source> _sources;
+	std::vector<std::pair<TopoDS_Face, double>> _faceSizes;
+	std::vector<Node> _nodes;
+};
+
+#endif
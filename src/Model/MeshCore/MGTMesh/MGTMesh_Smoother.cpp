@@ -0,0 +1,486 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_Smoother.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "MGTMesh_Smoother.hpp"
+#include "MGTMesh_MeshData.hpp"
+#include "MGTMesh_MeshObject.hpp"
+
+#include <vtkCellType.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkSMPThreadLocal.h>
+#include <vtkSMPTools.h>
+#include <vtkUnstructuredGrid.h>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <vector>
+
+namespace {
+
+using Dimension = MGTMesh_MeshData::Dimension;
+using Method = MGTMesh_Smoother::Method;
+using Point = std::array<double, 3>;
+
+// Node types, surface nodes of a single face store its ID instead
+constexpr int InnerNode = 0;
+constexpr int FixedNode = -1;
+
+// Fractions of the step towards centroid of neighbours tried in turn
+constexpr std::array<double, 3> LaplacianSteps { 1.0, 0.5, 0.25 };
+
+// Iterations of compass search and its initial step relative to mean edge length
+constexpr int SearchStepsNb = 10;
+constexpr double SearchStepSize = 0.1;
+
+constexpr double Tiny = 1e-300;
+
+// Simplices of mesh data with node adjacency, tetrahedra come before triangles
+struct Topology {
+	std::span<double> nodes;
+	std::vector<const std::int32_t*> elements;
+	std::size_t tetrahedraNb = 0;
+	// Unit normals of triangles before smoothing, their orientation must not flip
+	std::vector<double> normals;
+	// Sign of volume of valid tetrahedra
+	double orientation = 1.0;
+	std::vector<int> nodeTypes;
+	std::vector<char> isSurfaceNode;
+	std::vector<vtkIdType> elementOffsets;
+	std::vector<vtkIdType> nodeElements;
+	std::vector<vtkIdType> neighbourOffsets;
+	std::vector<std::int32_t> neighbours;
+
+	[[nodiscard]] vtkIdType GetNodesNb() const {
+		return static_cast<vtkIdType>(nodeTypes.size());
+	}
+
+	[[nodiscard]] int GetElementNodesNb(const vtkIdType element) const {
+		return static_cast<std::size_t>(element) < tetrahedraNb ? 4 : 3;
+	}
+
+	[[nodiscard]] bool IsFree(const std::int32_t node) const {
+		return nodeTypes[node] != FixedNode && elementOffsets[node + 1] > elementOffsets[node];
+	}
+
+	[[nodiscard]] std::span<const vtkIdType> GetElements(const std::int32_t node) const {
+		return std::span(nodeElements)
+			.subspan(elementOffsets[node], elementOffsets[node + 1] - elementOffsets[node]);
+	}
+
+	[[nodiscard]] std::span<const std::int32_t> GetNeighbours(const std::int32_t node) const {
+		return std::span(neighbours)
+			.subspan(neighbourOffsets[node], neighbourOffsets[node + 1] - neighbourOffsets[node]);
+	}
+};
+
+Point Subtract(const double* a, const double* b) {
+	return { a[0] - b[0], a[1] - b[1], a[2] - b[2] };
+}
+
+Point Cross(const Point& a, const Point& b) {
+	return { a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0] };
+}
+
+double Dot(const Point& a, const Point& b) {
+	return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+// Mean ratio of tetrahedron, volume scaled by edge lengths if it is inverted
+double GetTetraQuality(const std::array<const double*, 4>& p, const double orientation) {
+	const Point e01 = Subtract(p[1], p[0]);
+	const Point e02 = Subtract(p[2], p[0]);
+	const Point e03 = Subtract(p[3], p[0]);
+	const Point e12 = Subtract(p[2], p[1]);
+	const Point e13 = Subtract(p[3], p[1]);
+	const Point e23 = Subtract(p[3], p[2]);
+	const double lengths = Dot(e01, e01) + Dot(e02, e02) + Dot(e03, e03) + Dot(e12, e12)
+		+ Dot(e13, e13) + Dot(e23, e23);
+	const double volume = orientation * Dot(Cross(e01, e02), e03) / 6.0;
+	if (volume <= 0.0)
+		return volume / std::max(lengths * std::sqrt(lengths), Tiny);
+	return 12.0 * std::cbrt(9.0 * volume * volume) / std::max(lengths, Tiny);
+}
+
+// Mean ratio of triangle, area is signed with respect to the reference normal
+double GetTriangleQuality(const std::array<const double*, 4>& p, const double* normal) {
+	const Point e01 = Subtract(p[1], p[0]);
+	const Point e02 = Subtract(p[2], p[0]);
+	const Point e12 = Subtract(p[2], p[1]);
+	const double lengths = Dot(e01, e01) + Dot(e02, e02) + Dot(e12, e12);
+	const double area = 0.5 * Dot(Cross(e01, e02), { normal[0], normal[1], normal[2] });
+	if (area <= 0.0)
+		return area / std::max(lengths, Tiny);
+	return 4.0 * std::sqrt(3.0) * area / std::max(lengths, Tiny);
+}
+
+double GetElementQuality(const Topology& topology, const vtkIdType element,
+	const std::int32_t movedNode, const double* position) {
+	const std::int32_t* elementNodes = topology.elements[element];
+	std::array<const double*, 4> p {};
+	for (int j = 0; j < topology.GetElementNodesNb(element); ++j) {
+		p[j] = elementNodes[j] == movedNode ? position
+											: topology.nodes.data() + 3 * elementNodes[j];
+	}
+	if (static_cast<std::size_t>(element) < topology.tetrahedraNb)
+		return GetTetraQuality(p, topology.orientation);
+	return GetTriangleQuality(
+		p, topology.normals.data() + 3 * (element - topology.tetrahedraNb));
+}
+
+// Worst element around the node placed at given position
+double GetStarQuality(
+	const Topology& topology, const std::int32_t node, const double* position) {
+	double quality = std::numeric_limits<double>::max();
+	for (const vtkIdType element : topology.GetElements(node))
+		quality = std::min(quality, GetElementQuality(topology, element, node, position));
+	return quality;
+}
+
+double GetMinQuality(const Topology& topology) {
+	vtkSMPThreadLocal<double> localQuality(std::numeric_limits<double>::max());
+	vtkSMPTools::For(0, static_cast<vtkIdType>(topology.elements.size()),
+		[&](vtkIdType begin, vtkIdType end) {
+			double& quality = localQuality.Local();
+			for (vtkIdType element = begin; element < end; ++element) {
+				quality = std::min(quality, GetElementQuality(topology, element, -1, nullptr));
+			}
+		});
+
+	double quality = std::numeric_limits<double>::max();
+	for (const double value : localQuality)
+		quality = std::min(quality, value);
+	return quality;
+}
+
+// Lists simplices and fixes nodes of other elements, nodes on face boundaries and
+// surface nodes that cannot be projected
+Topology BuildTopology(MGTMesh_MeshData* meshData, const bool hasProjection) {
+	Topology topology;
+	topology.nodes = meshData->GetMutableNodes();
+	const vtkIdType nodesNb = meshData->GetNumberOfNodes();
+	topology.nodeTypes.assign(nodesNb, InnerNode);
+	topology.isSurfaceNode.assign(nodesNb, 0);
+
+	const auto collectElements = [&](const Dimension dimension, const int simplexType) {
+		const std::span<const std::int32_t> connectivity = meshData->GetConnectivity(dimension);
+		vtkIdType offset = 0;
+		for (const MGTMesh_MeshData::ElementBlock& block : meshData->GetBlocks(dimension)) {
+			for (vtkIdType i = 0; i < block.elementsNb; ++i) {
+				const std::int32_t* elementNodes = connectivity.data() + offset + i * block.nodesNb;
+				if (block.cellType == simplexType) {
+					topology.elements.push_back(elementNodes);
+					continue;
+				}
+				for (int j = 0; j < block.nodesNb; ++j)
+					topology.nodeTypes[elementNodes[j]] = FixedNode;
+			}
+			offset += block.elementsNb * block.nodesNb;
+		}
+	};
+	collectElements(Dimension::Volume, VTK_TETRA);
+	topology.tetrahedraNb = topology.elements.size();
+	collectElements(Dimension::Surface, VTK_TRIANGLE);
+
+	const std::span<const std::int32_t> surfaceConnectivity
+		= meshData->GetConnectivity(Dimension::Surface);
+	const std::span<const std::int32_t> faceIds = meshData->GetTags(Dimension::Surface);
+	vtkIdType offset = 0;
+	for (const MGTMesh_MeshData::ElementBlock& block : meshData->GetBlocks(Dimension::Surface)) {
+		for (vtkIdType i = 0; i < block.elementsNb; ++i) {
+			const int faceId = faceIds[block.firstElement + i];
+			for (int j = 0; j < block.nodesNb; ++j) {
+				const std::int32_t node = surfaceConnectivity[offset + i * block.nodesNb + j];
+				int& nodeType = topology.nodeTypes[node];
+				if (nodeType == InnerNode && !topology.isSurfaceNode[node])
+					nodeType = faceId > 0 && hasProjection ? faceId : FixedNode;
+				else if (nodeType != faceId)
+					nodeType = FixedNode;
+				topology.isSurfaceNode[node] = 1;
+			}
+		}
+		offset += block.elementsNb * block.nodesNb;
+	}
+
+	const auto getPoint = [&topology](const std::int32_t node) {
+		return topology.nodes.data() + 3 * static_cast<std::size_t>(node);
+	};
+
+	double volume = 0.0;
+	for (std::size_t element = 0; element < topology.tetrahedraNb; ++element) {
+		const std::int32_t* n = topology.elements[element];
+		volume += Dot(Cross(Subtract(getPoint(n[1]), getPoint(n[0])),
+						  Subtract(getPoint(n[2]), getPoint(n[0]))),
+			Subtract(getPoint(n[3]), getPoint(n[0])));
+	}
+	topology.orientation = volume < 0.0 ? -1.0 : 1.0;
+
+	const std::size_t trianglesNb = topology.elements.size() - topology.tetrahedraNb;
+	topology.normals.resize(3 * trianglesNb);
+	for (std::size_t i = 0; i < trianglesNb; ++i) {
+		const std::int32_t* n = topology.elements[topology.tetrahedraNb + i];
+		const Point normal = Cross(Subtract(getPoint(n[1]), getPoint(n[0])),
+			Subtract(getPoint(n[2]), getPoint(n[0])));
+		const double length = std::max(std::sqrt(Dot(normal, normal)), Tiny);
+		for (int k = 0; k < 3; ++k)
+			topology.normals[3 * i + k] = normal[k] / length;
+	}
+
+	// Elements of each node
+	topology.elementOffsets.assign(nodesNb + 1, 0);
+	for (std::size_t element = 0; element < topology.elements.size(); ++element) {
+		for (int j = 0; j < topology.GetElementNodesNb(static_cast<vtkIdType>(element)); ++j)
+			++topology.elementOffsets[topology.elements[element][j] + 1];
+	}
+	std::partial_sum(topology.elementOffsets.begin(), topology.elementOffsets.end(),
+		topology.elementOffsets.begin());
+	topology.nodeElements.resize(topology.elementOffsets.back());
+	std::vector<vtkIdType> positions(
+		topology.elementOffsets.begin(), topology.elementOffsets.end() - 1);
+	for (std::size_t element = 0; element < topology.elements.size(); ++element) {
+		for (int j = 0; j < topology.GetElementNodesNb(static_cast<vtkIdType>(element)); ++j)
+			topology.nodeElements[positions[topology.elements[element][j]]++]
+				= static_cast<vtkIdType>(element);
+	}
+
+	// Neighbours of free nodes, counted in the first pass and stored in the second one
+	vtkSMPThreadLocal<std::vector<std::int32_t>> localNeighbours;
+	const auto gatherNeighbours = [&topology](
+									  const std::int32_t node, std::vector<std::int32_t>& neighbours) {
+		neighbours.clear();
+		for (const vtkIdType element : topology.GetElements(node)) {
+			for (int j = 0; j < topology.GetElementNodesNb(element); ++j) {
+				if (topology.elements[element][j] != node)
+					neighbours.push_back(topology.elements[element][j]);
+			}
+		}
+		std::ranges::sort(neighbours);
+		neighbours.erase(std::ranges::unique(neighbours).begin(), neighbours.end());
+	};
+
+	topology.neighbourOffsets.assign(nodesNb + 1, 0);
+	vtkSMPTools::For(0, nodesNb, [&](vtkIdType begin, vtkIdType end) {
+		std::vector<std::int32_t>& neighbours = localNeighbours.Local();
+		for (vtkIdType node = begin; node < end; ++node) {
+			if (topology.IsFree(static_cast<std::int32_t>(node))) {
+				gatherNeighbours(static_cast<std::int32_t>(node), neighbours);
+				topology.neighbourOffsets[node + 1] = static_cast<vtkIdType>(neighbours.size());
+			}
+		}
+	});
+	std::partial_sum(topology.neighbourOffsets.begin(), topology.neighbourOffsets.end(),
+		topology.neighbourOffsets.begin());
+	topology.neighbours.resize(topology.neighbourOffsets.back());
+	vtkSMPTools::For(0, nodesNb, [&](vtkIdType begin, vtkIdType end) {
+		std::vector<std::int32_t>& neighbours = localNeighbours.Local();
+		for (vtkIdType node = begin; node < end; ++node) {
+			if (topology.IsFree(static_cast<std::int32_t>(node))) {
+				gatherNeighbours(static_cast<std::int32_t>(node), neighbours);
+				std::ranges::copy(
+					neighbours, topology.neighbours.begin() + topology.neighbourOffsets[node]);
+			}
+		}
+	});
+	return topology;
+}
+
+// Greedy colouring of free nodes, nodes of the same colour are not neighbours
+std::vector<std::vector<std::int32_t>> ColourNodes(const Topology& topology) {
+	std::vector<int> colours(topology.GetNodesNb(), -1);
+	std::vector<std::int32_t> usedBy;
+	std::vector<std::vector<std::int32_t>> classes;
+	for (std::int32_t node = 0; node < topology.GetNodesNb(); ++node) {
+		if (!topology.IsFree(node))
+			continue;
+
+		for (const std::int32_t neighbour : topology.GetNeighbours(node)) {
+			if (colours[neighbour] >= 0)
+				usedBy[colours[neighbour]] = node;
+		}
+		int colour = 0;
+		while (colour < static_cast<int>(usedBy.size()) && usedBy[colour] == node)
+			++colour;
+		if (colour == static_cast<int>(usedBy.size())) {
+			usedBy.push_back(-1);
+			classes.emplace_back();
+		}
+		colours[node] = colour;
+		classes[colour].push_back(node);
+	}
+	return classes;
+}
+
+// Moves the node if its new position is accepted by the method, returns true if moved
+bool SmoothNode(const Topology& topology, const std::int32_t node, const Method method,
+	const double targetQuality, const MGTMesh_Smoother::Projection& projection) {
+	double* position = topology.nodes.data() + 3 * static_cast<std::size_t>(node);
+	const int nodeType = topology.nodeTypes[node];
+	const auto evaluate = [&](Point& candidate) {
+		if (nodeType != InnerNode && !projection(nodeType, candidate.data()))
+			return std::numeric_limits<double>::lowest();
+		return GetStarQuality(topology, node, candidate.data());
+	};
+
+	// Surface nodes are pulled by their neighbours on the surface only
+	Point centroid { 0.0, 0.0, 0.0 };
+	int centroidNodesNb = 0;
+	double meanDistance = 0.0;
+	const std::span<const std::int32_t> neighbours = topology.GetNeighbours(node);
+	for (const std::int32_t neighbour : neighbours) {
+		const double* p = topology.nodes.data() + 3 * static_cast<std::size_t>(neighbour);
+		const Point edge = Subtract(p, position);
+		meanDistance += std::sqrt(Dot(edge, edge));
+		if (nodeType != InnerNode && !topology.isSurfaceNode[neighbour])
+			continue;
+		for (int k = 0; k < 3; ++k)
+			centroid[k] += p[k];
+		++centroidNodesNb;
+	}
+	if (centroidNodesNb == 0)
+		return false;
+	meanDistance /= static_cast<double>(neighbours.size());
+
+	double quality = GetStarQuality(topology, node, position);
+	bool isMoved = false;
+	for (const double step : LaplacianSteps) {
+		Point candidate;
+		for (int k = 0; k < 3; ++k)
+			candidate[k] = position[k] + step * (centroid[k] / centroidNodesNb - position[k]);
+
+		const double candidateQuality = evaluate(candidate);
+		const bool isAccepted = candidateQuality > quality
+			|| (method == Method::Laplacian && candidateQuality > 0.0);
+		if (isAccepted) {
+			std::ranges::copy(candidate, position);
+			quality = candidateQuality;
+			isMoved = true;
+			break;
+		}
+	}
+
+	if (method != Method::Smart || quality >= targetQuality)
+		return isMoved;
+
+	// Compass search maximizing the worst element around the node
+	double step = SearchStepSize * meanDistance;
+	for (int i = 0; i < SearchStepsNb; ++i) {
+		Point best;
+		double bestQuality = quality;
+		for (int axis = 0; axis < 3; ++axis) {
+			for (const double direction : { -1.0, 1.0 }) {
+				Point candidate { position[0], position[1], position[2] };
+				candidate[axis] += direction * step;
+				if (const double candidateQuality = evaluate(candidate);
+					candidateQuality > bestQuality) {
+					best = candidate;
+					bestQuality = candidateQuality;
+				}
+			}
+		}
+
+		if (bestQuality > quality) {
+			std::ranges::copy(best, position);
+			quality = bestQuality;
+			isMoved = true;
+		} else {
+			step *= 0.5;
+		}
+	}
+	return isMoved;
+}
+
+}
+
+//----------------------------------------------------------------------------
+MGTMesh_Smoother::MGTMesh_Smoother(const Method method)
+	: _method(method)
+	, _iterationsNb(10)
+	, _targetQuality(0.3)
+	, _initialQuality(0.0)
+	, _finalQuality(0.0) { }
+
+//----------------------------------------------------------------------------
+bool MGTMesh_Smoother::Smooth(MGTMesh_MeshObject* mesh) {
+	const vtkSmartPointer<MGTMesh_MeshData> meshData = mesh ? mesh->GetMeshData() : nullptr;
+	if (!meshData) {
+		SPDLOG_ERROR("Smoothing requires native data of generated mesh");
+		return false;
+	}
+
+	const Topology topology = BuildTopology(meshData, static_cast<bool>(_projection));
+	if (topology.elements.empty()) {
+		SPDLOG_WARN("Mesh has no tetrahedra or triangles to smooth");
+		return false;
+	}
+
+	const std::vector<std::vector<std::int32_t>> classes = ColourNodes(topology);
+	_initialQuality = _finalQuality = GetMinQuality(topology);
+	SPDLOG_INFO("Smoothing nodes in {} colour classes, worst element mean ratio: {:.4g}",
+		classes.size(), _initialQuality);
+
+	for (int iteration = 0; iteration < _iterationsNb && _finalQuality < _targetQuality;
+		++iteration) {
+		vtkSMPThreadLocal<vtkIdType> localMovedNb(0);
+		for (const std::vector<std::int32_t>& nodes : classes) {
+			vtkSMPTools::For(0, static_cast<vtkIdType>(nodes.size()),
+				[&](vtkIdType begin, vtkIdType end) {
+					vtkIdType& movedNb = localMovedNb.Local();
+					for (vtkIdType i = begin; i < end; ++i) {
+						if (SmoothNode(topology, nodes[i], _method, _targetQuality, _projection))
+							++movedNb;
+					}
+				});
+		}
+
+		vtkIdType movedNb = 0;
+		for (const vtkIdType value : localMovedNb)
+			movedNb += value;
+		_finalQuality = GetMinQuality(topology);
+		spdlog::debug("Smoothing sweep {}: {} nodes moved, worst element mean ratio: {:.4g}",
+			iteration + 1, movedNb, _finalQuality);
+		if (movedNb == 0)
+			break;
+	}
+
+	// Views of mesh data share node coordinates, they only need to be updated
+	meshData->Modified();
+	const vtkSmartPointer<vtkUnstructuredGrid> grid = mesh->GetInternalMesh();
+	if (grid && grid->GetPoints())
+		grid->GetPoints()->Modified();
+	const vtkSmartPointer<vtkPolyData> boundary = mesh->GetBoundaryMesh();
+	if (boundary && boundary->GetPoints())
+		boundary->GetPoints()->Modified();
+	mesh->Modified();
+
+	SPDLOG_INFO("Smoothing finished, worst element mean ratio: {:.4g} -> {:.4g}",
+		_initialQuality, _finalQuality);
+	return true;
+}
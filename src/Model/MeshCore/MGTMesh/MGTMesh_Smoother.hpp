@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_Smoother.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#ifndef MGTMESH_SMOOTHER_HPP
+#define MGTMESH_SMOOTHER_HPP
+
+#include <functional>
+#include <utility>
+
+class MGTMesh_MeshObject;
+
+/**
+ * Smoothing of tetrahedral and triangular meshes stored in native mesh data. Nodes
+ * are moved in sweeps over colour classes of the node adjacency graph. Nodes of one
+ * class share no element, so each class is processed in parallel. Surface nodes of
+ * a single geometric face are projected back onto it, nodes on face boundaries and
+ * nodes of other than simplex elements stay fixed. Element quality is measured by
+ * mean ratio, 1 for regular elements and non-positive for inverted ones.
+ */
+class MGTMesh_Smoother {
+public:
+	// Laplacian smoothing moves nodes to the centroid of their neighbours unless an
+	// element gets inverted. Smart smoothing accepts only moves that improve the worst
+	// element around the node and optimizes position of nodes of elements below the
+	// target quality.
+	enum class Method { Laplacian, Smart };
+
+	// Moves point onto geometric face with given ID, false if it could not be projected.
+	// It is called concurrently.
+	using Projection = std::function<bool(int faceId, double point[3])>;
+
+	explicit MGTMesh_Smoother(Method method = Method::Smart);
+
+	void SetIterationsNumber(int iterationsNb) { _iterationsNb = iterationsNb; }
+	void SetTargetQuality(double targetQuality) { _targetQuality = targetQuality; }
+
+	// Surface nodes are fixed without projection
+	void SetProjection(Projection projection) { _projection = std::move(projection); }
+
+	// Stops once the worst element reaches the target quality, returns false if mesh
+	// has no native data
+	bool Smooth(MGTMesh_MeshObject* mesh);
+
+	[[nodiscard]] double GetInitialQuality() const { return _initialQuality; }
+	[[nodiscard]] double GetFinalQuality() const { return _finalQuality; }
+
+private:
+	Method _method;
+	int _iterationsNb;
+	double _targetQuality;
+	Projection _projection;
+	double _initialQuality;
+	double _finalQuality;
+};
+
+#endif
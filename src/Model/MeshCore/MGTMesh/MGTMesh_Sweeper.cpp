@@ -0,0 +1,682 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_Sweeper.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "MGTMesh_Sweeper.hpp"
+#include "MGTMeshUtils_ComputeError.hpp"
+#include "MGTMesh_MeshData.hpp"
+#include "MGTMesh_MeshObject.hpp"
+#include "MGTMesh_Renumbering.hpp"
+#include "NetgenPlugin_Mesher.hpp"
+#include "NetgenPlugin_Parameters.hpp"
+
+#include <BRepAdaptor_Surface.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_MakeEdge.hxx>
+#include <BRepBuilderAPI_MakeVertex.hxx>
+#include <BRepExtrema_DistShapeShape.hxx>
+#include <BRepGProp.hxx>
+#include <BRep_Tool.hxx>
+#include <Bnd_Box.hxx>
+#include <ElCLib.hxx>
+#include <GProp_GProps.hxx>
+#include <IntAna_QuadQuadGeo.hxx>
+#include <Standard_Failure.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Vertex.hxx>
+#include <gp_Lin.hxx>
+#include <gp_Pln.hxx>
+#include <gp_XYZ.hxx>
+
+#include <vtkCellType.h>
+#include <vtkNew.h>
+#include <vtkSMPTools.h>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <unordered_map>
+
+namespace {
+
+constexpr double AngularTolerance = 1e-6;
+
+// Tolerance of lengths, areas and volumes relative to the size of the solid
+constexpr double RelativeTolerance = 1e-4;
+
+struct PlanarFace {
+	TopoDS_Face face;
+	gp_Pln plane;
+	gp_Pnt centroid;
+	double area;
+	int edgesNb;
+};
+
+// Mesh of the source face with element nodes ordered so that normals point along the
+// sweep, boundary edges follow the order of nodes of their elements
+struct SourceMesh {
+	std::vector<double> nodes;
+	std::vector<std::int32_t> quadrangles;
+	std::vector<std::int32_t> triangles;
+	std::vector<std::array<std::int32_t, 2>> boundaryEdges;
+	// Face IDs of side faces swept by the boundary edges
+	std::vector<int> boundaryTags;
+	int layersNb;
+};
+
+//----------------------------------------------------------------------------
+gp_XYZ NodePoint(std::span<const double> nodes, const std::int32_t node) {
+	return { nodes[3 * node], nodes[3 * node + 1], nodes[3 * node + 2] };
+}
+
+//----------------------------------------------------------------------------
+gp_Vec RadiusVector(const gp_Ax1& axis, const gp_Pnt& point) {
+	const gp_Vec toPoint(axis.Location(), point);
+	const gp_Vec direction(axis.Direction());
+	return toPoint - direction * toPoint.Dot(direction);
+}
+
+//----------------------------------------------------------------------------
+gp_Vec SweepDirection(const MGTMesh_Sweeper::Sweep& sweep, const gp_Pnt& point) {
+	if (!sweep.isRevolution)
+		return sweep.direction;
+	return gp_Vec(sweep.axis.Direction()).Crossed(RadiusVector(sweep.axis, point));
+}
+
+//----------------------------------------------------------------------------
+bool IsCoaxial(const gp_Ax1& axis, const gp_Ax1& other, const double tolerance) {
+	return axis.Direction().IsParallel(other.Direction(), AngularTolerance)
+		&& gp_Lin(axis).Distance(other.Location()) < tolerance;
+}
+
+//----------------------------------------------------------------------------
+bool IsRuledAlong(const TopoDS_Face& face, const gp_Dir& direction) {
+	const BRepAdaptor_Surface surface(face);
+	switch (surface.GetType()) {
+	case GeomAbs_Plane:
+		return surface.Plane().Axis().Direction().IsNormal(direction, AngularTolerance);
+	case GeomAbs_Cylinder:
+		return surface.Cylinder().Axis().Direction().IsParallel(direction, AngularTolerance);
+	case GeomAbs_SurfaceOfExtrusion:
+		return surface.Direction().IsParallel(direction, AngularTolerance);
+	default:
+		return false;
+	}
+}
+
+//----------------------------------------------------------------------------
+bool IsRevolvedAbout(const TopoDS_Face& face, const gp_Ax1& axis, const double tolerance) {
+	const BRepAdaptor_Surface surface(face);
+	switch (surface.GetType()) {
+	case GeomAbs_Plane:
+		return surface.Plane().Axis().Direction().IsParallel(
+			axis.Direction(), AngularTolerance);
+	case GeomAbs_Cylinder:
+		return IsCoaxial(axis, surface.Cylinder().Axis(), tolerance);
+	case GeomAbs_Cone:
+		return IsCoaxial(axis, surface.Cone().Axis(), tolerance);
+	case GeomAbs_Sphere:
+		return gp_Lin(axis).Distance(surface.Sphere().Location()) < tolerance;
+	case GeomAbs_Torus:
+		return IsCoaxial(axis, surface.Torus().Axis(), tolerance);
+	case GeomAbs_SurfaceOfRevolution:
+		return IsCoaxial(axis, surface.AxeOfRevolution(), tolerance);
+	default:
+		return false;
+	}
+}
+
+//----------------------------------------------------------------------------
+// Checks that the face keeps off the axis, axis segment centred at the face centroid is
+// long enough to pass by the whole face
+bool IsOffAxis(const gp_Ax1& axis, const PlanarFace& face, const double length,
+	const double tolerance) {
+	const gp_Lin line(axis);
+	const double middle = ElCLib::Parameter(line, face.centroid);
+	const BRepBuilderAPI_MakeEdge axisEdge(line, middle - length, middle + length);
+	if (!axisEdge.IsDone())
+		return false;
+	const BRepExtrema_DistShapeShape distance(axisEdge.Edge(), face.face);
+	return distance.IsDone() && distance.Value() > tolerance;
+}
+
+//----------------------------------------------------------------------------
+std::vector<PlanarFace> GetPlanarFaces(const TopTools_IndexedMapOfShape& faces) {
+	std::vector<PlanarFace> planarFaces;
+	for (int i = 1; i <= faces.Extent(); ++i) {
+		const TopoDS_Face& face = TopoDS::Face(faces(i));
+		const BRepAdaptor_Surface surface(face);
+		if (surface.GetType() != GeomAbs_Plane)
+			continue;
+
+		GProp_GProps properties;
+		BRepGProp::SurfaceProperties(face, properties);
+		TopTools_IndexedMapOfShape edges;
+		TopExp::MapShapes(face, TopAbs_EDGE, edges);
+		planarFaces.push_back({ face, surface.Plane(), properties.CentreOfMass(),
+			properties.Mass(), edges.Extent() });
+	}
+	return planarFaces;
+}
+
+//----------------------------------------------------------------------------
+// Reverses order of element nodes if its normal points against the sweep
+void OrientElement(const MGTMesh_Sweeper::Sweep& sweep, std::span<const double> nodes,
+	std::span<std::int32_t> element) {
+	gp_XYZ normal;
+	gp_XYZ centroid;
+	for (std::size_t i = 0; i < element.size(); ++i) {
+		const gp_XYZ p = NodePoint(nodes, element[i]);
+		const gp_XYZ q = NodePoint(nodes, element[(i + 1) % element.size()]);
+		normal += gp_XYZ((p.Y() - q.Y()) * (p.Z() + q.Z()), (p.Z() - q.Z()) * (p.X() + q.X()),
+			(p.X() - q.X()) * (p.Y() + q.Y()));
+		centroid += p;
+	}
+	centroid /= static_cast<double>(element.size());
+	if (normal.Dot(SweepDirection(sweep, gp_Pnt(centroid)).XYZ()) < 0)
+		std::reverse(element.begin() + 1, element.end());
+}
+
+//----------------------------------------------------------------------------
+// Meshes the source face by Netgen with quadrangles allowed
+int MeshSource(const MGTMesh_Sweeper::Sweep& sweep, const MGTMesh_Algorithm& algorithm,
+	SourceMesh& mesh) {
+	MGTMesh_Algorithm faceAlgorithm(algorithm);
+	faceAlgorithm.SetType(MGTMesh_Scheme::ALG_2D);
+	faceAlgorithm.quadAllowed = true;
+	faceAlgorithm.secondOrder = false;
+	faceAlgorithm.renumber = false;
+	const NetgenPlugin_Parameters parameters(faceAlgorithm);
+
+	vtkNew<MGTMesh_MeshObject> faceMesh;
+	NetgenPlugin_Mesher mesher(faceMesh.Get(), sweep.source, &parameters);
+	if (const int result = mesher.ComputeMesh(); result != COMPERR_OK)
+		return result;
+
+	const vtkSmartPointer<MGTMesh_MeshData> meshData = faceMesh->GetMeshData();
+	if (!meshData)
+		return COMPERR_ALGO_FAILED;
+
+	constexpr auto Surface = MGTMesh_MeshData::Dimension::Surface;
+	const std::span<const std::int32_t> connectivity = meshData->GetConnectivity(Surface);
+	mesh.nodes.assign(meshData->GetNodes().begin(), meshData->GetNodes().end());
+	std::size_t offset = 0;
+	for (const MGTMesh_MeshData::ElementBlock& block : meshData->GetBlocks(Surface)) {
+		const std::size_t valuesNb = block.elementsNb * block.nodesNb;
+		std::vector<std::int32_t>& elements
+			= block.cellType == VTK_QUAD ? mesh.quadrangles : mesh.triangles;
+		elements.insert(elements.end(), connectivity.begin() + offset,
+			connectivity.begin() + offset + valuesNb);
+		offset += valuesNb;
+	}
+
+	const auto orient = [&](std::vector<std::int32_t>& elements, const int nodesNb) {
+		const auto elementsNb = static_cast<vtkIdType>(elements.size() / nodesNb);
+		vtkSMPTools::For(0, elementsNb, [&](vtkIdType begin, vtkIdType end) {
+			for (vtkIdType i = begin; i < end; ++i)
+				OrientElement(sweep, mesh.nodes,
+					std::span(elements).subspan(i * nodesNb, nodesNb));
+		});
+	};
+	orient(mesh.quadrangles, 4);
+	orient(mesh.triangles, 3);
+	return COMPERR_OK;
+}
+
+//----------------------------------------------------------------------------
+// Finds boundary edges of the source mesh and number of layers giving elements as long
+// along the sweep as the mean length of source mesh edges
+void FindBoundary(const MGTMesh_Sweeper::Sweep& sweep, SourceMesh& mesh) {
+	std::unordered_map<std::uint64_t, int> edgeCounts;
+	double lengthsSum = 0;
+	const auto forEachEdge = [&](const auto& function) {
+		for (const auto& [elements, nodesNb] :
+			{ std::pair(&mesh.quadrangles, 4), std::pair(&mesh.triangles, 3) }) {
+			for (std::size_t first = 0; first < elements->size(); first += nodesNb) {
+				for (int i = 0; i < nodesNb; ++i)
+					function((*elements)[first + i], (*elements)[first + (i + 1) % nodesNb]);
+			}
+		}
+	};
+	const auto edgeKey = [](const std::int32_t a, const std::int32_t b) {
+		return static_cast<std::uint64_t>(std::min(a, b)) << 32
+			| static_cast<std::uint32_t>(std::max(a, b));
+	};
+
+	std::size_t edgesNb = 0;
+	forEachEdge([&](const std::int32_t a, const std::int32_t b) {
+		++edgeCounts[edgeKey(a, b)];
+		lengthsSum += (NodePoint(mesh.nodes, a) - NodePoint(mesh.nodes, b)).Modulus();
+		++edgesNb;
+	});
+	forEachEdge([&](const std::int32_t a, const std::int32_t b) {
+		if (edgeCounts[edgeKey(a, b)] == 1)
+			mesh.boundaryEdges.push_back({ a, b });
+	});
+
+	const double meanLength = edgesNb ? lengthsSum / edgesNb : sweep.length;
+	mesh.layersNb = std::max(1, static_cast<int>(std::lround(sweep.length / meanLength)));
+}
+
+//----------------------------------------------------------------------------
+// Tags boundary edges with IDs of the nearest side faces in the middle of the first layer.
+// Boundary is split by nodes at vertices of the source face into segments lying on one
+// edge each, so that only one mesh edge of every segment is classified.
+void TagBoundary(const MGTMesh_Sweeper::Sweep& sweep, const TopoDS_Shape& solid,
+	const TopTools_IndexedMapOfShape& faces, SourceMesh& mesh) {
+	std::vector<TopoDS_Shape> sideFaces;
+	for (TopExp_Explorer it(solid, TopAbs_FACE); it.More(); it.Next()) {
+		if (!it.Current().IsSame(sweep.source) && !it.Current().IsSame(sweep.target))
+			sideFaces.push_back(it.Current());
+	}
+
+	const gp_Trsf halfLayer = MGTMesh_Sweeper::GetTransformation(sweep, 0.5 / mesh.layersNb);
+	const auto findSideFace = [&](const std::array<std::int32_t, 2>& edge) {
+		const gp_Pnt middle
+			= gp_Pnt((NodePoint(mesh.nodes, edge[0]) + NodePoint(mesh.nodes, edge[1])) / 2);
+		const TopoDS_Vertex vertex = BRepBuilderAPI_MakeVertex(middle.Transformed(halfLayer));
+
+		int tag = 0;
+		double minDistance = std::numeric_limits<double>::max();
+		for (const TopoDS_Shape& face : sideFaces) {
+			BRepExtrema_DistShapeShape distance(vertex, face);
+			if (distance.IsDone() && distance.Value() < minDistance) {
+				minDistance = distance.Value();
+				tag = faces.FindIndex(face);
+			}
+		}
+		return tag;
+	};
+
+	// Nodes at vertices are closer to them than a fraction of the shortest boundary edge
+	double minLength = std::numeric_limits<double>::max();
+	std::unordered_map<std::int32_t, std::size_t> outgoingEdges;
+	for (std::size_t i = 0; i < mesh.boundaryEdges.size(); ++i) {
+		const auto [a, b] = mesh.boundaryEdges[i];
+		minLength
+			= std::min(minLength, (NodePoint(mesh.nodes, a) - NodePoint(mesh.nodes, b)).Modulus());
+		outgoingEdges.emplace(a, i);
+	}
+	std::vector<gp_XYZ> vertices;
+	for (TopExp_Explorer it(sweep.source, TopAbs_VERTEX); it.More(); it.Next())
+		vertices.push_back(BRep_Tool::Pnt(TopoDS::Vertex(it.Current())).XYZ());
+	const auto isAtVertex = [&](const std::int32_t node) {
+		return std::ranges::any_of(vertices, [&](const gp_XYZ& vertex) {
+			return (vertex - NodePoint(mesh.nodes, node)).Modulus() < 0.1 * minLength;
+		});
+	};
+
+	mesh.boundaryTags.assign(mesh.boundaryEdges.size(), 0);
+	std::vector<char> isTagged(mesh.boundaryEdges.size(), 0);
+	std::vector<std::size_t> segment;
+	for (std::size_t first = 0; first < mesh.boundaryEdges.size(); ++first) {
+		if (isTagged[first] || !isAtVertex(mesh.boundaryEdges[first][0]))
+			continue;
+
+		segment.clear();
+		for (std::size_t edge = first;;) {
+			segment.push_back(edge);
+			isTagged[edge] = 1;
+			const std::int32_t next = mesh.boundaryEdges[edge][1];
+			const auto outgoing = outgoingEdges.find(next);
+			if (isAtVertex(next) || outgoing == outgoingEdges.end() || isTagged[outgoing->second])
+				break;
+			edge = outgoing->second;
+		}
+		const int tag = findSideFace(mesh.boundaryEdges[segment[segment.size() / 2]]);
+		for (const std::size_t edge : segment)
+			mesh.boundaryTags[edge] = tag;
+	}
+
+	// Loops without nodes at vertices
+	for (std::size_t i = 0; i < mesh.boundaryEdges.size(); ++i) {
+		if (!isTagged[i])
+			mesh.boundaryTags[i] = findSideFace(mesh.boundaryEdges[i]);
+	}
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------
+MGTMesh_Sweeper::MGTMesh_Sweeper(
+	const TopoDS_Shape& shape, const MGTMesh_Algorithm& algorithm)
+	: _shape(shape)
+	, _algorithm(algorithm) { }
+
+//----------------------------------------------------------------------------
+std::optional<MGTMesh_Sweeper::Sweep> MGTMesh_Sweeper::FindSweep(const TopoDS_Shape& solid) {
+	TopTools_IndexedMapOfShape faces;
+	TopExp::MapShapes(solid, TopAbs_FACE, faces);
+	const std::vector<PlanarFace> planarFaces = GetPlanarFaces(faces);
+
+	Bnd_Box box;
+	BRepBndLib::Add(solid, box);
+	const double tolerance = RelativeTolerance * std::sqrt(box.SquareExtent());
+
+	GProp_GProps properties;
+	BRepGProp::VolumeProperties(solid, properties);
+	const double volume = std::abs(properties.Mass());
+
+	const auto isSideRuled = [&](const PlanarFace& source, const PlanarFace& target,
+								 const auto& isRuled) {
+		for (int i = 1; i <= faces.Extent(); ++i) {
+			if (faces(i).IsSame(source.face) || faces(i).IsSame(target.face))
+				continue;
+			if (!isRuled(TopoDS::Face(faces(i))))
+				return false;
+		}
+		return true;
+	};
+
+	// Extrusions are looked for first, since end faces of prisms may be related by
+	// rotation too
+	for (const bool isRevolution : { false, true }) {
+		for (std::size_t i = 0; i < planarFaces.size(); ++i) {
+			for (std::size_t j = i + 1; j < planarFaces.size(); ++j) {
+				const PlanarFace& source = planarFaces[i];
+				const PlanarFace& target = planarFaces[j];
+				if (source.edgesNb != target.edgesNb
+					|| std::abs(source.area - target.area) > RelativeTolerance * source.area)
+					continue;
+
+				const gp_Dir& normal = source.plane.Axis().Direction();
+				if (normal.IsParallel(target.plane.Axis().Direction(), AngularTolerance)
+					== isRevolution)
+					continue;
+
+				if (!isRevolution) {
+					const gp_Vec direction(source.centroid, target.centroid);
+					const double height = std::abs(direction.Dot(gp_Vec(normal)));
+					if (height < tolerance
+						|| std::abs(volume - source.area * height) > RelativeTolerance * volume
+						|| !isSideRuled(source, target, [&](const TopoDS_Face& face) {
+							   return IsRuledAlong(face, gp_Dir(direction));
+						   }))
+						continue;
+					return Sweep { source.face, target.face, false, direction, gp_Ax1(), 0,
+						direction.Magnitude() };
+				}
+
+				const IntAna_QuadQuadGeo intersection(
+					source.plane, target.plane, AngularTolerance, tolerance);
+				if (!intersection.IsDone() || intersection.TypeInter() != IntAna_Line)
+					continue;
+
+				gp_Ax1 axis = intersection.Line(1).Position();
+				const gp_Vec sourceRadius = RadiusVector(axis, source.centroid);
+				const double radius = sourceRadius.Magnitude();
+				if (radius < tolerance)
+					continue;
+
+				double angle = sourceRadius.AngleWithRef(
+					RadiusVector(axis, target.centroid), gp_Vec(axis.Direction()));
+				if (angle < 0) {
+					axis.Reverse();
+					angle = -angle;
+				}
+				gp_Trsf rotation;
+				rotation.SetRotation(axis, angle);
+				if (source.centroid.Transformed(rotation).Distance(target.centroid) > tolerance
+					|| std::abs(volume - source.area * radius * angle) > RelativeTolerance * volume
+					|| !isSideRuled(source, target, [&](const TopoDS_Face& face) {
+						   return IsRevolvedAbout(face, axis, tolerance);
+					   }))
+					continue;
+
+				// Profiles touching the axis would give elements collapsed on it, such
+				// solids are left to the mesher
+				if (!IsOffAxis(axis, source, std::sqrt(box.SquareExtent()), tolerance))
+					continue;
+				return Sweep { source.face, target.face, true, gp_Vec(), axis, angle,
+					radius * angle };
+			}
+		}
+	}
+	return std::nullopt;
+}
+
+//----------------------------------------------------------------------------
+gp_Trsf MGTMesh_Sweeper::GetTransformation(const Sweep& sweep, const double fraction) {
+	gp_Trsf transformation;
+	if (sweep.isRevolution)
+		transformation.SetRotation(sweep.axis, sweep.angle * fraction);
+	else
+		transformation.SetTranslation(sweep.direction * fraction);
+	return transformation;
+}
+
+//----------------------------------------------------------------------------
+bool MGTMesh_Sweeper::FindSweeps() {
+	_solids.clear();
+	_sweeps.clear();
+	try {
+		// Solids are swept independently, their interfaces would not conform
+		TopTools_IndexedDataMapOfShapeListOfShape faceSolids;
+		TopExp::MapShapesAndAncestors(_shape, TopAbs_FACE, TopAbs_SOLID, faceSolids);
+		for (int i = 1; i <= faceSolids.Extent(); ++i) {
+			if (faceSolids(i).Extent() > 1) {
+				SPDLOG_INFO("Solids sharing faces are not swept");
+				return false;
+			}
+		}
+
+		TopTools_IndexedMapOfShape solids;
+		TopExp::MapShapes(_shape, TopAbs_SOLID, solids);
+		for (int i = 1; i <= solids.Extent(); ++i) {
+			const std::optional<Sweep> sweep = FindSweep(solids(i));
+			if (!sweep) {
+				SPDLOG_INFO("Solid {} is neither extruded nor revolved", i);
+				return false;
+			}
+			_solids.push_back(solids(i));
+			_sweeps.push_back(*sweep);
+		}
+	} catch (Standard_Failure& ex) {
+		SPDLOG_ERROR("OpenCASCADE Exception: {}", ex.GetMessageString());
+		return false;
+	}
+	return !_sweeps.empty();
+}
+
+//----------------------------------------------------------------------------
+int MGTMesh_Sweeper::Compute(MGTMesh_MeshObject* meshObject) const {
+	if (_sweeps.empty())
+		return COMPERR_BAD_SHAPE;
+	if (_algorithm.secondOrder)
+		SPDLOG_WARN("Swept mesh is generated with linear elements only");
+
+	TopTools_IndexedMapOfShape solids;
+	TopTools_IndexedMapOfShape faces;
+	TopExp::MapShapes(_shape, TopAbs_SOLID, solids);
+	TopExp::MapShapes(_shape, TopAbs_FACE, faces);
+
+	// Source faces are meshed one after another, Netgen keeps meshing state in globals
+	std::vector<SourceMesh> sourceMeshes(_sweeps.size());
+	try {
+		for (std::size_t i = 0; i < _sweeps.size(); ++i) {
+			if (const int result = MeshSource(_sweeps[i], _algorithm, sourceMeshes[i]);
+				result != COMPERR_OK)
+				return result;
+			FindBoundary(_sweeps[i], sourceMeshes[i]);
+			TagBoundary(_sweeps[i], _solids[i], faces, sourceMeshes[i]);
+			spdlog::debug("Solid {} swept in {} layers", i + 1, sourceMeshes[i].layersNb);
+		}
+	} catch (Standard_Failure& ex) {
+		SPDLOG_ERROR("OpenCASCADE Exception: {}", ex.GetMessageString());
+		return COMPERR_OCC_EXCEPTION;
+	}
+
+	// Offsets of nodes and elements of solids in the merged mesh
+	struct Offsets {
+		vtkIdType nodes;
+		vtkIdType hexahedra;
+		vtkIdType wedges;
+		vtkIdType quadrangles;
+		vtkIdType triangles;
+	};
+	std::vector<Offsets> offsets(_sweeps.size() + 1, Offsets {});
+	for (std::size_t i = 0; i < _sweeps.size(); ++i) {
+		const SourceMesh& mesh = sourceMeshes[i];
+		const vtkIdType quadranglesNb = mesh.quadrangles.size() / 4;
+		const vtkIdType trianglesNb = mesh.triangles.size() / 3;
+		offsets[i + 1].nodes
+			= offsets[i].nodes + mesh.nodes.size() / 3 * (mesh.layersNb + 1);
+		offsets[i + 1].hexahedra = offsets[i].hexahedra + quadranglesNb * mesh.layersNb;
+		offsets[i + 1].wedges = offsets[i].wedges + trianglesNb * mesh.layersNb;
+		offsets[i + 1].quadrangles = offsets[i].quadrangles + 2 * quadranglesNb
+			+ static_cast<vtkIdType>(mesh.boundaryEdges.size()) * mesh.layersNb;
+		offsets[i + 1].triangles = offsets[i].triangles + 2 * trianglesNb;
+	}
+	const Offsets& totals = offsets.back();
+
+	vtkNew<MGTMesh_MeshData> meshData;
+	const std::span<double> nodes = meshData->AllocateNodes(totals.nodes);
+	for (std::size_t i = 0; i < _sweeps.size(); ++i) {
+		const SourceMesh& mesh = sourceMeshes[i];
+		const vtkIdType sourceNodesNb = mesh.nodes.size() / 3;
+		vtkSMPTools::For(0, mesh.layersNb + 1, [&](vtkIdType begin, vtkIdType end) {
+			for (vtkIdType layer = begin; layer < end; ++layer) {
+				const gp_Trsf transformation = GetTransformation(
+					_sweeps[i], static_cast<double>(layer) / mesh.layersNb);
+				double* layerNodes
+					= &nodes[3 * (offsets[i].nodes + layer * sourceNodesNb)];
+				for (vtkIdType node = 0; node < sourceNodesNb; ++node) {
+					gp_XYZ point = NodePoint(mesh.nodes, static_cast<std::int32_t>(node));
+					transformation.Transforms(point);
+					layerNodes[3 * node] = point.X();
+					layerNodes[3 * node + 1] = point.Y();
+					layerNodes[3 * node + 2] = point.Z();
+				}
+			}
+		});
+	}
+
+	// Elements swept from the source elements layer by layer, wedge bases are reversed
+	// since VTK orients their normals away from the opposite face
+	const auto sweepElements = [&](const int cellType, const vtkIdType Offsets::*offset,
+								   const std::vector<std::int32_t> SourceMesh::*elements,
+								   const int nodesNb) {
+		if (totals.*offset == 0)
+			return;
+		const MGTMesh_MeshData::BlockData block = meshData->AppendBlock(
+			MGTMesh_MeshData::Dimension::Volume, cellType, totals.*offset);
+		for (std::size_t i = 0; i < _sweeps.size(); ++i) {
+			const SourceMesh& mesh = sourceMeshes[i];
+			const std::vector<std::int32_t>& source = mesh.*elements;
+			const vtkIdType sourceNodesNb = mesh.nodes.size() / 3;
+			const vtkIdType layerElementsNb = source.size() / nodesNb;
+			const int solidTag = solids.FindIndex(_solids[i]);
+			vtkSMPTools::For(0, mesh.layersNb, [&](vtkIdType begin, vtkIdType end) {
+				for (vtkIdType layer = begin; layer < end; ++layer) {
+					const vtkIdType bottom = offsets[i].nodes + layer * sourceNodesNb;
+					const vtkIdType first = offsets[i].*offset + layer * layerElementsNb;
+					for (vtkIdType element = 0; element < layerElementsNb; ++element) {
+						std::int32_t* cellNodes
+							= &block.connectivity[2 * nodesNb * (first + element)];
+						for (int node = 0; node < nodesNb; ++node) {
+							const std::int32_t sourceNode = source[nodesNb * element
+								+ (cellType == VTK_WEDGE ? (nodesNb - node) % nodesNb : node)];
+							cellNodes[node] = static_cast<std::int32_t>(bottom + sourceNode);
+							cellNodes[node + nodesNb]
+								= static_cast<std::int32_t>(bottom + sourceNodesNb + sourceNode);
+						}
+						block.tags[first + element] = solidTag;
+					}
+				}
+			});
+		}
+	};
+	sweepElements(VTK_HEXAHEDRON, &Offsets::hexahedra, &SourceMesh::quadrangles, 4);
+	sweepElements(VTK_WEDGE, &Offsets::wedges, &SourceMesh::triangles, 3);
+
+	// Source elements reversed to point out of the solid, target elements and elements
+	// swept from boundary edges
+	const auto addBoundary = [&](const int cellType, const vtkIdType Offsets::*offset,
+								 const std::vector<std::int32_t> SourceMesh::*elements,
+								 const int nodesNb) {
+		if (totals.*offset == 0)
+			return;
+		const MGTMesh_MeshData::BlockData block = meshData->AppendBlock(
+			MGTMesh_MeshData::Dimension::Surface, cellType, totals.*offset);
+		for (std::size_t i = 0; i < _sweeps.size(); ++i) {
+			const SourceMesh& mesh = sourceMeshes[i];
+			const std::vector<std::int32_t>& source = mesh.*elements;
+			const vtkIdType sourceNodesNb = mesh.nodes.size() / 3;
+			const vtkIdType sourceElementsNb = source.size() / nodesNb;
+			const vtkIdType top = offsets[i].nodes + mesh.layersNb * sourceNodesNb;
+			const int sourceTag = faces.FindIndex(_sweeps[i].source);
+			const int targetTag = faces.FindIndex(_sweeps[i].target);
+
+			vtkIdType element = offsets[i].*offset;
+			for (vtkIdType sourceElement = 0; sourceElement < sourceElementsNb;
+				 ++sourceElement, ++element) {
+				const std::int32_t* sourceNodes = &source[nodesNb * sourceElement];
+				for (int node = 0; node < nodesNb; ++node) {
+					block.connectivity[nodesNb * element + node] = static_cast<std::int32_t>(
+						offsets[i].nodes + sourceNodes[(nodesNb - node) % nodesNb]);
+					block.connectivity[nodesNb * (element + sourceElementsNb) + node]
+						= static_cast<std::int32_t>(top + sourceNodes[node]);
+				}
+				block.tags[element] = sourceTag;
+				block.tags[element + sourceElementsNb] = targetTag;
+			}
+			if (cellType != VTK_QUAD)
+				continue;
+
+			element += sourceElementsNb;
+			for (int layer = 0; layer < mesh.layersNb; ++layer) {
+				const vtkIdType bottom = offsets[i].nodes + layer * sourceNodesNb;
+				for (std::size_t edge = 0; edge < mesh.boundaryEdges.size(); ++edge, ++element) {
+					const auto [a, b] = mesh.boundaryEdges[edge];
+					std::int32_t* cellNodes = &block.connectivity[4 * element];
+					cellNodes[0] = static_cast<std::int32_t>(bottom + a);
+					cellNodes[1] = static_cast<std::int32_t>(bottom + b);
+					cellNodes[2] = static_cast<std::int32_t>(bottom + sourceNodesNb + b);
+					cellNodes[3] = static_cast<std::int32_t>(bottom + sourceNodesNb + a);
+					block.tags[element] = mesh.boundaryTags[edge];
+				}
+			}
+		}
+	};
+	addBoundary(VTK_QUAD, &Offsets::quadrangles, &SourceMesh::quadrangles, 4);
+	addBoundary(VTK_TRIANGLE, &Offsets::triangles, &SourceMesh::triangles, 3);
+
+	if (_algorithm.renumber)
+		MGTMesh_Renumbering::Renumber(meshData);
+
+	meshObject->SetMeshData(meshData);
+	SPDLOG_INFO("Swept mesh of {} solids: {} points, {} volume and {} surface elements",
+		_sweeps.size(), meshData->GetNumberOfNodes(),
+		meshData->GetNumberOfElements(MGTMesh_MeshData::Dimension::Volume),
+		meshData->GetNumberOfElements(MGTMesh_MeshData::Dimension::Surface));
+	return COMPERR_OK;
+}
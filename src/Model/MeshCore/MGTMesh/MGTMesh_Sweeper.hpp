@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMesh_Sweeper.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef MGTMESH_SWEEPER_HPP
+#define MGTMESH_SWEEPER_HPP
+
+#include "MGTMesh_Algorithm.hpp"
+
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+#include <gp_Ax1.hxx>
+#include <gp_Trsf.hxx>
+#include <gp_Vec.hxx>
+
+#include <optional>
+#include <vector>
+
+class MGTMesh_MeshObject;
+
+/**
+ * Swept hexahedral meshing of extruded and revolved solids. Source and target faces
+ * are looked for among planar faces of equal area: the target must be the source
+ * translated or rotated about the line of intersection of their planes, all other
+ * faces must be ruled along the sweep and the volume of the solid must equal the
+ * volume swept by the source. The source face is meshed by Netgen with quadrangles
+ * and its mesh is extruded in layers through the solid, quadrangles give hexahedra
+ * and remaining triangles give wedges.
+ */
+class MGTMesh_Sweeper {
+public:
+	struct Sweep {
+		TopoDS_Face source;
+		TopoDS_Face target;
+		bool isRevolution;
+		gp_Vec direction;
+		// Rotation by positive angle about the axis takes source to target
+		gp_Ax1 axis;
+		double angle;
+		// Length of the sweep through centroid of the source
+		double length;
+	};
+
+	MGTMesh_Sweeper(const TopoDS_Shape& shape, const MGTMesh_Algorithm& algorithm);
+
+	// Finds sweeps of all solids, returns false if some solid is not sweepable or
+	// solids share faces
+	bool FindSweeps();
+
+	// Meshes solids along found sweeps, returns MGTMeshUtils_ComputeErrorName
+	[[nodiscard]] int Compute(MGTMesh_MeshObject* meshObject) const;
+
+	[[nodiscard]] static std::optional<Sweep> FindSweep(const TopoDS_Shape& solid);
+
+	// Transformation taking source to its position at given fraction of the sweep
+	[[nodiscard]] static gp_Trsf GetTransformation(const Sweep& sweep, double fraction);
+
+private:
+	const TopoDS_Shape& _shape;
+	MGTMesh_Algorithm _algorithm;
+	std::vector<TopoDS_Shape> _solids;
+	std::vector<Sweep> _sweeps;
+};
+
+#endif
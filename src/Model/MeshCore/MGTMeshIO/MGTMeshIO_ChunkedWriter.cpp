@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_ChunkedWriter.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "MGTMeshIO_ChunkedWriter.hpp"
+
+#include <cstring>
+
+//----------------------------------------------------------------------------
+MGTMeshIO_ChunkedWriter::MGTMeshIO_ChunkedWriter(const std::string& filePath)
+	: _stream(filePath, std::ios::binary | std::ios::trunc)
+	, _flushed(0) {
+	_buffer.reserve(ChunkSize + 4096);
+}
+
+//----------------------------------------------------------------------------
+MGTMeshIO_ChunkedWriter::~MGTMeshIO_ChunkedWriter() {
+	if (_stream.is_open())
+		this->Close();
+}
+
+//----------------------------------------------------------------------------
+void MGTMeshIO_ChunkedWriter::Write(const void* data, const std::size_t size) {
+	if (_buffer.size() + size <= ChunkSize) {
+		const auto* bytes = static_cast<const char*>(data);
+		_buffer.insert(_buffer.end(), bytes, bytes + size);
+		return;
+	}
+
+	// Large blocks bypass the buffer
+	this->FlushBuffer();
+	if (size >= ChunkSize) {
+		_stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+		_flushed += size;
+		return;
+	}
+
+	const auto* bytes = static_cast<const char*>(data);
+	_buffer.insert(_buffer.end(), bytes, bytes + size);
+}
+
+//----------------------------------------------------------------------------
+void MGTMeshIO_ChunkedWriter::Patch(
+	const std::uint64_t position, const void* data, const std::size_t size) {
+	if (position >= _flushed) {
+		std::memcpy(_buffer.data() + (position - _flushed), data, size);
+		return;
+	}
+
+	this->FlushBuffer();
+	_stream.seekp(static_cast<std::streamoff>(position));
+	_stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+	_stream.seekp(0, std::ios::end);
+}
+
+//----------------------------------------------------------------------------
+bool MGTMeshIO_ChunkedWriter::Close() {
+	this->FlushBuffer();
+	_stream.close();
+	return !_stream.fail();
+}
+
+//----------------------------------------------------------------------------
+void MGTMeshIO_ChunkedWriter::FlushBuffer() {
+	if (_buffer.empty())
+		return;
+
+	_stream.write(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+	_flushed += _buffer.size();
+	_buffer.clear();
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_ChunkedWriter.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef MGTMESHIO_CHUNKEDWRITER_HPP
+#define MGTMESHIO_CHUNKEDWRITER_HPP
+
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Buffered binary output file. Data is collected in a fixed-size chunk that is
+ * written to the file once full, so writers never build whole-file buffers.
+ * Regions written earlier (e.g. offsets in file headers) can be patched.
+ */
+class MGTMeshIO_ChunkedWriter {
+public:
+	static constexpr std::size_t ChunkSize = 4 << 20;
+
+	explicit MGTMeshIO_ChunkedWriter(const std::string& filePath);
+	~MGTMeshIO_ChunkedWriter();
+
+	MGTMeshIO_ChunkedWriter(const MGTMeshIO_ChunkedWriter&) = delete;
+	MGTMeshIO_ChunkedWriter& operator=(const MGTMeshIO_ChunkedWriter&) = delete;
+
+	[[nodiscard]] bool IsGood() const { return _stream.good(); }
+
+	void Write(const void* data, std::size_t size);
+	void Write(std::string_view text) { this->Write(text.data(), text.size()); }
+
+	template <typename T>
+	void WriteValue(const T& value) {
+		this->Write(&value, sizeof(T));
+	}
+
+	template <typename... Args>
+	void Print(std::format_string<Args...> format, Args&&... args) {
+		std::format_to(std::back_inserter(_buffer), format, std::forward<Args>(args)...);
+		if (_buffer.size() >= ChunkSize)
+			this->FlushBuffer();
+	}
+
+	// Position in the file including data that was not flushed yet
+	[[nodiscard]] std::uint64_t Tell() const { return _flushed + _buffer.size(); }
+
+	// Overwrites data already written at given position
+	void Patch(std::uint64_t position, const void* data, std::size_t size);
+
+	// Flushes remaining data, returns false if any write failed
+	bool Close();
+
+private:
+	void FlushBuffer();
+
+private:
+	std::ofstream _stream;
+	std::vector<char> _buffer;
+	std::uint64_t _flushed;
+};
+
+#endif
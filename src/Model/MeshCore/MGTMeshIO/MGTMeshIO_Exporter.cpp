@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_Exporter.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "MGTMeshIO_Exporter.hpp"
+#include "MGTMeshIO_INPWriter.hpp"
+#include "MGTMeshIO_MSHWriter.hpp"
+#include "MGTMeshIO_VTUWriter.hpp"
+#include "MGTMesh_MeshObject.hpp"
+#include "MGTMesh_Partitioner.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <format>
+#include <future>
+#include <vector>
+
+//----------------------------------------------------------------------------
+MGTMeshIO_Exporter::MGTMeshIO_Exporter(const MeshObjectsMap& meshObjects)
+	: _meshObjects(meshObjects) { }
+
+//----------------------------------------------------------------------------
+std::optional<MGTMeshIO_Exporter::Format> MGTMeshIO_Exporter::GetFormat(
+	const std::string& filePath) {
+	std::string extension = std::filesystem::path(filePath).extension().string();
+	std::ranges::transform(extension, extension.begin(),
+		[](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+	if (extension == ".vtu")
+		return Format::VTU;
+	if (extension == ".msh")
+		return Format::MSH;
+	if (extension == ".inp")
+		return Format::INP;
+	return std::nullopt;
+}
+
+//----------------------------------------------------------------------------
+std::unique_ptr<MGTMeshIO_Writer> MGTMeshIO_Exporter::CreateWriter(
+	const Format format, const MGTMesh_MeshObject* mesh) {
+	switch (format) {
+	case Format::VTU:
+		return std::make_unique<MGTMeshIO_VTUWriter>(mesh);
+	case Format::MSH:
+		return std::make_unique<MGTMeshIO_MSHWriter>(mesh);
+	case Format::INP:
+		return std::make_unique<MGTMeshIO_INPWriter>(mesh);
+	}
+	return nullptr;
+}
+
+//----------------------------------------------------------------------------
+bool MGTMeshIO_Exporter::Export(const std::string& filePath) const {
+	const std::optional<Format> format = GetFormat(filePath);
+	if (!format) {
+		SPDLOG_ERROR("Unsupported mesh file format: {}", filePath);
+		return false;
+	}
+
+	const std::filesystem::path path(filePath);
+	const bool singlePart = _meshObjects.size() == 1;
+
+	std::vector<std::future<bool>> results;
+	for (const auto& [id, meshObject] : _meshObjects) {
+		if (!meshObject || meshObject->IsEmpty()) {
+			SPDLOG_WARN("Mesh of part {} is empty, skipping export", id);
+			continue;
+		}
+
+		std::filesystem::path partPath = path;
+		if (!singlePart) {
+			partPath.replace_filename(std::format(
+				"{}_{}{}", path.stem().string(), id, path.extension().string()));
+		}
+
+		for (auto& [outputPath, mesh] : GetOutputMeshes(*format, partPath, meshObject)) {
+			results.push_back(std::async(std::launch::async,
+				[format = *format, mesh, id, outputPath]() {
+					const std::unique_ptr<MGTMeshIO_Writer> writer = CreateWriter(format, mesh);
+					writer->SetPartName(std::format("Part_{}", id));
+					spdlog::debug("Exporting mesh of part {} to: {}", id, outputPath.string());
+					return writer->Write(outputPath.string());
+				}));
+		}
+	}
+
+	bool succeeded = true;
+	for (std::future<bool>& result : results)
+		succeeded = result.get() && succeeded;
+	return succeeded;
+}
+
+//----------------------------------------------------------------------------
+std::vector<std::pair<std::filesystem::path, vtkSmartPointer<MGTMesh_MeshObject>>>
+MGTMeshIO_Exporter::GetOutputMeshes(const Format format, const std::filesystem::path& path,
+	const vtkSmartPointer<MGTMesh_MeshObject>& meshObject) {
+	if (!MGTMesh_Partitioner::IsPartitioned(meshObject))
+		return { { path, meshObject } };
+
+	// Ghost cells can be stored in VTK files only
+	if (format != Format::VTU) {
+		SPDLOG_INFO("Partitions are exported to .vtu files only, exporting whole mesh: {}",
+			path.string());
+		return { { path, meshObject } };
+	}
+
+	std::vector<std::pair<std::filesystem::path, vtkSmartPointer<MGTMesh_MeshObject>>> outputs;
+	const std::vector<vtkSmartPointer<MGTMesh_MeshObject>> partitions
+		= MGTMesh_Partitioner::ExtractPartitions(meshObject);
+	for (std::size_t i = 0; i < partitions.size(); ++i) {
+		std::filesystem::path partitionPath = path;
+		partitionPath.replace_filename(std::format(
+			"{}_p{}{}", path.stem().string(), i, path.extension().string()));
+		outputs.emplace_back(partitionPath, partitions[i]);
+	}
+	return outputs;
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_Exporter.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef MGTMESHIO_EXPORTER_HPP
+#define MGTMESHIO_EXPORTER_HPP
+
+#include <vtkSmartPointer.h>
+
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class MGTMesh_MeshObject;
+class MGTMeshIO_Writer;
+
+/**
+ * Exports mesh objects of all parts to files of format deduced from file extension
+ * (.vtu, .msh or .inp). Parts are written concurrently, each to its own file.
+ * Partitioned meshes exported to .vtu are written as one file per partition
+ * (suffixed with "_p<partition>"), with single layer of ghost cells.
+ */
+class MGTMeshIO_Exporter {
+public:
+	enum class Format { VTU, MSH, INP };
+
+	using MeshObjectsMap = std::unordered_map<int, vtkSmartPointer<MGTMesh_MeshObject>>;
+
+	explicit MGTMeshIO_Exporter(const MeshObjectsMap& meshObjects);
+
+	[[nodiscard]] static std::optional<Format> GetFormat(const std::string& filePath);
+	[[nodiscard]] static std::unique_ptr<MGTMeshIO_Writer> CreateWriter(
+		Format format, const MGTMesh_MeshObject* mesh);
+
+	// Single part is written to filePath, otherwise part ID is appended to file name
+	bool Export(const std::string& filePath) const;
+
+private:
+	// Meshes to be written to given path, one per partition for partitioned meshes
+	[[nodiscard]] static std::vector<std::pair<std::filesystem::path,
+		vtkSmartPointer<MGTMesh_MeshObject>>>
+	GetOutputMeshes(Format format, const std::filesystem::path& path,
+		const vtkSmartPointer<MGTMesh_MeshObject>& meshObject);
+
+private:
+	const MeshObjectsMap& _meshObjects;
+};
+
+#endif
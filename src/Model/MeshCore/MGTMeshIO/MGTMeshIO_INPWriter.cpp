@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_INPWriter.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "MGTMeshIO_INPWriter.hpp"
+#include "MGTMeshIO_ChunkedWriter.hpp"
+
+#include <vtkCellType.h>
+#include <vtkIdList.h>
+#include <vtkNew.h>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+namespace {
+
+// Number of nodes fetched from the mesh at once
+constexpr vtkIdType ChunkNodesNb = 1 << 16;
+
+// Abaqus element type, nullptr if cell type is not supported
+const char* GetAbaqusType(const int vtkType) {
+	switch (vtkType) {
+	case VTK_TRIANGLE:
+		return "SFM3D3";
+	case VTK_QUAD:
+		return "SFM3D4";
+	case VTK_TETRA:
+		return "C3D4";
+	case VTK_HEXAHEDRON:
+		return "C3D8";
+	case VTK_WEDGE:
+		return "C3D6";
+	// Abaqus has no pyramid element, it is written as collapsed hexahedron
+	case VTK_PYRAMID:
+		return "C3D8";
+	default:
+		return nullptr;
+	}
+}
+
+}
+
+//----------------------------------------------------------------------------
+MGTMeshIO_INPWriter::MGTMeshIO_INPWriter(const MGTMesh_MeshObject* mesh)
+	: MGTMeshIO_Writer(mesh) { }
+
+//----------------------------------------------------------------------------
+MGTMeshIO_INPWriter::~MGTMeshIO_INPWriter() = default;
+
+//----------------------------------------------------------------------------
+bool MGTMeshIO_INPWriter::Write(const std::string& filePath) {
+	MGTMeshIO_ChunkedWriter writer(filePath);
+	if (!writer.IsGood()) {
+		SPDLOG_ERROR("Cannot open file for writing: {}", filePath);
+		return false;
+	}
+
+	writer.Print("*HEADING\n{}\n", _partName);
+	this->WriteNodes(writer);
+	this->WriteElements(writer);
+
+	if (!writer.Close()) {
+		SPDLOG_ERROR("Error while writing file: {}", filePath);
+		return false;
+	}
+	return true;
+}
+
+//----------------------------------------------------------------------------
+void MGTMeshIO_INPWriter::WriteNodes(MGTMeshIO_ChunkedWriter& writer) const {
+	const vtkIdType nodesNb = this->GetNumberOfNodes();
+	if (nodesNb == 0)
+		return;
+
+	writer.Write(std::string_view("*NODE\n"));
+
+	std::vector<double> coords(3 * ChunkNodesNb);
+	for (vtkIdType first = 0; first < nodesNb; first += ChunkNodesNb) {
+		const vtkIdType count = std::min(ChunkNodesNb, nodesNb - first);
+		this->GetNodes(first, count, coords.data());
+		for (vtkIdType i = 0; i < count; ++i) {
+			const double* x = coords.data() + 3 * i;
+			writer.Print("{}, {:.17g}, {:.17g}, {:.17g}\n", first + i + 1, x[0], x[1], x[2]);
+		}
+	}
+}
+
+//----------------------------------------------------------------------------
+void MGTMeshIO_INPWriter::WriteElements(MGTMeshIO_ChunkedWriter& writer) const {
+	const vtkIdType volumeCellsNb = this->GetNumberOfVolumeCells();
+	const vtkIdType cellsNb = volumeCellsNb + this->GetNumberOfBoundaryCells();
+
+	vtkIdType elementId = 0;
+	vtkNew<vtkIdList> nodeIds;
+
+	// Abaqus requires elements of single type in each *ELEMENT section
+	const auto writeSections = [&](const std::vector<int>& types, const std::string& elset,
+								   vtkIdType firstCell, vtkIdType lastCell) {
+		for (const int type : types) {
+			const char* abaqusType = GetAbaqusType(type);
+			if (!abaqusType) {
+				SPDLOG_WARN("Cells of type {} are not supported by INP writer", type);
+				continue;
+			}
+
+			writer.Print("*ELEMENT, TYPE={}, ELSET={}\n", abaqusType, elset);
+			for (vtkIdType cellId = firstCell; cellId < lastCell; ++cellId) {
+				if (this->GetCellType(cellId) != type)
+					continue;
+
+				this->GetCellNodes(cellId, nodeIds);
+				if (type == VTK_PYRAMID) {
+					// Top face of the hexahedron is collapsed to the apex
+					const vtkIdType apex = nodeIds->GetId(4);
+					for (int i = 0; i < 3; ++i)
+						nodeIds->InsertNextId(apex);
+				}
+				writer.Print("{}", ++elementId);
+				for (vtkIdType i = 0; i < nodeIds->GetNumberOfIds(); ++i)
+					writer.Print(", {}", nodeIds->GetId(i) + 1);
+				writer.Write(std::string_view("\n"));
+			}
+		}
+	};
+
+	writeSections(this->GetVolumeCellTypes(), _partName, 0, volumeCellsNb);
+	writeSections(this->GetBoundaryCellTypes(), _partName + "_BOUNDARY", volumeCellsNb, cellsNb);
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_INPWriter.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef MGTMESHIO_INPWRITER_HPP
+#define MGTMESHIO_INPWRITER_HPP
+
+#include "MGTMeshIO_Writer.hpp"
+
+class MGTMeshIO_ChunkedWriter;
+
+/**
+ * Writes mesh as Abaqus input file. Volume cells go to element set named after the part,
+ * boundary cells are written as surface elements to "<part>_BOUNDARY" element set.
+ */
+class MGTMeshIO_INPWriter final : public MGTMeshIO_Writer {
+public:
+	explicit MGTMeshIO_INPWriter(const MGTMesh_MeshObject* mesh);
+	~MGTMeshIO_INPWriter() override;
+
+	bool Write(const std::string& filePath) override;
+
+private:
+	void WriteNodes(MGTMeshIO_ChunkedWriter& writer) const;
+	void WriteElements(MGTMeshIO_ChunkedWriter& writer) const;
+};
+
+#endif
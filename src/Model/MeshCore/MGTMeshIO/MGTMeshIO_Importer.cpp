@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_Importer.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "MGTMeshIO_Importer.hpp"
+#include "MGTMeshIO_Exporter.hpp"
+#include "MGTMeshIO_MSHReader.hpp"
+#include "MGTMeshIO_VTUReader.hpp"
+#include "MGTMesh_MeshObject.hpp"
+
+#include <spdlog/spdlog.h>
+
+//----------------------------------------------------------------------------
+std::unique_ptr<MGTMeshIO_Reader> MGTMeshIO_Importer::CreateReader(const std::string& filePath) {
+	switch (MGTMeshIO_Exporter::GetFormat(filePath).value_or(MGTMeshIO_Exporter::Format::INP)) {
+	case MGTMeshIO_Exporter::Format::VTU:
+		return std::make_unique<MGTMeshIO_VTUReader>();
+	case MGTMeshIO_Exporter::Format::MSH:
+		return std::make_unique<MGTMeshIO_MSHReader>();
+	default:
+		return nullptr;
+	}
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<MGTMesh_MeshObject> MGTMeshIO_Importer::Import(const std::string& filePath) {
+	const std::unique_ptr<MGTMeshIO_Reader> reader = CreateReader(filePath);
+	if (!reader) {
+		SPDLOG_ERROR("Unsupported mesh file format: {}", filePath);
+		return nullptr;
+	}
+
+	vtkSmartPointer<MGTMesh_MeshObject> mesh = vtkSmartPointer<MGTMesh_MeshObject>::New();
+	if (!reader->Read(filePath, mesh))
+		return nullptr;
+	if (mesh->IsEmpty()) {
+		SPDLOG_WARN("No cells imported from file: {}", filePath);
+		return nullptr;
+	}
+	return mesh;
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_Importer.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef MGTMESHIO_IMPORTER_HPP
+#define MGTMESHIO_IMPORTER_HPP
+
+#include <vtkSmartPointer.h>
+
+#include <memory>
+#include <string>
+
+class MGTMesh_MeshObject;
+class MGTMeshIO_Reader;
+
+/**
+ * Imports mesh object from file of format deduced from file extension (.vtu or .msh).
+ */
+class MGTMeshIO_Importer {
+public:
+	[[nodiscard]] static std::unique_ptr<MGTMeshIO_Reader> CreateReader(const std::string& filePath);
+
+	// Returns nullptr if the file could not be read
+	[[nodiscard]] static vtkSmartPointer<MGTMesh_MeshObject> Import(const std::string& filePath);
+};
+
+#endif
@@ -0,0 +1,415 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_MSHReader.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "MGTMeshIO_MSHReader.hpp"
+#include "MGTMeshIO_MappedFile.hpp"
+#include "MGTMesh_MeshObject.hpp"
+
+#include <vtkCellArray.h>
+#include <vtkCellType.h>
+#include <vtkDoubleArray.h>
+#include <vtkNew.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkSMPTools.h>
+#include <vtkTypeInt64Array.h>
+#include <vtkUnsignedCharArray.h>
+#include <vtkUnstructuredGrid.h>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+struct ElementType {
+	int gmshType;
+	int nodesNb;
+	int vtkType; // 0 if elements are skipped
+	int cornersNb;
+};
+
+// Higher order elements are read as linear ones, Gmsh stores corner nodes first
+constexpr ElementType ElementTypes[] = {
+	{ 1, 2, 0, 0 },
+	{ 2, 3, VTK_TRIANGLE, 3 },
+	{ 3, 4, VTK_QUAD, 4 },
+	{ 4, 4, VTK_TETRA, 4 },
+	{ 5, 8, VTK_HEXAHEDRON, 8 },
+	{ 6, 6, VTK_WEDGE, 6 },
+	{ 7, 5, VTK_PYRAMID, 5 },
+	{ 8, 3, 0, 0 },
+	{ 9, 6, VTK_TRIANGLE, 3 },
+	{ 10, 9, VTK_QUAD, 4 },
+	{ 11, 10, VTK_TETRA, 4 },
+	{ 12, 27, VTK_HEXAHEDRON, 8 },
+	{ 13, 18, VTK_WEDGE, 6 },
+	{ 14, 14, VTK_PYRAMID, 5 },
+	{ 15, 1, 0, 0 },
+	{ 16, 8, VTK_QUAD, 4 },
+	{ 17, 20, VTK_HEXAHEDRON, 8 },
+	{ 18, 15, VTK_WEDGE, 6 },
+	{ 19, 13, VTK_PYRAMID, 5 },
+};
+
+const ElementType* GetElementType(const int gmshType) {
+	for (const ElementType& type : ElementTypes) {
+		if (type.gmshType == gmshType)
+			return &type;
+	}
+	return nullptr;
+}
+
+// Sequential reader of the mapped file, all reads are bounds checked
+class Parser {
+public:
+	explicit Parser(const MGTMeshIO_MappedFile* file)
+		: _data(file->GetData())
+		, _size(file->GetSize()) { }
+
+	[[nodiscard]] const std::byte* GetData() const { return _data; }
+	[[nodiscard]] std::size_t Tell() const { return _position; }
+	[[nodiscard]] bool AtEnd() const { return _position >= _size; }
+
+	bool ReadLine(std::string_view& line) {
+		if (this->AtEnd())
+			return false;
+		const std::string_view content(reinterpret_cast<const char*>(_data), _size);
+		std::size_t end = content.find('\n', _position);
+		if (end == std::string_view::npos)
+			end = _size;
+		line = content.substr(_position, end - _position);
+		if (!line.empty() && line.back() == '\r')
+			line.remove_suffix(1);
+		_position = end + 1;
+		return true;
+	}
+
+	template <typename T>
+	bool ReadValue(T& value) {
+		if (!this->Skip(sizeof(T)))
+			return false;
+		std::memcpy(&value, _data + _position - sizeof(T), sizeof(T));
+		return true;
+	}
+
+	bool Skip(const std::uint64_t bytesNb) {
+		if (bytesNb > _size - std::min(_position, _size))
+			return false;
+		_position += bytesNb;
+		return true;
+	}
+
+	// Moves past the line closing the section
+	bool SkipSection(const std::string_view name) {
+		const std::string_view content(reinterpret_cast<const char*>(_data), _size);
+		const std::string endTag = "$End" + std::string(name);
+		const std::size_t end = content.find(endTag, _position);
+		if (end == std::string_view::npos)
+			return false;
+		_position = end;
+		std::string_view line;
+		return this->ReadLine(line);
+	}
+
+private:
+	const std::byte* _data;
+	std::size_t _size;
+	std::size_t _position = 0;
+};
+
+std::uint64_t LoadTag(const std::byte* data) {
+	std::uint64_t tag;
+	std::memcpy(&tag, data, sizeof(tag));
+	return tag;
+}
+
+struct Nodes {
+	vtkSmartPointer<vtkDoubleArray> coords;
+	std::vector<vtkIdType> indices; // Node index by tag, empty if index is tag - 1
+};
+
+bool ReadNodes(Parser& parser, MGTMeshIO_MappedFile* file, Nodes& nodes) {
+	std::uint64_t blocksNb, nodesNb, minTag, maxTag;
+	if (!parser.ReadValue(blocksNb) || !parser.ReadValue(nodesNb) || !parser.ReadValue(minTag)
+		|| !parser.ReadValue(maxTag))
+		return false;
+
+	nodes.coords = vtkSmartPointer<vtkDoubleArray>::New();
+	nodes.coords->SetNumberOfComponents(3);
+	const std::byte* data = parser.GetData();
+
+	vtkIdType firstIndex = 0;
+	for (std::uint64_t block = 0; block < blocksNb; ++block) {
+		int entityDim, entityTag, parametric;
+		std::uint64_t blockNodesNb;
+		if (!parser.ReadValue(entityDim) || !parser.ReadValue(entityTag)
+			|| !parser.ReadValue(parametric) || !parser.ReadValue(blockNodesNb))
+			return false;
+
+		const std::size_t tagsPosition = parser.Tell();
+		const int stride = 3 + (parametric ? entityDim : 0);
+		if (!parser.Skip(blockNodesNb * sizeof(std::uint64_t)))
+			return false;
+		const std::size_t coordsPosition = parser.Tell();
+		if (!parser.Skip(blockNodesNb * stride * sizeof(double)))
+			return false;
+
+		const auto count = static_cast<vtkIdType>(blockNodesNb);
+
+		// Single block of consecutive tags: coordinates are used as they are in the file
+		if (blocksNb == 1 && stride == 3 && blockNodesNb == nodesNb && minTag == 1
+			&& maxTag == nodesNb) {
+			std::atomic<bool> ordered = true;
+			vtkSMPTools::For(0, count, [&](vtkIdType begin, vtkIdType end) {
+				for (vtkIdType i = begin; i < end && ordered; ++i) {
+					if (LoadTag(data + tagsPosition + i * sizeof(std::uint64_t))
+						!= static_cast<std::uint64_t>(i + 1))
+						ordered = false;
+				}
+			});
+			if (ordered && file->WrapArray(nodes.coords, coordsPosition, count))
+				return true;
+		}
+
+		if (nodes.indices.empty()) {
+			nodes.coords->SetNumberOfTuples(static_cast<vtkIdType>(nodesNb));
+			nodes.indices.assign(maxTag + 1, -1);
+		}
+		if (firstIndex + count > static_cast<vtkIdType>(nodesNb))
+			return false;
+
+		std::atomic<bool> succeeded = true;
+		double* coords = nodes.coords->GetPointer(0);
+		vtkSMPTools::For(0, count, [&](vtkIdType begin, vtkIdType end) {
+			for (vtkIdType i = begin; i < end; ++i) {
+				const std::uint64_t tag = LoadTag(data + tagsPosition + i * sizeof(std::uint64_t));
+				if (tag > maxTag) {
+					succeeded = false;
+					continue;
+				}
+				nodes.indices[tag] = firstIndex + i;
+				std::memcpy(coords + 3 * (firstIndex + i),
+					data + coordsPosition + i * stride * sizeof(double), 3 * sizeof(double));
+			}
+		});
+		if (!succeeded)
+			return false;
+		firstIndex += count;
+	}
+
+	return firstIndex == static_cast<vtkIdType>(nodesNb);
+}
+
+struct ElementBlock {
+	const ElementType* type;
+	int entityDim;
+	vtkIdType elementsNb;
+	std::size_t position;
+	vtkIdType firstCell; // Index of the first cell within the mesh block
+	vtkIdType firstConnectivity;
+};
+
+struct Cells {
+	vtkSmartPointer<vtkTypeInt64Array> offsets = vtkSmartPointer<vtkTypeInt64Array>::New();
+	vtkSmartPointer<vtkTypeInt64Array> connectivity = vtkSmartPointer<vtkTypeInt64Array>::New();
+	vtkSmartPointer<vtkUnsignedCharArray> types = vtkSmartPointer<vtkUnsignedCharArray>::New();
+	vtkIdType cellsNb = 0;
+	vtkIdType connectivityNb = 0;
+
+	void Allocate() {
+		offsets->SetNumberOfValues(cellsNb + 1);
+		offsets->SetValue(cellsNb, connectivityNb);
+		connectivity->SetNumberOfValues(connectivityNb);
+		types->SetNumberOfValues(cellsNb);
+	}
+
+	[[nodiscard]] vtkSmartPointer<vtkCellArray> GetCellArray() const {
+		const auto cells = vtkSmartPointer<vtkCellArray>::New();
+		cells->SetData(offsets, connectivity);
+		return cells;
+	}
+};
+
+bool ReadElements(Parser& parser, const Nodes& nodes, Cells& volumeCells, Cells& surfaceCells) {
+	std::uint64_t blocksNb, elementsNb, minTag, maxTag;
+	if (!parser.ReadValue(blocksNb) || !parser.ReadValue(elementsNb) || !parser.ReadValue(minTag)
+		|| !parser.ReadValue(maxTag))
+		return false;
+
+	// Block headers are scanned first, so that blocks can be converted in parallel
+	std::vector<ElementBlock> blocks;
+	for (std::uint64_t block = 0; block < blocksNb; ++block) {
+		int entityDim, entityTag, gmshType;
+		std::uint64_t blockElementsNb;
+		if (!parser.ReadValue(entityDim) || !parser.ReadValue(entityTag)
+			|| !parser.ReadValue(gmshType) || !parser.ReadValue(blockElementsNb))
+			return false;
+
+		const ElementType* type = GetElementType(gmshType);
+		if (!type) {
+			SPDLOG_ERROR("Unsupported MSH element type: {}", gmshType);
+			return false;
+		}
+
+		const std::size_t position = parser.Tell();
+		if (!parser.Skip(blockElementsNb * (1 + type->nodesNb) * sizeof(std::uint64_t)))
+			return false;
+		if (type->vtkType == 0)
+			continue;
+
+		Cells& cells = entityDim == 3 ? volumeCells : surfaceCells;
+		const auto count = static_cast<vtkIdType>(blockElementsNb);
+		blocks.push_back({ type, entityDim, count, position, cells.cellsNb, cells.connectivityNb });
+		cells.cellsNb += count;
+		cells.connectivityNb += count * type->cornersNb;
+	}
+
+	volumeCells.Allocate();
+	surfaceCells.Allocate();
+
+	const std::byte* data = parser.GetData();
+	const auto nodesNb = static_cast<std::uint64_t>(nodes.coords->GetNumberOfTuples());
+	std::atomic<bool> succeeded = true;
+
+	for (const ElementBlock& block : blocks) {
+		Cells& cells = block.entityDim == 3 ? volumeCells : surfaceCells;
+		const std::size_t elementSize = (1 + block.type->nodesNb) * sizeof(std::uint64_t);
+		const int cornersNb = block.type->cornersNb;
+
+		vtkSMPTools::For(0, block.elementsNb, [&](vtkIdType begin, vtkIdType end) {
+			for (vtkIdType i = begin; i < end; ++i) {
+				const std::byte* element = data + block.position + i * elementSize;
+				const vtkIdType cellId = block.firstCell + i;
+				const vtkIdType offset = block.firstConnectivity + i * cornersNb;
+				cells.offsets->SetValue(cellId, offset);
+				cells.types->SetValue(cellId, static_cast<unsigned char>(block.type->vtkType));
+
+				for (int node = 0; node < cornersNb; ++node) {
+					const std::uint64_t tag
+						= LoadTag(element + (1 + node) * sizeof(std::uint64_t));
+					vtkIdType index = -1;
+					if (!nodes.indices.empty())
+						index = tag < nodes.indices.size() ? nodes.indices[tag] : -1;
+					else if (tag >= 1 && tag <= nodesNb)
+						index = static_cast<vtkIdType>(tag - 1);
+
+					if (index < 0)
+						succeeded = false;
+					cells.connectivity->SetValue(offset + node, index < 0 ? 0 : index);
+				}
+			}
+		});
+	}
+
+	return succeeded;
+}
+
+}
+
+//----------------------------------------------------------------------------
+MGTMeshIO_MSHReader::MGTMeshIO_MSHReader() = default;
+
+//----------------------------------------------------------------------------
+MGTMeshIO_MSHReader::~MGTMeshIO_MSHReader() = default;
+
+//----------------------------------------------------------------------------
+bool MGTMeshIO_MSHReader::Read(const std::string& filePath, MGTMesh_MeshObject* mesh) {
+	vtkNew<MGTMeshIO_MappedFile> file;
+	if (!file->Open(filePath))
+		return false;
+
+	Parser parser(file);
+	Nodes nodes;
+	Cells volumeCells;
+	Cells surfaceCells;
+	bool formatRead = false;
+	bool nodesRead = false;
+	bool elementsRead = false;
+
+	std::string_view line;
+	while (parser.ReadLine(line)) {
+		if (line.empty() || line.front() != '$')
+			continue;
+
+		const std::string_view section = line.substr(1);
+		if (section == "MeshFormat") {
+			std::string_view format;
+			int endianness = 0;
+			if (!parser.ReadLine(format) || !format.starts_with("4.1 1 8")) {
+				SPDLOG_ERROR("Only binary MSH 4.1 files are supported: {}", filePath);
+				return false;
+			}
+			if (!parser.ReadValue(endianness) || endianness != 1) {
+				SPDLOG_ERROR("MSH file byte order differs from native one: {}", filePath);
+				return false;
+			}
+			formatRead = true;
+		} else if (section == "Nodes" && formatRead) {
+			nodesRead = ReadNodes(parser, file, nodes);
+			if (!nodesRead)
+				break;
+		} else if (section == "Elements" && nodesRead) {
+			elementsRead = ReadElements(parser, nodes, volumeCells, surfaceCells);
+			if (!elementsRead)
+				break;
+		}
+
+		if (!parser.SkipSection(section))
+			break;
+	}
+
+	if (!formatRead || !nodesRead || !elementsRead) {
+		SPDLOG_ERROR("Cannot read MSH file: {}", filePath);
+		return false;
+	}
+
+	vtkNew<vtkPoints> points;
+	points->SetData(nodes.coords);
+
+	if (volumeCells.cellsNb > 0) {
+		vtkUnstructuredGrid* internalMesh = vtkUnstructuredGrid::New();
+		internalMesh->SetPoints(points);
+		internalMesh->SetCells(volumeCells.types, volumeCells.GetCellArray());
+		mesh->SetInternalMesh(internalMesh);
+	}
+
+	if (surfaceCells.cellsNb > 0) {
+		vtkPolyData* boundaryMesh = vtkPolyData::New();
+		boundaryMesh->SetPoints(points);
+		boundaryMesh->SetPolys(surfaceCells.GetCellArray());
+		mesh->SetBoundaryMesh(boundaryMesh);
+	} else if (volumeCells.cellsNb > 0) {
+		mesh->SetBoundaryMesh(ExtractBoundary(mesh->GetInternalMesh()));
+	}
+
+	SPDLOG_INFO("MSH mesh read: {} nodes, {} volume and {} surface elements",
+		nodes.coords->GetNumberOfTuples(), volumeCells.cellsNb, surfaceCells.cellsNb);
+	return true;
+}
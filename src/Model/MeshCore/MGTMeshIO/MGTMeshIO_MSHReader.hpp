@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_MSHReader.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef MGTMESHIO_MSHREADER_HPP
+#define MGTMESHIO_MSHREADER_HPP
+
+#include "MGTMeshIO_Reader.hpp"
+
+/**
+ * Reads binary Gmsh MSH 4.1 file from memory-mapped file. Node coordinates are
+ * viewed without copying if nodes form a single block with consecutive tags, element
+ * blocks are converted in parallel. 2D elements form boundary block, if there are
+ * none boundary is extracted from 3D elements.
+ */
+class MGTMeshIO_MSHReader final : public MGTMeshIO_Reader {
+public:
+	MGTMeshIO_MSHReader();
+	~MGTMeshIO_MSHReader() override;
+
+	bool Read(const std::string& filePath, MGTMesh_MeshObject* mesh) override;
+};
+
+#endif
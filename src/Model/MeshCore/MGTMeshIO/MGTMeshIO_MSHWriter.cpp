@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_MSHWriter.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "MGTMeshIO_MSHWriter.hpp"
+#include "MGTMeshIO_ChunkedWriter.hpp"
+
+#include <vtkCellType.h>
+#include <vtkIdList.h>
+#include <vtkNew.h>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+
+// Number of nodes or connectivity values collected before they are written
+constexpr vtkIdType ChunkValuesNb = 1 << 16;
+
+// Gmsh element type, 0 if cell type is not supported
+int GetGmshType(const int vtkType) {
+	switch (vtkType) {
+	case VTK_TRIANGLE:
+		return 2;
+	case VTK_QUAD:
+		return 3;
+	case VTK_TETRA:
+		return 4;
+	case VTK_HEXAHEDRON:
+		return 5;
+	case VTK_WEDGE:
+		return 6;
+	case VTK_PYRAMID:
+		return 7;
+	default:
+		return 0;
+	}
+}
+
+struct ElementBlock {
+	int entityDim;
+	int gmshType;
+	int vtkType;
+	vtkIdType firstCell;
+	vtkIdType lastCell;
+	std::uint64_t elementsNb;
+};
+
+}
+
+//----------------------------------------------------------------------------
+MGTMeshIO_MSHWriter::MGTMeshIO_MSHWriter(const MGTMesh_MeshObject* mesh)
+	: MGTMeshIO_Writer(mesh) { }
+
+//----------------------------------------------------------------------------
+MGTMeshIO_MSHWriter::~MGTMeshIO_MSHWriter() = default;
+
+//----------------------------------------------------------------------------
+bool MGTMeshIO_MSHWriter::Write(const std::string& filePath) {
+	MGTMeshIO_ChunkedWriter writer(filePath);
+	if (!writer.IsGood()) {
+		SPDLOG_ERROR("Cannot open file for writing: {}", filePath);
+		return false;
+	}
+
+	writer.Write(std::string_view("$MeshFormat\n4.1 1 8\n"));
+	writer.WriteValue<int>(1); // Endianness check
+	writer.Write(std::string_view("\n$EndMeshFormat\n"));
+
+	this->WriteNodes(writer);
+	this->WriteElements(writer);
+
+	if (!writer.Close()) {
+		SPDLOG_ERROR("Error while writing file: {}", filePath);
+		return false;
+	}
+	return true;
+}
+
+//----------------------------------------------------------------------------
+void MGTMeshIO_MSHWriter::WriteNodes(MGTMeshIO_ChunkedWriter& writer) const {
+	const vtkIdType nodesNb = this->GetNumberOfNodes();
+	const auto tagsNb = static_cast<std::uint64_t>(nodesNb);
+
+	writer.Write(std::string_view("$Nodes\n"));
+	writer.WriteValue<std::uint64_t>(nodesNb > 0 ? 1 : 0);
+	writer.WriteValue<std::uint64_t>(tagsNb);
+	writer.WriteValue<std::uint64_t>(nodesNb > 0 ? 1 : 0);
+	writer.WriteValue<std::uint64_t>(tagsNb);
+
+	if (nodesNb > 0) {
+		writer.WriteValue<int>(this->GetNumberOfVolumeCells() > 0 ? 3 : 2);
+		writer.WriteValue<int>(1);
+		writer.WriteValue<int>(0);
+		writer.WriteValue<std::uint64_t>(tagsNb);
+
+		std::vector<std::uint64_t> tags(ChunkValuesNb);
+		for (vtkIdType first = 0; first < nodesNb; first += ChunkValuesNb) {
+			const vtkIdType count = std::min(ChunkValuesNb, nodesNb - first);
+			for (vtkIdType i = 0; i < count; ++i)
+				tags[i] = first + i + 1;
+			writer.Write(tags.data(), count * sizeof(std::uint64_t));
+		}
+
+		std::vector<double> coords(3 * ChunkValuesNb);
+		for (vtkIdType first = 0; first < nodesNb; first += ChunkValuesNb) {
+			const vtkIdType count = std::min(ChunkValuesNb, nodesNb - first);
+			this->GetNodes(first, count, coords.data());
+			writer.Write(coords.data(), 3 * count * sizeof(double));
+		}
+	}
+
+	writer.Write(std::string_view("\n$EndNodes\n"));
+}
+
+//----------------------------------------------------------------------------
+void MGTMeshIO_MSHWriter::WriteElements(MGTMeshIO_ChunkedWriter& writer) const {
+	const vtkIdType volumeCellsNb = this->GetNumberOfVolumeCells();
+	const vtkIdType cellsNb = volumeCellsNb + this->GetNumberOfBoundaryCells();
+
+	// Gmsh requires elements of single type in each block
+	std::vector<ElementBlock> blocks;
+	const auto addBlocks = [this, &blocks](const std::vector<int>& types, int entityDim,
+							   vtkIdType firstCell, vtkIdType lastCell) {
+		for (const int type : types) {
+			const int gmshType = GetGmshType(type);
+			if (gmshType == 0) {
+				SPDLOG_WARN("Cells of type {} are not supported by MSH writer", type);
+				continue;
+			}
+
+			std::uint64_t elementsNb = 0;
+			for (vtkIdType cellId = firstCell; cellId < lastCell; ++cellId)
+				elementsNb += this->GetCellType(cellId) == type;
+			blocks.push_back({ entityDim, gmshType, type, firstCell, lastCell, elementsNb });
+		}
+	};
+	addBlocks(this->GetVolumeCellTypes(), 3, 0, volumeCellsNb);
+	addBlocks(this->GetBoundaryCellTypes(), 2, volumeCellsNb, cellsNb);
+
+	std::uint64_t elementsNb = 0;
+	for (const ElementBlock& block : blocks)
+		elementsNb += block.elementsNb;
+
+	writer.Write(std::string_view("$Elements\n"));
+	writer.WriteValue<std::uint64_t>(blocks.size());
+	writer.WriteValue<std::uint64_t>(elementsNb);
+	writer.WriteValue<std::uint64_t>(elementsNb > 0 ? 1 : 0);
+	writer.WriteValue<std::uint64_t>(elementsNb);
+
+	std::uint64_t elementTag = 0;
+	vtkNew<vtkIdList> nodeIds;
+	std::vector<std::uint64_t> values;
+	values.reserve(ChunkValuesNb + 32);
+
+	for (const ElementBlock& block : blocks) {
+		writer.WriteValue<int>(block.entityDim);
+		writer.WriteValue<int>(1);
+		writer.WriteValue<int>(block.gmshType);
+		writer.WriteValue<std::uint64_t>(block.elementsNb);
+
+		for (vtkIdType cellId = block.firstCell; cellId < block.lastCell; ++cellId) {
+			if (this->GetCellType(cellId) != block.vtkType)
+				continue;
+
+			this->GetCellNodes(cellId, nodeIds);
+			values.push_back(++elementTag);
+			for (vtkIdType i = 0; i < nodeIds->GetNumberOfIds(); ++i)
+				values.push_back(nodeIds->GetId(i) + 1);
+
+			if (values.size() >= ChunkValuesNb) {
+				writer.Write(values.data(), values.size() * sizeof(std::uint64_t));
+				values.clear();
+			}
+		}
+		writer.Write(values.data(), values.size() * sizeof(std::uint64_t));
+		values.clear();
+	}
+
+	writer.Write(std::string_view("\n$EndElements\n"));
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_MSHWriter.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef MGTMESHIO_MSHWRITER_HPP
+#define MGTMESHIO_MSHWRITER_HPP
+
+#include "MGTMeshIO_Writer.hpp"
+
+class MGTMeshIO_ChunkedWriter;
+
+/**
+ * Writes mesh in binary Gmsh MSH 4.1 format. All nodes form single entity block,
+ * volume cells are assigned to volume entity 1 and boundary cells to surface entity 1.
+ */
+class MGTMeshIO_MSHWriter final : public MGTMeshIO_Writer {
+public:
+	explicit MGTMeshIO_MSHWriter(const MGTMesh_MeshObject* mesh);
+	~MGTMeshIO_MSHWriter() override;
+
+	bool Write(const std::string& filePath) override;
+
+private:
+	void WriteNodes(MGTMeshIO_ChunkedWriter& writer) const;
+	void WriteElements(MGTMeshIO_ChunkedWriter& writer) const;
+};
+
+#endif
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_MappedFile.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "MGTMeshIO_MappedFile.hpp"
+
+#include <vtkAbstractArray.h>
+#include <vtkInformation.h>
+#include <vtkInformationObjectBaseKey.h>
+#include <vtkObjectFactory.h>
+
+#include <spdlog/spdlog.h>
+
+#include <cstdint>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+vtkStandardNewMacro(MGTMeshIO_MappedFile);
+vtkInformationKeyMacro(MGTMeshIO_MappedFile, MAPPED_FILE, ObjectBase);
+
+//----------------------------------------------------------------------------
+MGTMeshIO_MappedFile::MGTMeshIO_MappedFile()
+	: _data(nullptr)
+	, _size(0)
+	, _handle(nullptr)
+	, _mapping(nullptr) { }
+
+//----------------------------------------------------------------------------
+MGTMeshIO_MappedFile::~MGTMeshIO_MappedFile() { this->Close(); }
+
+//----------------------------------------------------------------------------
+bool MGTMeshIO_MappedFile::Open(const std::string& filePath) {
+	this->Close();
+
+#ifdef _WIN32
+	HANDLE file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		SPDLOG_ERROR("Cannot open file: {}", filePath);
+		return false;
+	}
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+		CloseHandle(file);
+		SPDLOG_ERROR("Cannot map empty file: {}", filePath);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+	void* data = mapping ? MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0) : nullptr;
+	if (!data) {
+		if (mapping)
+			CloseHandle(mapping);
+		CloseHandle(file);
+		SPDLOG_ERROR("Cannot map file: {}", filePath);
+		return false;
+	}
+
+	_handle = file;
+	_mapping = mapping;
+	_size = static_cast<std::size_t>(size.QuadPart);
+#else
+	const int file = open(filePath.c_str(), O_RDONLY);
+	if (file < 0) {
+		SPDLOG_ERROR("Cannot open file: {}", filePath);
+		return false;
+	}
+
+	struct stat status { };
+	if (fstat(file, &status) != 0 || status.st_size == 0) {
+		close(file);
+		SPDLOG_ERROR("Cannot map empty file: {}", filePath);
+		return false;
+	}
+
+	void* data = mmap(nullptr, status.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+	close(file);
+	if (data == MAP_FAILED) {
+		SPDLOG_ERROR("Cannot map file: {}", filePath);
+		return false;
+	}
+	madvise(data, status.st_size, MADV_SEQUENTIAL);
+
+	_mapping = data;
+	_size = static_cast<std::size_t>(status.st_size);
+#endif
+
+	_data = static_cast<std::byte*>(data);
+	return true;
+}
+
+//----------------------------------------------------------------------------
+void MGTMeshIO_MappedFile::Close() {
+	if (!_data)
+		return;
+
+#ifdef _WIN32
+	UnmapViewOfFile(_data);
+	CloseHandle(static_cast<HANDLE>(_mapping));
+	CloseHandle(static_cast<HANDLE>(_handle));
+#else
+	munmap(_mapping, _size);
+#endif
+
+	_data = nullptr;
+	_size = 0;
+	_handle = nullptr;
+	_mapping = nullptr;
+}
+
+//----------------------------------------------------------------------------
+bool MGTMeshIO_MappedFile::WrapArray(
+	vtkAbstractArray* array, const std::size_t offset, const vtkIdType tuplesNb) {
+	const vtkIdType valuesNb = tuplesNb * array->GetNumberOfComponents();
+	const std::size_t valueSize = array->GetDataTypeSize();
+	std::byte* data = _data + offset;
+
+	if (offset + valuesNb * valueSize > _size) {
+		SPDLOG_ERROR("Array exceeds size of mapped file");
+		return false;
+	}
+
+	if (reinterpret_cast<std::uintptr_t>(data) % valueSize != 0) {
+		array->SetNumberOfTuples(tuplesNb);
+		std::memcpy(array->GetVoidPointer(0), data, valuesNb * valueSize);
+		return true;
+	}
+
+	array->SetVoidArray(data, valuesNb, 1);
+	array->GetInformation()->Set(MAPPED_FILE(), this);
+	return true;
+}
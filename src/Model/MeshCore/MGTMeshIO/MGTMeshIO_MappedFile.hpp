@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_MappedFile.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef MGTMESHIO_MAPPEDFILE_HPP
+#define MGTMESHIO_MAPPEDFILE_HPP
+
+#include <vtkObject.h>
+
+#include <cstddef>
+#include <string>
+
+class vtkAbstractArray;
+class vtkInformationObjectBaseKey;
+
+/**
+ * Copy-on-write memory mapping of a whole file. Arrays filled with WrapArray view
+ * the mapped data directly and keep the mapping alive through their information,
+ * so it is released only after the last array using it is deleted. Modifying such
+ * array does not change the file.
+ */
+class MGTMeshIO_MappedFile final : public vtkObject {
+public:
+	static MGTMeshIO_MappedFile* New();
+	vtkTypeMacro(MGTMeshIO_MappedFile, vtkObject);
+
+	static vtkInformationObjectBaseKey* MAPPED_FILE();
+
+	bool Open(const std::string& filePath);
+
+	[[nodiscard]] std::byte* GetData() const { return _data; }
+	[[nodiscard]] std::size_t GetSize() const { return _size; }
+
+	// Makes the array (with number of components already set) view mapped data
+	// without copying it. Data is copied if it is not aligned for the value type.
+	bool WrapArray(vtkAbstractArray* array, std::size_t offset, vtkIdType tuplesNb);
+
+protected:
+	MGTMeshIO_MappedFile();
+	~MGTMeshIO_MappedFile() override;
+
+private:
+	void Close();
+
+private:
+	std::byte* _data;
+	std::size_t _size;
+	void* _handle;
+	void* _mapping;
+};
+
+#endif
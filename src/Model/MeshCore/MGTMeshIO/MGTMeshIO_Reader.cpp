@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_Reader.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "MGTMeshIO_Reader.hpp"
+
+#include <vtkCellArray.h>
+#include <vtkCellType.h>
+#include <vtkIdList.h>
+#include <vtkNew.h>
+#include <vtkPolyData.h>
+#include <vtkSMPThreadLocalObject.h>
+#include <vtkSMPTools.h>
+#include <vtkTypeInt64Array.h>
+#include <vtkUnstructuredGrid.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace {
+
+// Faces of linear 3D cells with VTK node ordering, oriented outwards
+struct FaceTable {
+	int facesNb;
+	int sizes[6];
+	int nodes[6][4];
+};
+
+constexpr FaceTable TetraFaces { 4, { 3, 3, 3, 3 },
+	{ { 0, 1, 3 }, { 1, 2, 3 }, { 2, 0, 3 }, { 0, 2, 1 } } };
+constexpr FaceTable HexahedronFaces { 6, { 4, 4, 4, 4, 4, 4 },
+	{ { 0, 4, 7, 3 }, { 1, 2, 6, 5 }, { 0, 1, 5, 4 }, { 3, 7, 6, 2 }, { 0, 3, 2, 1 },
+		{ 4, 5, 6, 7 } } };
+constexpr FaceTable WedgeFaces { 5, { 3, 3, 4, 4, 4 },
+	{ { 0, 1, 2 }, { 3, 5, 4 }, { 0, 3, 4, 1 }, { 1, 4, 5, 2 }, { 2, 5, 3, 0 } } };
+constexpr FaceTable PyramidFaces { 5, { 4, 3, 3, 3, 3 },
+	{ { 0, 3, 2, 1 }, { 0, 1, 4 }, { 1, 2, 4 }, { 2, 3, 4 }, { 3, 0, 4 } } };
+
+const FaceTable* GetFaceTable(const int cellType) {
+	switch (cellType) {
+	case VTK_TETRA:
+		return &TetraFaces;
+	case VTK_HEXAHEDRON:
+		return &HexahedronFaces;
+	case VTK_WEDGE:
+		return &WedgeFaces;
+	case VTK_PYRAMID:
+		return &PyramidFaces;
+	default:
+		return nullptr;
+	}
+}
+
+bool IsSurfaceCell(const int cellType) {
+	return cellType == VTK_TRIANGLE || cellType == VTK_QUAD || cellType == VTK_POLYGON;
+}
+
+// Face is identified by its three smallest node IDs, which is unique in conforming
+// meshes. Cell and local face index are packed to keep records small.
+template <typename IdType>
+struct FaceRecord {
+	std::array<IdType, 3> key;
+	IdType cellFace;
+
+	bool operator<(const FaceRecord& other) const { return key < other.key; }
+};
+
+template <typename IdType>
+vtkPolyData* ExtractBoundaryImpl(vtkUnstructuredGrid* grid) {
+	vtkPolyData* boundary = vtkPolyData::New();
+	boundary->SetPoints(grid->GetPoints());
+
+	const vtkIdType cellsNb = grid->GetNumberOfCells();
+	vtkCellArray* cells = grid->GetCells();
+	if (cellsNb == 0 || !cells)
+		return boundary;
+
+	// Faces offsets of cells, 2D cells are passed through
+	std::vector<vtkIdType> faceOffsets(cellsNb + 1, 0);
+	std::vector<vtkIdType> surfaceCells;
+	for (vtkIdType cellId = 0; cellId < cellsNb; ++cellId) {
+		const int cellType = grid->GetCellType(cellId);
+		const FaceTable* table = GetFaceTable(cellType);
+		faceOffsets[cellId + 1] = faceOffsets[cellId] + (table ? table->facesNb : 0);
+		if (IsSurfaceCell(cellType))
+			surfaceCells.push_back(cellId);
+	}
+
+	const vtkIdType facesNb = faceOffsets[cellsNb];
+	std::vector<FaceRecord<IdType>> faces(facesNb);
+
+	vtkSMPThreadLocalObject<vtkIdList> cellNodes;
+	vtkSMPTools::For(0, cellsNb, [&](vtkIdType begin, vtkIdType end) {
+		vtkIdList* nodeIds = cellNodes.Local();
+		for (vtkIdType cellId = begin; cellId < end; ++cellId) {
+			const FaceTable* table = GetFaceTable(grid->GetCellType(cellId));
+			if (!table)
+				continue;
+
+			cells->GetCellAtId(cellId, nodeIds);
+			for (int face = 0; face < table->facesNb; ++face) {
+				std::array<IdType, 4> faceNodes;
+				const int faceSize = table->sizes[face];
+				for (int i = 0; i < faceSize; ++i)
+					faceNodes[i] = static_cast<IdType>(nodeIds->GetId(table->nodes[face][i]));
+				std::sort(faceNodes.begin(), faceNodes.begin() + faceSize);
+
+				FaceRecord<IdType>& record = faces[faceOffsets[cellId] + face];
+				std::copy_n(faceNodes.begin(), 3, record.key.begin());
+				record.cellFace = static_cast<IdType>(cellId * 8 + face);
+			}
+		}
+	});
+
+	vtkSMPTools::Sort(faces.begin(), faces.end());
+
+	// Faces shared by two cells are adjacent after sorting
+	std::vector<char> boundaryFlags(facesNb, 0);
+	vtkSMPTools::For(0, facesNb, [&](vtkIdType begin, vtkIdType end) {
+		for (vtkIdType i = begin; i < end; ++i) {
+			boundaryFlags[i] = (i == 0 || faces[i - 1].key != faces[i].key)
+				&& (i == facesNb - 1 || faces[i + 1].key != faces[i].key);
+		}
+	});
+
+	std::vector<IdType> boundaryFaces;
+	for (vtkIdType i = 0; i < facesNb; ++i) {
+		if (boundaryFlags[i])
+			boundaryFaces.push_back(faces[i].cellFace);
+	}
+	faces.clear();
+	faces.shrink_to_fit();
+
+	const auto boundaryFacesNb = static_cast<vtkIdType>(boundaryFaces.size());
+	const auto polysNb = boundaryFacesNb + static_cast<vtkIdType>(surfaceCells.size());
+
+	vtkNew<vtkTypeInt64Array> offsets;
+	offsets->SetNumberOfValues(polysNb + 1);
+	offsets->SetValue(0, 0);
+	for (vtkIdType i = 0; i < boundaryFacesNb; ++i) {
+		const vtkIdType cellId = boundaryFaces[i] / 8;
+		const int face = static_cast<int>(boundaryFaces[i] % 8);
+		offsets->SetValue(
+			i + 1, offsets->GetValue(i) + GetFaceTable(grid->GetCellType(cellId))->sizes[face]);
+	}
+	for (vtkIdType i = 0; i < static_cast<vtkIdType>(surfaceCells.size()); ++i) {
+		const vtkIdType polyId = boundaryFacesNb + i;
+		offsets->SetValue(polyId + 1, offsets->GetValue(polyId) + cells->GetCellSize(surfaceCells[i]));
+	}
+
+	vtkNew<vtkTypeInt64Array> connectivity;
+	connectivity->SetNumberOfValues(offsets->GetValue(polysNb));
+	vtkSMPTools::For(0, polysNb, [&](vtkIdType begin, vtkIdType end) {
+		vtkIdList* nodeIds = cellNodes.Local();
+		for (vtkIdType polyId = begin; polyId < end; ++polyId) {
+			vtkTypeInt64 position = offsets->GetValue(polyId);
+			if (polyId >= boundaryFacesNb) {
+				cells->GetCellAtId(surfaceCells[polyId - boundaryFacesNb], nodeIds);
+				for (vtkIdType i = 0; i < nodeIds->GetNumberOfIds(); ++i)
+					connectivity->SetValue(position++, nodeIds->GetId(i));
+				continue;
+			}
+
+			const vtkIdType cellId = boundaryFaces[polyId] / 8;
+			const int face = static_cast<int>(boundaryFaces[polyId] % 8);
+			const FaceTable* table = GetFaceTable(grid->GetCellType(cellId));
+			cells->GetCellAtId(cellId, nodeIds);
+			for (int i = 0; i < table->sizes[face]; ++i)
+				connectivity->SetValue(position++, nodeIds->GetId(table->nodes[face][i]));
+		}
+	});
+
+	vtkNew<vtkCellArray> polys;
+	polys->SetData(offsets, connectivity);
+
+	boundary->SetPolys(polys);
+	return boundary;
+}
+
+}
+
+//----------------------------------------------------------------------------
+MGTMeshIO_Reader::MGTMeshIO_Reader() = default;
+
+//----------------------------------------------------------------------------
+MGTMeshIO_Reader::~MGTMeshIO_Reader() = default;
+
+//----------------------------------------------------------------------------
+vtkPolyData* MGTMeshIO_Reader::ExtractBoundary(vtkUnstructuredGrid* grid) {
+	// 32-bit records halve memory used for matching faces of large meshes
+	if (grid->GetNumberOfPoints() < std::numeric_limits<std::uint32_t>::max()
+		&& grid->GetNumberOfCells() < std::numeric_limits<std::uint32_t>::max() / 8) {
+		return ExtractBoundaryImpl<std::uint32_t>(grid);
+	}
+	return ExtractBoundaryImpl<std::uint64_t>(grid);
+}
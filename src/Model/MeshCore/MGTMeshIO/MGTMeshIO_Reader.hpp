@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_Reader.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef MGTMESHIO_READER_HPP
+#define MGTMESHIO_READER_HPP
+
+#include <string>
+
+class vtkPolyData;
+class vtkUnstructuredGrid;
+class MGTMesh_MeshObject;
+
+/**
+ * Base of mesh readers filling internal and boundary blocks of a mesh object.
+ * Both blocks share points, as blocks created by mesher plugins do.
+ */
+class MGTMeshIO_Reader {
+public:
+	MGTMeshIO_Reader();
+	virtual ~MGTMeshIO_Reader();
+
+	// Returns false if the file could not be read, mesh is not modified then
+	virtual bool Read(const std::string& filePath, MGTMesh_MeshObject* mesh) = 0;
+
+	// Faces of 3D cells used by a single cell and 2D cells of the grid, as polygons
+	// sharing points with the grid. Faces are collected and matched in parallel.
+	// Returned object is owned by the caller.
+	static vtkPolyData* ExtractBoundary(vtkUnstructuredGrid* grid);
+};
+
+#endif
@@ -0,0 +1,466 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_VTUReader.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "MGTMeshIO_VTUReader.hpp"
+#include "MGTMeshIO_MappedFile.hpp"
+#include "MGTMesh_MeshObject.hpp"
+
+#include <vtkCellArray.h>
+#include <vtkDoubleArray.h>
+#include <vtkFloatArray.h>
+#include <vtkInformation.h>
+#include <vtkInformationObjectBaseKey.h>
+#include <vtkNew.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkSMPThreadLocalObject.h>
+#include <vtkSMPTools.h>
+#include <vtkTypeInt32Array.h>
+#include <vtkTypeInt64Array.h>
+#include <vtkUnsignedCharArray.h>
+#include <vtkUnstructuredGrid.h>
+#include <vtkXMLUnstructuredGridReader.h>
+#include <vtkZLibDataCompressor.h>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <regex>
+#include <string_view>
+#include <unordered_map>
+
+namespace {
+
+using Attributes = std::unordered_map<std::string, std::string>;
+
+struct ArrayInfo {
+	std::string type;
+	int componentsNb = 1;
+	std::uint64_t offset = 0;
+	bool appended = false;
+	bool found = false;
+};
+
+struct Layout {
+	bool nativeByteOrder = true;
+	bool header64 = false;
+	std::string compressor;
+	int piecesNb = 0;
+	vtkIdType pointsNb = 0;
+	vtkIdType cellsNb = 0;
+	ArrayInfo points;
+	ArrayInfo connectivity;
+	ArrayInfo offsets;
+	ArrayInfo types;
+	ArrayInfo meshBlock;
+	std::size_t appendedStart = 0;
+};
+
+Attributes ParseAttributes(const std::string_view tag) {
+	static const std::regex attribute(R"re((\w+)\s*=\s*"([^"]*)")re");
+
+	Attributes attributes;
+	for (auto it = std::cregex_iterator(tag.data(), tag.data() + tag.size(), attribute);
+		it != std::cregex_iterator(); ++it) {
+		attributes[(*it)[1].str()] = (*it)[2].str();
+	}
+	return attributes;
+}
+
+ArrayInfo ParseArrayInfo(const Attributes& attributes) {
+	ArrayInfo info;
+	info.found = true;
+	if (const auto it = attributes.find("type"); it != attributes.end())
+		info.type = it->second;
+	if (const auto it = attributes.find("NumberOfComponents"); it != attributes.end())
+		info.componentsNb = std::stoi(it->second);
+	if (const auto it = attributes.find("offset"); it != attributes.end())
+		info.offset = std::stoull(it->second);
+	if (const auto it = attributes.find("format"); it != attributes.end())
+		info.appended = it->second == "appended";
+	return info;
+}
+
+// Returns false if arrays are not stored in the way allowing to map them
+bool ParseLayout(const std::string_view file, Layout& layout) {
+	const std::size_t appendedTag = file.find("<AppendedData");
+	if (appendedTag == std::string_view::npos)
+		return false;
+
+	const std::string_view header = file.substr(0, appendedTag);
+	std::string_view section;
+	for (std::size_t position = header.find('<'); position != std::string_view::npos;
+		position = header.find('<', position)) {
+		const std::size_t end = header.find('>', position);
+		if (end == std::string_view::npos)
+			break;
+
+		const std::string_view tag = header.substr(position + 1, end - position - 1);
+		position = end + 1;
+		if (tag.empty() || tag.front() == '?' || tag.front() == '!')
+			continue;
+
+		if (tag.front() == '/') {
+			if (tag.substr(1) == section)
+				section = {};
+			continue;
+		}
+
+		const std::string_view name = tag.substr(0, tag.find_first_of(" \t\r\n/"));
+		const Attributes attributes = ParseAttributes(tag);
+
+		if (name == "VTKFile") {
+			const auto byteOrder = attributes.find("byte_order");
+			const auto headerType = attributes.find("header_type");
+			const auto compressor = attributes.find("compressor");
+			const std::string_view native
+				= std::endian::native == std::endian::little ? "LittleEndian" : "BigEndian";
+			layout.nativeByteOrder = byteOrder == attributes.end() || byteOrder->second == native;
+			layout.header64 = headerType != attributes.end() && headerType->second == "UInt64";
+			layout.compressor = compressor != attributes.end() ? compressor->second : "";
+		} else if (name == "Piece") {
+			++layout.piecesNb;
+			if (const auto it = attributes.find("NumberOfPoints"); it != attributes.end())
+				layout.pointsNb = std::stoll(it->second);
+			if (const auto it = attributes.find("NumberOfCells"); it != attributes.end())
+				layout.cellsNb = std::stoll(it->second);
+		} else if (name == "DataArray") {
+			const auto arrayName = attributes.find("Name");
+			const std::string_view arrayNameView
+				= arrayName != attributes.end() ? std::string_view(arrayName->second) : "";
+			if (section == "Points") {
+				layout.points = ParseArrayInfo(attributes);
+			} else if (section == "Cells") {
+				if (arrayNameView == "connectivity")
+					layout.connectivity = ParseArrayInfo(attributes);
+				else if (arrayNameView == "offsets")
+					layout.offsets = ParseArrayInfo(attributes);
+				else if (arrayNameView == "types")
+					layout.types = ParseArrayInfo(attributes);
+			} else if (section == "CellData" && arrayNameView == "MeshBlock") {
+				layout.meshBlock = ParseArrayInfo(attributes);
+			}
+		} else if (tag.back() != '/') {
+			section = name;
+		}
+	}
+
+	const std::size_t appendedTagEnd = file.find('>', appendedTag);
+	if (appendedTagEnd == std::string_view::npos)
+		return false;
+	const Attributes appended
+		= ParseAttributes(file.substr(appendedTag, appendedTagEnd - appendedTag));
+	const auto encoding = appended.find("encoding");
+	const std::size_t dataMarker = file.find('_', appendedTagEnd);
+	if (encoding == appended.end() || encoding->second != "raw"
+		|| dataMarker == std::string_view::npos)
+		return false;
+	layout.appendedStart = dataMarker + 1;
+
+	const auto isAppended = [](const ArrayInfo& info) { return info.found && info.appended; };
+	return layout.nativeByteOrder && layout.piecesNb == 1
+		&& (layout.compressor.empty() || layout.compressor == "vtkZLibDataCompressor")
+		&& isAppended(layout.points) && isAppended(layout.connectivity)
+		&& isAppended(layout.offsets) && isAppended(layout.types)
+		&& (!layout.meshBlock.found || layout.meshBlock.appended);
+}
+
+std::uint64_t ReadHeaderValue(const std::byte* data, const bool header64) {
+	if (header64) {
+		std::uint64_t value;
+		std::memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	std::uint32_t value;
+	std::memcpy(&value, data, sizeof(value));
+	return value;
+}
+
+vtkSmartPointer<vtkDataArray> CreateArray(const std::string& type) {
+	if (type == "Float32")
+		return vtkSmartPointer<vtkFloatArray>::New();
+	if (type == "Float64")
+		return vtkSmartPointer<vtkDoubleArray>::New();
+	if (type == "Int32")
+		return vtkSmartPointer<vtkTypeInt32Array>::New();
+	if (type == "Int64")
+		return vtkSmartPointer<vtkTypeInt64Array>::New();
+	if (type == "UInt8")
+		return vtkSmartPointer<vtkUnsignedCharArray>::New();
+	return nullptr;
+}
+
+// Reads array from appended data section, returns nullptr if it cannot be read
+vtkSmartPointer<vtkDataArray> ReadArray(MGTMeshIO_MappedFile* file, const Layout& layout,
+	const ArrayInfo& info, const vtkIdType tuplesNb) {
+	vtkSmartPointer<vtkDataArray> array = CreateArray(info.type);
+	if (!array)
+		return nullptr;
+	array->SetNumberOfComponents(info.componentsNb);
+
+	const std::byte* data = file->GetData();
+	const std::size_t headerSize = layout.header64 ? 8 : 4;
+	const std::size_t position = layout.appendedStart + info.offset;
+	const std::uint64_t expectedSize
+		= static_cast<std::uint64_t>(tuplesNb) * info.componentsNb * array->GetDataTypeSize();
+
+	if (position + 3 * headerSize > file->GetSize())
+		return nullptr;
+
+	if (layout.compressor.empty()) {
+		if (ReadHeaderValue(data + position, layout.header64) != expectedSize)
+			return nullptr;
+		return file->WrapArray(array, position + headerSize, tuplesNb) ? array : nullptr;
+	}
+
+	// Compressed array header: blocks number, block size, size of last partial
+	// block (0 if full) and compressed sizes of all blocks
+	const auto blocksNb = static_cast<vtkIdType>(ReadHeaderValue(data + position, layout.header64));
+	const std::uint64_t blockSize = ReadHeaderValue(data + position + headerSize, layout.header64);
+	const std::uint64_t lastBlockSize
+		= ReadHeaderValue(data + position + 2 * headerSize, layout.header64);
+
+	if (position + (3 + blocksNb) * headerSize > file->GetSize())
+		return nullptr;
+
+	std::vector<std::uint64_t> blockOffsets(blocksNb + 1);
+	blockOffsets[0] = position + (3 + blocksNb) * headerSize;
+	for (vtkIdType i = 0; i < blocksNb; ++i) {
+		blockOffsets[i + 1] = blockOffsets[i]
+			+ ReadHeaderValue(data + position + (3 + i) * headerSize, layout.header64);
+	}
+
+	const std::uint64_t uncompressedSize
+		= blocksNb == 0 ? 0 : (blocksNb - 1) * blockSize + (lastBlockSize ? lastBlockSize : blockSize);
+	if (blockOffsets.back() > file->GetSize() || uncompressedSize != expectedSize)
+		return nullptr;
+
+	array->SetNumberOfTuples(tuplesNb);
+	auto* output = static_cast<unsigned char*>(array->GetVoidPointer(0));
+	const auto* input = reinterpret_cast<const unsigned char*>(data);
+
+	std::atomic<bool> succeeded = true;
+	vtkSMPThreadLocalObject<vtkZLibDataCompressor> compressors;
+	vtkSMPTools::For(0, blocksNb, [&](vtkIdType begin, vtkIdType end) {
+		vtkZLibDataCompressor* compressor = compressors.Local();
+		for (vtkIdType block = begin; block < end; ++block) {
+			const std::uint64_t size
+				= (block == blocksNb - 1 && lastBlockSize) ? lastBlockSize : blockSize;
+			const std::size_t outputSize = compressor->Uncompress(input + blockOffsets[block],
+				blockOffsets[block + 1] - blockOffsets[block], output + block * blockSize, size);
+			if (outputSize != size)
+				succeeded = false;
+		}
+	});
+
+	return succeeded ? array : nullptr;
+}
+
+// Tuples [first, first + count) of the array. Mapped arrays are sliced without copying.
+vtkSmartPointer<vtkDataArray> SliceArray(
+	vtkDataArray* array, const vtkIdType first, const vtkIdType count) {
+	const vtkSmartPointer<vtkDataArray> slice = vtk::TakeSmartPointer(array->NewInstance());
+	const int componentsNb = array->GetNumberOfComponents();
+	slice->SetNumberOfComponents(componentsNb);
+
+	void* source = array->GetVoidPointer(first * componentsNb);
+	vtkObjectBase* mappedFile = array->HasInformation()
+		? array->GetInformation()->Get(MGTMeshIO_MappedFile::MAPPED_FILE())
+		: nullptr;
+
+	if (mappedFile) {
+		slice->SetVoidArray(source, count * componentsNb, 1);
+		slice->GetInformation()->Set(MGTMeshIO_MappedFile::MAPPED_FILE(), mappedFile);
+	} else {
+		slice->SetNumberOfTuples(count);
+		std::memcpy(slice->GetVoidPointer(0), source,
+			count * componentsNb * static_cast<std::size_t>(array->GetDataTypeSize()));
+	}
+	return slice;
+}
+
+vtkTypeInt64 GetEndOffset(vtkDataArray* endOffsets, const vtkIdType cellId) {
+	if (cellId < 0)
+		return 0;
+	if (auto* offsets64 = vtkTypeInt64Array::SafeDownCast(endOffsets))
+		return offsets64->GetValue(cellId);
+	return vtkTypeInt32Array::SafeDownCast(endOffsets)->GetValue(cellId);
+}
+
+template <typename OffsetsArray, typename EndOffsetsArray>
+vtkSmartPointer<OffsetsArray> RebaseOffsets(
+	EndOffsetsArray* endOffsets, const vtkIdType first, const vtkIdType last) {
+	const auto offsets = vtkSmartPointer<OffsetsArray>::New();
+	offsets->SetNumberOfValues(last - first + 1);
+	offsets->SetValue(0, 0);
+
+	const auto base = static_cast<vtkTypeInt64>(first > 0 ? endOffsets->GetValue(first - 1) : 0);
+	vtkSMPTools::For(first, last, [&](vtkIdType begin, vtkIdType end) {
+		for (vtkIdType i = begin; i < end; ++i)
+			offsets->SetValue(i - first + 1, endOffsets->GetValue(i) - base);
+	});
+	return offsets;
+}
+
+// Cell array of cells [first, last), VTU stores end offsets of cells only
+template <typename ConnectivityArray>
+vtkSmartPointer<vtkCellArray> BuildCellArray(vtkDataArray* endOffsets,
+	vtkDataArray* connectivity, const vtkIdType first, const vtkIdType last) {
+	const vtkTypeInt64 connectivityFirst = GetEndOffset(endOffsets, first - 1);
+	const vtkTypeInt64 connectivityLast = GetEndOffset(endOffsets, last - 1);
+
+	vtkSmartPointer<ConnectivityArray> offsets;
+	if (auto* offsets64 = vtkTypeInt64Array::SafeDownCast(endOffsets)) {
+		offsets = RebaseOffsets<ConnectivityArray>(offsets64, first, last);
+	} else {
+		offsets = RebaseOffsets<ConnectivityArray>(
+			vtkTypeInt32Array::SafeDownCast(endOffsets), first, last);
+	}
+
+	const vtkSmartPointer<vtkDataArray> slice
+		= SliceArray(connectivity, connectivityFirst, connectivityLast - connectivityFirst);
+
+	const auto cells = vtkSmartPointer<vtkCellArray>::New();
+	cells->SetData(offsets, ConnectivityArray::SafeDownCast(slice));
+	return cells;
+}
+
+vtkSmartPointer<vtkCellArray> BuildCellArray(vtkDataArray* endOffsets,
+	vtkDataArray* connectivity, const vtkIdType first, const vtkIdType last) {
+	if (vtkTypeInt64Array::SafeDownCast(connectivity))
+		return BuildCellArray<vtkTypeInt64Array>(endOffsets, connectivity, first, last);
+	return BuildCellArray<vtkTypeInt32Array>(endOffsets, connectivity, first, last);
+}
+
+bool IsIndexArray(vtkDataArray* array) {
+	return vtkTypeInt64Array::SafeDownCast(array) || vtkTypeInt32Array::SafeDownCast(array);
+}
+
+}
+
+//----------------------------------------------------------------------------
+MGTMeshIO_VTUReader::MGTMeshIO_VTUReader() = default;
+
+//----------------------------------------------------------------------------
+MGTMeshIO_VTUReader::~MGTMeshIO_VTUReader() = default;
+
+//----------------------------------------------------------------------------
+bool MGTMeshIO_VTUReader::Read(const std::string& filePath, MGTMesh_MeshObject* mesh) {
+	vtkNew<MGTMeshIO_MappedFile> file;
+	if (!file->Open(filePath))
+		return false;
+
+	Layout layout;
+	const std::string_view content(reinterpret_cast<const char*>(file->GetData()), file->GetSize());
+	if (!ParseLayout(content, layout)) {
+		spdlog::debug("VTU file layout does not allow mapping, using XML reader: {}", filePath);
+		return ReadWithXMLReader(filePath, mesh);
+	}
+
+	const vtkIdType cellsNb = layout.cellsNb;
+	const vtkSmartPointer<vtkDataArray> points
+		= ReadArray(file, layout, layout.points, layout.pointsNb);
+	const vtkSmartPointer<vtkDataArray> endOffsets
+		= ReadArray(file, layout, layout.offsets, cellsNb);
+	const vtkSmartPointer<vtkDataArray> types = ReadArray(file, layout, layout.types, cellsNb);
+	const vtkSmartPointer<vtkDataArray> meshBlock
+		= layout.meshBlock.found ? ReadArray(file, layout, layout.meshBlock, cellsNb) : nullptr;
+
+	if (!points || points->GetNumberOfComponents() != 3 || !IsIndexArray(endOffsets)
+		|| !vtkUnsignedCharArray::SafeDownCast(types)) {
+		spdlog::debug("VTU arrays cannot be mapped, using XML reader: {}", filePath);
+		return ReadWithXMLReader(filePath, mesh);
+	}
+
+	const vtkSmartPointer<vtkDataArray> connectivity = ReadArray(
+		file, layout, layout.connectivity, GetEndOffset(endOffsets, cellsNb - 1));
+	if (!IsIndexArray(connectivity)) {
+		spdlog::debug("VTU connectivity cannot be mapped, using XML reader: {}", filePath);
+		return ReadWithXMLReader(filePath, mesh);
+	}
+
+	// Cells written by MGTMeshIO_VTUWriter: volume cells followed by boundary cells
+	vtkIdType volumeCellsNb = cellsNb;
+	bool splitBlocks = false;
+	if (auto* blocks = vtkUnsignedCharArray::SafeDownCast(meshBlock)) {
+		const unsigned char* begin = blocks->GetPointer(0);
+		const unsigned char* end = begin + cellsNb;
+		const unsigned char* boundaryBegin = std::find(begin, end, 1);
+		splitBlocks = std::all_of(boundaryBegin, end, [](unsigned char b) { return b == 1; });
+		if (splitBlocks)
+			volumeCellsNb = boundaryBegin - begin;
+	}
+
+	vtkNew<vtkPoints> meshPoints;
+	meshPoints->SetData(points);
+
+	if (volumeCellsNb > 0) {
+		vtkUnstructuredGrid* internalMesh = vtkUnstructuredGrid::New();
+		internalMesh->SetPoints(meshPoints);
+		internalMesh->SetCells(vtkUnsignedCharArray::SafeDownCast(SliceArray(types, 0, volumeCellsNb)),
+			BuildCellArray(endOffsets, connectivity, 0, volumeCellsNb));
+		mesh->SetInternalMesh(internalMesh);
+	}
+
+	if (splitBlocks && volumeCellsNb < cellsNb) {
+		vtkPolyData* boundaryMesh = vtkPolyData::New();
+		boundaryMesh->SetPoints(meshPoints);
+		boundaryMesh->SetPolys(BuildCellArray(endOffsets, connectivity, volumeCellsNb, cellsNb));
+		mesh->SetBoundaryMesh(boundaryMesh);
+	} else if (volumeCellsNb > 0) {
+		mesh->SetBoundaryMesh(ExtractBoundary(mesh->GetInternalMesh()));
+	}
+
+	SPDLOG_INFO("VTU mesh read: {} points, {} cells", layout.pointsNb, cellsNb);
+	return true;
+}
+
+//----------------------------------------------------------------------------
+bool MGTMeshIO_VTUReader::ReadWithXMLReader(
+	const std::string& filePath, MGTMesh_MeshObject* mesh) {
+	vtkNew<vtkXMLUnstructuredGridReader> reader;
+	if (!reader->CanReadFile(filePath.c_str())) {
+		SPDLOG_ERROR("File is not a valid VTU file: {}", filePath);
+		return false;
+	}
+
+	reader->SetFileName(filePath.c_str());
+	reader->Update();
+
+	vtkUnstructuredGrid* output = reader->GetOutput();
+	if (!output || output->GetNumberOfCells() == 0) {
+		SPDLOG_ERROR("No cells read from VTU file: {}", filePath);
+		return false;
+	}
+
+	vtkUnstructuredGrid* internalMesh = vtkUnstructuredGrid::New();
+	internalMesh->ShallowCopy(output);
+	mesh->SetInternalMesh(internalMesh);
+	mesh->SetBoundaryMesh(ExtractBoundary(internalMesh));
+	return true;
+}
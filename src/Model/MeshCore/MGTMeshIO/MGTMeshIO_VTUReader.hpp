@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_VTUReader.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef MGTMESHIO_VTUREADER_HPP
+#define MGTMESHIO_VTUREADER_HPP
+
+#include "MGTMeshIO_Reader.hpp"
+
+/**
+ * Reads VTK XML unstructured grid. Arrays stored in raw appended section are viewed
+ * in the memory-mapped file without copying, zlib compressed ones are decompressed
+ * block-wise in parallel. Other layouts are read with vtkXMLUnstructuredGridReader.
+ * Cells marked with "MeshBlock" cell array (as written by MGTMeshIO_VTUWriter) are
+ * split into internal and boundary blocks, otherwise boundary is extracted.
+ */
+class MGTMeshIO_VTUReader final : public MGTMeshIO_Reader {
+public:
+	MGTMeshIO_VTUReader();
+	~MGTMeshIO_VTUReader() override;
+
+	bool Read(const std::string& filePath, MGTMesh_MeshObject* mesh) override;
+
+private:
+	static bool ReadWithXMLReader(const std::string& filePath, MGTMesh_MeshObject* mesh);
+};
+
+#endif
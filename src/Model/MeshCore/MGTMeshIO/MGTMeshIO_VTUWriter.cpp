@@ -0,0 +1,366 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_VTUWriter.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "MGTMeshIO_VTUWriter.hpp"
+#include "MGTMeshIO_ChunkedWriter.hpp"
+
+#include <vtkCellData.h>
+#include <vtkDataArray.h>
+#include <vtkIdList.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPolyData.h>
+#include <vtkUnstructuredGrid.h>
+#include <vtkZLibDataCompressor.h>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <bit>
+#include <set>
+
+namespace {
+
+// Size of blocks the arrays are split into before compression (and of chunks
+// they are generated in)
+constexpr std::size_t BlockSize = 1 << 20;
+
+// Fixed-width placeholder of array offset, patched once the offset is known
+constexpr std::string_view OffsetPlaceholder = "00000000000000000000";
+
+std::size_t GetBlockValuesNb(const std::size_t valueSize, const int componentsNb) {
+	const std::size_t tupleSize = valueSize * componentsNb;
+	return std::max<std::size_t>(BlockSize / tupleSize, 1) * componentsNb;
+}
+
+// Names of single component arrays of any of the attributes, except given one
+std::set<std::string> GetDataArrayNames(
+	vtkDataSetAttributes* first, vtkDataSetAttributes* second, const std::string& excluded) {
+	std::set<std::string> names;
+	for (vtkDataSetAttributes* attributes : { first, second }) {
+		for (int i = 0; i < attributes->GetNumberOfArrays(); ++i) {
+			vtkDataArray* array = attributes->GetArray(i);
+			if (array && array->GetName() && array->GetNumberOfComponents() == 1
+				&& array->GetName() != excluded)
+				names.insert(array->GetName());
+		}
+	}
+	return names;
+}
+
+template <typename T>
+void GenerateDataValues(vtkDataArray* first, vtkDataArray* second,
+	const vtkIdType firstValuesNb, const vtkIdType secondOffset, const vtkIdType begin,
+	const vtkIdType count, void* values) {
+	auto* data = static_cast<T*>(values);
+	for (vtkIdType i = 0; i < count; ++i) {
+		const vtkIdType valueId = begin + i;
+		vtkDataArray* array = valueId < firstValuesNb ? first : second;
+		const vtkIdType arrayId = valueId < firstValuesNb ? valueId : valueId - secondOffset;
+		data[i] = array && arrayId < array->GetNumberOfTuples()
+			? static_cast<T>(array->GetComponent(arrayId, 0))
+			: T(0);
+	}
+}
+
+}
+
+//----------------------------------------------------------------------------
+MGTMeshIO_VTUWriter::MGTMeshIO_VTUWriter(const MGTMesh_MeshObject* mesh)
+	: MGTMeshIO_Writer(mesh)
+	, _compression(true)
+	, _compressionLevel(1) { }
+
+//----------------------------------------------------------------------------
+MGTMeshIO_VTUWriter::~MGTMeshIO_VTUWriter() = default;
+
+//----------------------------------------------------------------------------
+bool MGTMeshIO_VTUWriter::Write(const std::string& filePath) {
+	MGTMeshIO_ChunkedWriter writer(filePath);
+	if (!writer.IsGood()) {
+		SPDLOG_ERROR("Cannot open file for writing: {}", filePath);
+		return false;
+	}
+
+	const std::vector<ArraySource> meshSources = this->CreateArraySources();
+	const std::vector<ArraySource> cellDataSources = this->CreateCellDataSources();
+	const std::vector<ArraySource> pointDataSources = this->CreatePointDataSources();
+
+	// Arrays are appended in order of their headers
+	std::vector<const ArraySource*> sources;
+	std::vector<std::uint64_t> offsetPositions;
+
+	const auto writeArrayHeader = [&writer, &sources, &offsetPositions](
+									  const ArraySource& source) {
+		sources.push_back(&source);
+		writer.Print("        <DataArray type=\"{}\" Name=\"{}\" NumberOfComponents=\"{}\" "
+					 "format=\"appended\" offset=\"",
+			source.type, source.name, source.componentsNb);
+		offsetPositions.push_back(writer.Tell());
+		writer.Write(OffsetPlaceholder);
+		writer.Write(std::string_view("\"/>\n"));
+	};
+
+	writer.Print("<?xml version=\"1.0\"?>\n<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" "
+				 "byte_order=\"{}\" header_type=\"UInt64\"{}>\n",
+		std::endian::native == std::endian::little ? "LittleEndian" : "BigEndian",
+		_compression ? " compressor=\"vtkZLibDataCompressor\"" : "");
+	writer.Print("  <UnstructuredGrid>\n    <Piece NumberOfPoints=\"{}\" NumberOfCells=\"{}\">\n",
+		this->GetNumberOfNodes(),
+		this->GetNumberOfVolumeCells() + this->GetNumberOfBoundaryCells());
+
+	if (!pointDataSources.empty()) {
+		writer.Write(std::string_view("      <PointData>\n"));
+		for (const ArraySource& source : pointDataSources)
+			writeArrayHeader(source);
+		writer.Write(std::string_view("      </PointData>\n"));
+	}
+	writer.Write(std::string_view("      <Points>\n"));
+	writeArrayHeader(meshSources[0]);
+	writer.Write(std::string_view("      </Points>\n      <Cells>\n"));
+	writeArrayHeader(meshSources[1]);
+	writeArrayHeader(meshSources[2]);
+	writeArrayHeader(meshSources[3]);
+	writer.Write(std::string_view("      </Cells>\n      <CellData Scalars=\"MeshBlock\">\n"));
+	writeArrayHeader(meshSources[4]);
+	for (const ArraySource& source : cellDataSources)
+		writeArrayHeader(source);
+	writer.Write(std::string_view("      </CellData>\n    </Piece>\n  </UnstructuredGrid>\n"
+								  "  <AppendedData encoding=\"raw\">\n   _"));
+
+	const std::uint64_t appendedStart = writer.Tell();
+	for (std::size_t i = 0; i < sources.size(); ++i) {
+		const std::string offset = std::format("{:020}", writer.Tell() - appendedStart);
+		writer.Patch(offsetPositions[i], offset.data(), offset.size());
+
+		if (_compression) {
+			this->WriteCompressedArray(writer, *sources[i]);
+		} else {
+			this->WriteArray(writer, *sources[i]);
+		}
+	}
+	writer.Write(std::string_view("\n  </AppendedData>\n</VTKFile>\n"));
+
+	if (!writer.Close()) {
+		SPDLOG_ERROR("Error while writing file: {}", filePath);
+		return false;
+	}
+	return true;
+}
+
+//----------------------------------------------------------------------------
+std::vector<MGTMeshIO_VTUWriter::ArraySource>
+MGTMeshIO_VTUWriter::CreateArraySources() const {
+	const vtkIdType nodesNb = this->GetNumberOfNodes();
+	const vtkIdType volumeCellsNb = this->GetNumberOfVolumeCells();
+	const vtkIdType cellsNb = volumeCellsNb + this->GetNumberOfBoundaryCells();
+
+	std::vector<ArraySource> sources;
+
+	sources.push_back({ "Points", "Float64", 3, sizeof(double),
+		static_cast<std::uint64_t>(3 * nodesNb),
+		[this, nodesNb, next = vtkIdType(0)](void* values, std::size_t maxValuesNb) mutable {
+			const vtkIdType count
+				= std::min<vtkIdType>(static_cast<vtkIdType>(maxValuesNb / 3), nodesNb - next);
+			this->GetNodes(next, count, static_cast<double*>(values));
+			next += count;
+			return static_cast<std::size_t>(3 * count);
+		} });
+
+	// Cells may be split between generated chunks
+	sources.push_back({ "connectivity", "Int64", 1, sizeof(std::int64_t),
+		static_cast<std::uint64_t>(this->GetNumberOfConnectivityIds()),
+		[this, cellsNb, cellId = vtkIdType(0), position = vtkIdType(0),
+			nodeIds = vtkSmartPointer<vtkIdList>::New()](
+			void* values, std::size_t maxValuesNb) mutable {
+			auto* ids = static_cast<std::int64_t*>(values);
+			std::size_t valuesNb = 0;
+			while (valuesNb < maxValuesNb) {
+				if (position == nodeIds->GetNumberOfIds()) {
+					if (cellId == cellsNb)
+						break;
+					this->GetCellNodes(cellId++, nodeIds);
+					position = 0;
+					continue;
+				}
+				ids[valuesNb++] = nodeIds->GetId(position++);
+			}
+			return valuesNb;
+		} });
+
+	sources.push_back({ "offsets", "Int64", 1, sizeof(std::int64_t),
+		static_cast<std::uint64_t>(cellsNb),
+		[this, cellsNb, cellId = vtkIdType(0), offset = std::int64_t(0)](
+			void* values, std::size_t maxValuesNb) mutable {
+			auto* offsets = static_cast<std::int64_t*>(values);
+			const vtkIdType count
+				= std::min<vtkIdType>(static_cast<vtkIdType>(maxValuesNb), cellsNb - cellId);
+			for (vtkIdType i = 0; i < count; ++i) {
+				offset += this->GetCellSize(cellId++);
+				offsets[i] = offset;
+			}
+			return static_cast<std::size_t>(count);
+		} });
+
+	sources.push_back({ "types", "UInt8", 1, sizeof(std::uint8_t),
+		static_cast<std::uint64_t>(cellsNb),
+		[this, cellsNb, cellId = vtkIdType(0)](void* values, std::size_t maxValuesNb) mutable {
+			auto* types = static_cast<std::uint8_t*>(values);
+			const vtkIdType count
+				= std::min<vtkIdType>(static_cast<vtkIdType>(maxValuesNb), cellsNb - cellId);
+			for (vtkIdType i = 0; i < count; ++i)
+				types[i] = static_cast<std::uint8_t>(this->GetCellType(cellId++));
+			return static_cast<std::size_t>(count);
+		} });
+
+	sources.push_back({ "MeshBlock", "UInt8", 1, sizeof(std::uint8_t),
+		static_cast<std::uint64_t>(cellsNb),
+		[volumeCellsNb, cellsNb, cellId = vtkIdType(0)](
+			void* values, std::size_t maxValuesNb) mutable {
+			auto* blocks = static_cast<std::uint8_t*>(values);
+			const vtkIdType count
+				= std::min<vtkIdType>(static_cast<vtkIdType>(maxValuesNb), cellsNb - cellId);
+			for (vtkIdType i = 0; i < count; ++i, ++cellId)
+				blocks[i] = cellId < volumeCellsNb ? 0 : 1;
+			return static_cast<std::size_t>(count);
+		} });
+
+	return sources;
+}
+
+//----------------------------------------------------------------------------
+std::vector<MGTMeshIO_VTUWriter::ArraySource>
+MGTMeshIO_VTUWriter::CreateCellDataSources() const {
+	const vtkIdType volumeCellsNb = this->GetNumberOfVolumeCells();
+	const vtkIdType cellsNb = volumeCellsNb + this->GetNumberOfBoundaryCells();
+	vtkCellData* internalData = _internalMesh->GetCellData();
+	vtkCellData* boundaryData = _boundaryMesh->GetCellData();
+
+	std::vector<ArraySource> sources;
+	for (const std::string& name : GetDataArrayNames(internalData, boundaryData, "MeshBlock")) {
+		sources.push_back(CreateDataSource(name, internalData->GetArray(name.c_str()),
+			boundaryData->GetArray(name.c_str()), volumeCellsNb, volumeCellsNb, cellsNb));
+	}
+	return sources;
+}
+
+//----------------------------------------------------------------------------
+std::vector<MGTMeshIO_VTUWriter::ArraySource>
+MGTMeshIO_VTUWriter::CreatePointDataSources() const {
+	vtkPointData* internalData = _internalMesh->GetPointData();
+	vtkPointData* boundaryData = _boundaryMesh->GetPointData();
+
+	std::vector<ArraySource> sources;
+	for (const std::string& name : GetDataArrayNames(internalData, boundaryData, "")) {
+		sources.push_back(CreateDataSource(name, internalData->GetArray(name.c_str()),
+			boundaryData->GetArray(name.c_str()), _internalMesh->GetNumberOfPoints(),
+			this->GetBoundaryNodesOffset(), this->GetNumberOfNodes()));
+	}
+	return sources;
+}
+
+//----------------------------------------------------------------------------
+MGTMeshIO_VTUWriter::ArraySource MGTMeshIO_VTUWriter::CreateDataSource(
+	const std::string& name, vtkDataArray* first, vtkDataArray* second,
+	const vtkIdType firstValuesNb, const vtkIdType secondOffset, const vtkIdType valuesNb) {
+	// Integer arrays keep their type where it is common for the solvers, others are
+	// written as 64-bit integers or doubles
+	const int dataType = first ? first->GetDataType() : second->GetDataType();
+	const auto createGenerator = [=]<typename T>(T) -> ValuesGenerator {
+		return [=, next = vtkIdType(0)](void* values, std::size_t maxValuesNb) mutable {
+			const vtkIdType count
+				= std::min<vtkIdType>(static_cast<vtkIdType>(maxValuesNb), valuesNb - next);
+			GenerateDataValues<T>(first, second, firstValuesNb, secondOffset, next, count, values);
+			next += count;
+			return static_cast<std::size_t>(count);
+		};
+	};
+
+	const auto size = static_cast<std::uint64_t>(valuesNb);
+	switch (dataType) {
+	case VTK_UNSIGNED_CHAR:
+		return { name, "UInt8", 1, sizeof(std::uint8_t), size, createGenerator(std::uint8_t()) };
+	case VTK_INT:
+		return { name, "Int32", 1, sizeof(std::int32_t), size, createGenerator(std::int32_t()) };
+	case VTK_FLOAT:
+	case VTK_DOUBLE:
+		return { name, "Float64", 1, sizeof(double), size, createGenerator(double()) };
+	default:
+		return { name, "Int64", 1, sizeof(std::int64_t), size, createGenerator(std::int64_t()) };
+	}
+}
+
+//----------------------------------------------------------------------------
+void MGTMeshIO_VTUWriter::WriteArray(
+	MGTMeshIO_ChunkedWriter& writer, const ArraySource& source) const {
+	writer.WriteValue<std::uint64_t>(source.valuesNb * source.valueSize);
+
+	const std::size_t blockValuesNb = GetBlockValuesNb(source.valueSize, source.componentsNb);
+	std::vector<std::byte> block(blockValuesNb * source.valueSize);
+	ValuesGenerator generator = source.generator;
+
+	for (std::uint64_t written = 0; written < source.valuesNb;) {
+		const std::size_t valuesNb = generator(block.data(), blockValuesNb);
+		if (valuesNb == 0)
+			break;
+		writer.Write(block.data(), valuesNb * source.valueSize);
+		written += valuesNb;
+	}
+}
+
+//----------------------------------------------------------------------------
+void MGTMeshIO_VTUWriter::WriteCompressedArray(
+	MGTMeshIO_ChunkedWriter& writer, const ArraySource& source) const {
+	const std::size_t blockValuesNb = GetBlockValuesNb(source.valueSize, source.componentsNb);
+	const std::uint64_t blockSize = blockValuesNb * source.valueSize;
+	const std::uint64_t totalSize = source.valuesNb * source.valueSize;
+	const std::uint64_t blocksNb = (totalSize + blockSize - 1) / blockSize;
+
+	// Header: blocks number, block size, size of last partial block (0 if full)
+	// and compressed sizes of all blocks
+	std::vector<std::uint64_t> header(3 + blocksNb, 0);
+	header[0] = blocksNb;
+	header[1] = blockSize;
+	header[2] = totalSize % blockSize;
+
+	const std::uint64_t headerPosition = writer.Tell();
+	writer.Write(header.data(), header.size() * sizeof(std::uint64_t));
+
+	vtkNew<vtkZLibDataCompressor> compressor;
+	compressor->SetCompressionLevel(_compressionLevel);
+
+	std::vector<unsigned char> block(blockSize);
+	std::vector<unsigned char> compressed(compressor->GetMaximumCompressionSpace(blockSize));
+	ValuesGenerator generator = source.generator;
+
+	for (std::uint64_t i = 0; i < blocksNb; ++i) {
+		const std::size_t valuesNb = generator(block.data(), blockValuesNb);
+		const std::size_t compressedSize = compressor->Compress(
+			block.data(), valuesNb * source.valueSize, compressed.data(), compressed.size());
+		writer.Write(compressed.data(), compressedSize);
+		header[3 + i] = compressedSize;
+	}
+
+	writer.Patch(headerPosition, header.data(), header.size() * sizeof(std::uint64_t));
+}
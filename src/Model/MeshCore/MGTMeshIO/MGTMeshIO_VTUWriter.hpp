@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_VTUWriter.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef MGTMESHIO_VTUWRITER_HPP
+#define MGTMESHIO_VTUWRITER_HPP
+
+#include "MGTMeshIO_Writer.hpp"
+
+#include <cstdint>
+#include <functional>
+
+class MGTMeshIO_ChunkedWriter;
+class vtkDataArray;
+class vtkDataSetAttributes;
+
+/**
+ * Writes mesh as VTK XML unstructured grid with all arrays in appended binary
+ * section (raw or zlib compressed). Boundary cells follow volume cells, "MeshBlock"
+ * cell array tells them apart (0 - internal, 1 - boundary). Single component cell
+ * and point data arrays of both blocks are written too (e.g. partition IDs and
+ * ghost cells of partitioned meshes), values missing in one of the blocks are 0.
+ */
+class MGTMeshIO_VTUWriter final : public MGTMeshIO_Writer {
+public:
+	explicit MGTMeshIO_VTUWriter(const MGTMesh_MeshObject* mesh);
+	~MGTMeshIO_VTUWriter() override;
+
+	void SetCompression(bool compression) { _compression = compression; }
+	void SetCompressionLevel(int level) { _compressionLevel = level; }
+
+	bool Write(const std::string& filePath) override;
+
+private:
+	// Fills buffer with at most given number of next values of the array,
+	// returns number of values written
+	using ValuesGenerator = std::function<std::size_t(void* values, std::size_t maxValuesNb)>;
+
+	struct ArraySource {
+		std::string name;
+		const char* type;
+		int componentsNb;
+		std::size_t valueSize;
+		std::uint64_t valuesNb;
+		ValuesGenerator generator;
+	};
+
+	std::vector<ArraySource> CreateArraySources() const;
+	std::vector<ArraySource> CreateCellDataSources() const;
+	std::vector<ArraySource> CreatePointDataSources() const;
+
+	// Values [0, firstValuesNb) are taken from first array, the following ones from
+	// second array at index shifted by secondOffset. Any of arrays may be missing.
+	static ArraySource CreateDataSource(const std::string& name, vtkDataArray* first,
+		vtkDataArray* second, vtkIdType firstValuesNb, vtkIdType secondOffset,
+		vtkIdType valuesNb);
+	void WriteArray(MGTMeshIO_ChunkedWriter& writer, const ArraySource& source) const;
+	void WriteCompressedArray(MGTMeshIO_ChunkedWriter& writer, const ArraySource& source) const;
+
+private:
+	bool _compression;
+	int _compressionLevel;
+};
+
+#endif
@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_Writer.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "MGTMeshIO_Writer.hpp"
+#include "MGTMesh_MeshData.hpp"
+#include "MGTMesh_MeshObject.hpp"
+
+#include <vtkCellArray.h>
+#include <vtkCellType.h>
+#include <vtkDataArray.h>
+#include <vtkIdList.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkUnstructuredGrid.h>
+
+#include <algorithm>
+
+namespace {
+
+void CopyNodes(vtkPoints* points, const vtkIdType first, const vtkIdType count,
+	double* coords) {
+	vtkDataArray* data = points->GetData();
+	for (vtkIdType i = 0; i < count; ++i)
+		data->GetTuple(first + i, coords + 3 * i);
+}
+
+// Blocks share nodes if they were made from the same node list, e.g. by mesh data, by
+// readers and partitioner, or by appending blocks of the same parts in the same order
+bool ShareNodes(const MGTMesh_MeshObject* mesh, vtkPoints* internal, vtkPoints* boundary) {
+	if (mesh && mesh->GetMeshData())
+		return true;
+	if (!internal || !boundary)
+		return !internal || internal->GetNumberOfPoints() == 0;
+	if (internal == boundary || internal->GetData() == boundary->GetData())
+		return true;
+
+	const vtkIdType nodesNb = internal->GetNumberOfPoints();
+	if (nodesNb == 0)
+		return true;
+	if (boundary->GetNumberOfPoints() != nodesNb)
+		return false;
+	for (vtkIdType i = 0; i < nodesNb; ++i) {
+		double internalNode[3], boundaryNode[3];
+		internal->GetPoint(i, internalNode);
+		boundary->GetPoint(i, boundaryNode);
+		if (!std::equal(internalNode, internalNode + 3, boundaryNode))
+			return false;
+	}
+	return true;
+}
+
+}
+
+//----------------------------------------------------------------------------
+MGTMeshIO_Writer::MGTMeshIO_Writer(const MGTMesh_MeshObject* mesh)
+	: _internalMesh(mesh ? mesh->GetInternalMesh() : nullptr)
+	, _boundaryMesh(mesh ? mesh->GetBoundaryMesh() : nullptr)
+	, _partName("Part")
+	, _internalNodesNb(0)
+	, _boundaryNodesOffset(0)
+	, _volumeCellsNb(0) {
+	if (!_internalMesh)
+		_internalMesh = vtkSmartPointer<vtkUnstructuredGrid>::New();
+	if (!_boundaryMesh)
+		_boundaryMesh = vtkSmartPointer<vtkPolyData>::New();
+
+	_internalNodesNb = _internalMesh->GetNumberOfPoints();
+	_volumeCellsNb = _internalMesh->GetNumberOfCells();
+
+	const bool shareNodes
+		= ShareNodes(mesh, _internalMesh->GetPoints(), _boundaryMesh->GetPoints());
+	_boundaryNodesOffset = shareNodes ? 0 : _internalNodesNb;
+}
+
+//----------------------------------------------------------------------------
+MGTMeshIO_Writer::~MGTMeshIO_Writer() = default;
+
+//----------------------------------------------------------------------------
+vtkIdType MGTMeshIO_Writer::GetNumberOfNodes() const {
+	return std::max(_internalNodesNb, _boundaryNodesOffset + _boundaryMesh->GetNumberOfPoints());
+}
+
+//----------------------------------------------------------------------------
+vtkIdType MGTMeshIO_Writer::GetNumberOfVolumeCells() const {
+	return _volumeCellsNb;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType MGTMeshIO_Writer::GetNumberOfBoundaryCells() const {
+	return _boundaryMesh->GetNumberOfPolys();
+}
+
+//----------------------------------------------------------------------------
+vtkIdType MGTMeshIO_Writer::GetNumberOfConnectivityIds() const {
+	vtkIdType idsNb = 0;
+	if (vtkCellArray* cells = _internalMesh->GetCells())
+		idsNb += cells->GetNumberOfConnectivityIds();
+	if (vtkCellArray* polys = _boundaryMesh->GetPolys())
+		idsNb += polys->GetNumberOfConnectivityIds();
+	return idsNb;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType MGTMeshIO_Writer::GetBoundaryNodesOffset() const {
+	return _boundaryNodesOffset;
+}
+
+//----------------------------------------------------------------------------
+void MGTMeshIO_Writer::GetNodes(
+	const vtkIdType first, const vtkIdType count, double* coords) const {
+	const vtkIdType internalEnd = std::min(first + count, _internalNodesNb);
+	if (first < internalEnd)
+		CopyNodes(_internalMesh->GetPoints(), first, internalEnd - first, coords);
+
+	const vtkIdType boundaryFirst = std::max(first, internalEnd);
+	if (boundaryFirst < first + count)
+		CopyNodes(_boundaryMesh->GetPoints(), boundaryFirst - _boundaryNodesOffset,
+			first + count - boundaryFirst, coords + 3 * (boundaryFirst - first));
+}
+
+//----------------------------------------------------------------------------
+int MGTMeshIO_Writer::GetCellType(const vtkIdType cellId) const {
+	if (cellId < _volumeCellsNb)
+		return _internalMesh->GetCellType(cellId);
+
+	// Boundary block holds polygons only, their type follows from the size
+	switch (_boundaryMesh->GetPolys()->GetCellSize(cellId - _volumeCellsNb)) {
+	case 3:
+		return VTK_TRIANGLE;
+	case 4:
+		return VTK_QUAD;
+	default:
+		return VTK_POLYGON;
+	}
+}
+
+//----------------------------------------------------------------------------
+vtkIdType MGTMeshIO_Writer::GetCellSize(const vtkIdType cellId) const {
+	if (cellId < _volumeCellsNb)
+		return _internalMesh->GetCells()->GetCellSize(cellId);
+	return _boundaryMesh->GetPolys()->GetCellSize(cellId - _volumeCellsNb);
+}
+
+//----------------------------------------------------------------------------
+void MGTMeshIO_Writer::GetCellNodes(const vtkIdType cellId, vtkIdList* nodeIds) const {
+	if (cellId < _volumeCellsNb) {
+		_internalMesh->GetCells()->GetCellAtId(cellId, nodeIds);
+		return;
+	}
+
+	_boundaryMesh->GetPolys()->GetCellAtId(cellId - _volumeCellsNb, nodeIds);
+	if (_boundaryNodesOffset == 0)
+		return;
+	for (vtkIdType i = 0; i < nodeIds->GetNumberOfIds(); ++i)
+		nodeIds->SetId(i, nodeIds->GetId(i) + _boundaryNodesOffset);
+}
+
+//----------------------------------------------------------------------------
+std::vector<int> MGTMeshIO_Writer::GetVolumeCellTypes() const {
+	std::vector<int> types;
+	for (vtkIdType i = 0; i < _volumeCellsNb; ++i) {
+		const int type = _internalMesh->GetCellType(i);
+		if (std::find(types.begin(), types.end(), type) == types.end())
+			types.push_back(type);
+	}
+	return types;
+}
+
+//----------------------------------------------------------------------------
+std::vector<int> MGTMeshIO_Writer::GetBoundaryCellTypes() const {
+	std::vector<int> types;
+	const vtkIdType cellsNb = this->GetNumberOfBoundaryCells();
+	for (vtkIdType i = 0; i < cellsNb; ++i) {
+		const int type = this->GetCellType(_volumeCellsNb + i);
+		if (std::find(types.begin(), types.end(), type) == types.end())
+			types.push_back(type);
+	}
+	return types;
+}
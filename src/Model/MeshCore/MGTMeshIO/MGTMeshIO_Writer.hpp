@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : MGTMeshIO_Writer.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef MGTMESHIO_WRITER_HPP
+#define MGTMESHIO_WRITER_HPP
+
+#include <vtkSmartPointer.h>
+#include <vtkType.h>
+
+#include <string>
+#include <vector>
+
+class vtkCellArray;
+class vtkIdList;
+class vtkPoints;
+class vtkPolyData;
+class vtkUnstructuredGrid;
+class MGTMesh_MeshObject;
+
+/**
+ * Base of mesh writers. Gives unified access to nodes and cells of internal and
+ * boundary blocks of the mesh object. Both blocks share nodes if they are views of the
+ * same mesh data, use the same points or have identical node coordinates, otherwise
+ * nodes of boundary block are numbered after internal ones.
+ */
+class MGTMeshIO_Writer {
+public:
+	explicit MGTMeshIO_Writer(const MGTMesh_MeshObject* mesh);
+	virtual ~MGTMeshIO_Writer();
+
+	// Returns false if the file could not be written
+	virtual bool Write(const std::string& filePath) = 0;
+
+	void SetPartName(const std::string& partName) { _partName = partName; }
+
+protected:
+	[[nodiscard]] vtkIdType GetNumberOfNodes() const;
+	[[nodiscard]] vtkIdType GetNumberOfVolumeCells() const;
+	[[nodiscard]] vtkIdType GetNumberOfBoundaryCells() const;
+	[[nodiscard]] vtkIdType GetNumberOfConnectivityIds() const;
+
+	// Nodes below number of internal nodes belong to internal block, others are nodes
+	// of boundary block shifted by this offset
+	[[nodiscard]] vtkIdType GetBoundaryNodesOffset() const;
+
+	// Copies coordinates of nodes [first, first + count) to coords (3 per node)
+	void GetNodes(vtkIdType first, vtkIdType count, double* coords) const;
+
+	// Cells are indexed with volume cells first, followed by boundary cells
+	[[nodiscard]] int GetCellType(vtkIdType cellId) const;
+	[[nodiscard]] vtkIdType GetCellSize(vtkIdType cellId) const;
+	void GetCellNodes(vtkIdType cellId, vtkIdList* nodeIds) const;
+
+	// Distinct cell types of each block, in order of first appearance
+	[[nodiscard]] std::vector<int> GetVolumeCellTypes() const;
+	[[nodiscard]] std::vector<int> GetBoundaryCellTypes() const;
+
+protected:
+	vtkSmartPointer<vtkUnstructuredGrid> _internalMesh;
+	vtkSmartPointer<vtkPolyData> _boundaryMesh;
+	std::string _partName;
+
+private:
+	vtkIdType _internalNodesNb;
+	vtkIdType _boundaryNodesOffset;
+	vtkIdType _volumeCellsNb;
+};
+
+#endif
@@ -25,161 +25,205 @@
 #include "MGTMeshUtils_ControlPoint.h"
 
 #include <BRepMesh_IncrementalMesh.hxx>
+#include <BRep_Builder.hxx>
 #include <BRep_Tool.hxx>
-#include <Poly_Array1OfTriangle.hxx>
 #include <Poly_Triangulation.hxx>
-#include <TColgp_Array1OfPnt.hxx>
 #include <TopLoc_Location.hxx>
+#include <TopoDS_Compound.hxx>
 #include <TopoDS_Face.hxx>
-#include <gp_Ax3.hxx>
-#include <gp_Dir.hxx>
 #include <gp_Trsf.hxx>
 
-namespace MGTMeshUtils {
-// Surface sampling functions
-void subdivideTriangle(const gp_Pnt& p1,
-	const gp_Pnt& p2,
-	const gp_Pnt& p3,
-	const double& theSize,
-	std::vector<ControlPoint>& thePoints);
-
-void computePointsForSplitting(const gp_Pnt& p1,
-	const gp_Pnt& p2,
-	const gp_Pnt& p3,
-	gp_Pnt midPoints[3]);
-
-gp_Pnt tangencyPoint(const gp_Pnt& p1,
-	const gp_Pnt& p2,
-	const gp_Pnt& Center);
+#include <vtkSMPTools.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <ranges>
+#include <unordered_map>
+
+namespace {
+
+// Points of adjacent faces closer than this fraction of size are merged
+constexpr double DuplicateTolerance = 0.05;
+
+using Triangle = std::array<gp_XYZ, 3>;
+
+//----------------------------------------------------------------------------
+// Point on side from p1 to p2 at given distance from p1
+gp_XYZ pointOnSide(const gp_XYZ& p1, const gp_XYZ& p2, const double distance, const double length) {
+	return length > 0.0 ? p1 + (p2 - p1) * (distance / length) : p1;
 }
 
 //----------------------------------------------------------------------------
-void MGTMeshUtils::createPointsSampleFromFace(
-	const TopoDS_Face& theFace, const double& theSize, std::vector<ControlPoint>& thePoints) {
-	BRepMesh_IncrementalMesh M(theFace, 0.01, Standard_True);
-	TopLoc_Location location;
+// Splits triangle at tangency points of its incircle until its sides are shorter than
+// the threshold and adds mass centers of resulting triangles. Tangency points are
+// computed from side lengths, so no local coordinate system is needed.
+void subdivideTriangle(const Triangle& triangle, const double theSize,
+	std::vector<MGTMeshUtils::ControlPoint>& thePoints) {
+	// This value ensures that two control points are distant no more than 2*theSize
+	const double threshold = std::sqrt(3.) * theSize;
+
+	std::vector<Triangle> stack { triangle };
+	while (!stack.empty()) {
+		const auto [p1, p2, p3] = stack.back();
+		stack.pop_back();
+
+		const double a = (p3 - p2).Modulus();
+		const double b = (p1 - p3).Modulus();
+		const double c = (p2 - p1).Modulus();
+		const double maxSide = std::max({ a, b, c });
+		const bool isDegenerated
+			= (p2 - p1).Crossed(p3 - p1).Modulus() <= 1e-12 * maxSide * maxSide;
+
+		if (maxSide <= threshold || isDegenerated) {
+			thePoints.emplace_back(gp_Pnt((p1 + p2 + p3) / 3.), theSize);
+			continue;
+		}
+
+		// see http://mathworld.wolfram.com/Incircle.html
+		const double s = 0.5 * (a + b + c);
+		const gp_XYZ t1 = pointOnSide(p1, p2, s - a, c);
+		const gp_XYZ t2 = pointOnSide(p2, p3, s - b, a);
+		const gp_XYZ t3 = pointOnSide(p3, p1, s - c, b);
 
-	// Triangulate the face
-	Handle(Poly_Triangulation) aTri = BRep_Tool::Triangulation(theFace, location);
+		stack.push_back({ t1, t2, t3 });
+		stack.push_back({ t1, p2, t2 });
+		stack.push_back({ t3, t2, p3 });
+		stack.push_back({ p1, t1, t3 });
+	}
+}
+
+//----------------------------------------------------------------------------
+// Samples existing triangulation of the face
+void sampleTriangulation(const TopoDS_Face& theFace, const double theSize,
+	std::vector<MGTMeshUtils::ControlPoint>& thePoints) {
+	TopLoc_Location location;
+	const Handle(Poly_Triangulation) aTri = BRep_Tool::Triangulation(theFace, location);
+	if (aTri.IsNull())
+		return;
 
 	// Get the transformation associated to the face location
-	gp_Trsf aTrsf = location.Transformation();
+	const gp_Trsf aTrsf = location.Transformation();
 
-	// Get triangles
-	int nbTriangles = aTri->NbTriangles();
+	const int nbTriangles = aTri->NbTriangles();
 	thePoints.reserve(thePoints.size() + nbTriangles);
 	for (int i = 1; i <= nbTriangles; i++) {
-		const Poly_Triangle& aTriangle = aTri->Triangle(i); // Get triangle by index
-		gp_Pnt p1 = aTri->Node(aTriangle.Value(1)); // Get node by index
-		gp_Pnt p2 = aTri->Node(aTriangle.Value(2)); // Get node by index
-		gp_Pnt p3 = aTri->Node(aTriangle.Value(3)); // Get node by index
-
-		p1.Transform(aTrsf);
-		p2.Transform(aTrsf);
-		p3.Transform(aTrsf);
-
-		subdivideTriangle(p1, p2, p3, theSize, thePoints);
+		const Poly_Triangle& aTriangle = aTri->Triangle(i);
+		Triangle triangle;
+		for (int k = 0; k < 3; ++k)
+			triangle[k] = aTri->Node(aTriangle.Value(k + 1)).Transformed(aTrsf).XYZ();
+		subdivideTriangle(triangle, theSize, thePoints);
 	}
 }
 
 //----------------------------------------------------------------------------
-void MGTMeshUtils::subdivideTriangle(const gp_Pnt& p1,
-	const gp_Pnt& p2,
-	const gp_Pnt& p3,
-	const double& theSize,
-	std::vector<ControlPoint>& thePoints) {
-	// Size threshold to stop subdividing
-	// This value ensures that two control points are distant no more than 2*theSize
-	double threshold = sqrt(3.) * theSize;
-
-	if (p1.Distance(p2) > threshold || p2.Distance(p3) > threshold || p3.Distance(p1) > threshold)
-		try {
-			gp_Pnt midPoints[3];
-			computePointsForSplitting(p1, p2, p3, midPoints);
-
-			subdivideTriangle(midPoints[0], midPoints[1], midPoints[2], theSize, thePoints);
-			subdivideTriangle(midPoints[0], p2, midPoints[1], theSize, thePoints);
-			subdivideTriangle(midPoints[2], midPoints[1], p3, theSize, thePoints);
-			subdivideTriangle(p1, midPoints[0], midPoints[2], theSize, thePoints);
-			return;
-		} catch (...) {
-		}
+bool hasTriangulation(const TopoDS_Face& theFace) {
+	TopLoc_Location location;
+	return !BRep_Tool::Triangulation(theFace, location).IsNull();
+}
 
-	gp_Pnt massCenter = (p1.XYZ() + p2.XYZ() + p3.XYZ()) / 3.;
-	thePoints.emplace_back(massCenter, theSize);
 }
 
 //----------------------------------------------------------------------------
-void MGTMeshUtils::computePointsForSplitting(const gp_Pnt& p1,
-	const gp_Pnt& p2,
-	const gp_Pnt& p3,
-	gp_Pnt midPoints[3]) {
-	// Change coordinates
-	gp_Trsf Trsf_1; // Identity transformation
-	gp_Ax3 reference_system(gp::Origin(), gp::DZ(), gp::DX()); // OXY
-
-	gp_Vec Vx(p1, p3);
-	gp_Vec Vaux(p1, p2);
-	gp_Dir Dx(Vx);
-	gp_Dir Daux(Vaux);
-	gp_Dir Dz = Dx.Crossed(Daux);
-	gp_Ax3 current_system(p1, Dz, Dx);
-
-	Trsf_1.SetTransformation(reference_system, current_system);
-
-	gp_Pnt A = p1.Transformed(Trsf_1);
-	gp_Pnt B = p2.Transformed(Trsf_1);
-	gp_Pnt C = p3.Transformed(Trsf_1);
-
-	double a = B.Distance(C);
-	double b = A.Distance(C);
-	double c = B.Distance(A);
-
-	// Incenter coordinates
-	// see http://mathworld.wolfram.com/Incenter.html
-	double Xi = (b * B.X() + c * C.X()) / (a + b + c);
-	double Yi = (b * B.Y()) / (a + b + c);
-	gp_Pnt Center(Xi, Yi, 0);
-
-	// Calculate the tangency points of the incircle
-	gp_Pnt T1 = tangencyPoint(A, B, Center);
-	gp_Pnt T2 = tangencyPoint(B, C, Center);
-	gp_Pnt T3 = tangencyPoint(C, A, Center);
-
-	midPoints[0] = T1.Transformed(Trsf_1.Inverted());
-	midPoints[1] = T2.Transformed(Trsf_1.Inverted());
-	midPoints[2] = T3.Transformed(Trsf_1.Inverted());
-
-	return;
+void MGTMeshUtils::createPointsSampleFromFace(
+	const TopoDS_Face& theFace, const double& theSize, std::vector<ControlPoint>& thePoints) {
+	if (!hasTriangulation(theFace))
+		BRepMesh_IncrementalMesh M(theFace, 0.01, Standard_True);
+	sampleTriangulation(theFace, theSize, thePoints);
 }
 
 //----------------------------------------------------------------------------
-gp_Pnt MGTMeshUtils::tangencyPoint(const gp_Pnt& p1,
-	const gp_Pnt& p2,
-	const gp_Pnt& Center) {
-	double Xt = 0;
-	double Yt = 0;
-
-	// The tangency point is the intersection of the straight line (p1 p2)
-	// and the straight line (Center T) which is orthogonal to (p1 p2)
-	if (fabs(p1.X() - p2.X()) <= Precision::Confusion()) {
-		Xt = p1.X(); // T is on (p1 p2)
-		Yt = Center.Y(); // (Center T) is orthogonal to (p1 p2)
-	} else if (fabs(p1.Y() - p2.Y()) <= Precision::Confusion()) {
-		Yt = p1.Y(); // T is on (p1 p2)
-		Xt = Center.X(); // (Center T) is orthogonal to (p1 p2)
-	} else {
-		// First straight line coefficients (equation y=a*x+b)
-		double a = (p2.Y() - p1.Y()) / (p2.X() - p1.X());
-		double b = p1.Y() - a * p1.X(); // p1 is on this straight line
-
-		// Second straight line coefficients (equation y=c*x+d)
-		double c = -1 / a; // The 2 lines are orthogonal
-		double d = Center.Y() - c * Center.X(); // Center is on this straight line
-
-		Xt = (d - b) / (a - c);
-		Yt = a * Xt + b;
+void MGTMeshUtils::createPointsSampleFromFaces(
+	const std::vector<std::pair<TopoDS_Face, double>>& theFaces,
+	std::vector<ControlPoint>& thePoints) {
+	// Faces are triangulated at once, meshing shares edges so it cannot run per face
+	BRep_Builder builder;
+	TopoDS_Compound untriangulated;
+	builder.MakeCompound(untriangulated);
+	bool isAnyUntriangulated = false;
+	for (const TopoDS_Face& face : theFaces | std::views::keys) {
+		if (!hasTriangulation(face)) {
+			builder.Add(untriangulated, face);
+			isAnyUntriangulated = true;
+		}
 	}
+	if (isAnyUntriangulated)
+		BRepMesh_IncrementalMesh M(untriangulated, 0.01, Standard_True, 0.5, Standard_True);
+
+	// Points are collected per face to keep their order independent of threads
+	std::vector<std::vector<ControlPoint>> facesPoints(theFaces.size());
+	const auto facesNb = static_cast<vtkIdType>(theFaces.size());
+	vtkSMPTools::For(0, facesNb, [&](vtkIdType begin, vtkIdType end) {
+		for (vtkIdType i = begin; i < end; ++i)
+			sampleTriangulation(theFaces[i].first, theFaces[i].second, facesPoints[i]);
+	});
+
+	std::vector<ControlPoint> points;
+	for (const std::vector<ControlPoint>& facePoints : facesPoints)
+		points.insert(points.end(), facePoints.begin(), facePoints.end());
+	removeDuplicatePoints(points, DuplicateTolerance);
+	thePoints.insert(thePoints.end(), points.begin(), points.end());
+}
+
+//----------------------------------------------------------------------------
+void MGTMeshUtils::removeDuplicatePoints(
+	std::vector<ControlPoint>& thePoints, const double theTolerance) {
+	if (thePoints.empty() || theTolerance <= 0.0)
+		return;
+
+	// Cells of spatial hash are as large as the largest merging distance
+	double maxSize = 0.0;
+	for (const ControlPoint& point : thePoints)
+		maxSize = std::max(maxSize, point.Size());
+	const double cellSize = theTolerance * maxSize;
+	if (cellSize <= 0.0)
+		return;
+
+	const auto getCell = [cellSize](const gp_Pnt& point) {
+		return std::array<std::int64_t, 3> {
+			static_cast<std::int64_t>(std::floor(point.X() / cellSize)),
+			static_cast<std::int64_t>(std::floor(point.Y() / cellSize)),
+			static_cast<std::int64_t>(std::floor(point.Z() / cellSize)) };
+	};
+	const auto getKey = [](const std::array<std::int64_t, 3>& cell) {
+		return static_cast<std::uint64_t>(cell[0]) * 73856093u
+			^ static_cast<std::uint64_t>(cell[1]) * 19349663u
+			^ static_cast<std::uint64_t>(cell[2]) * 83492791u;
+	};
+
+	// Kept points by hash of their cell, different cells may share a key
+	std::unordered_map<std::uint64_t, std::vector<std::size_t>> cells;
+	std::vector<ControlPoint> keptPoints;
+	keptPoints.reserve(thePoints.size());
+	for (const ControlPoint& point : thePoints) {
+		const std::array<std::int64_t, 3> cell = getCell(point);
+		std::size_t duplicate = keptPoints.size();
+		for (int i = -1; i <= 1 && duplicate == keptPoints.size(); ++i) {
+			for (int j = -1; j <= 1 && duplicate == keptPoints.size(); ++j) {
+				for (int k = -1; k <= 1 && duplicate == keptPoints.size(); ++k) {
+					const auto found
+						= cells.find(getKey({ cell[0] + i, cell[1] + j, cell[2] + k }));
+					if (found == cells.end())
+						continue;
+					for (const std::size_t kept : found->second) {
+						const double tolerance
+							= theTolerance * std::min(point.Size(), keptPoints[kept].Size());
+						if (point.Distance(keptPoints[kept]) <= tolerance) {
+							duplicate = kept;
+							break;
+						}
+					}
+				}
+			}
+		}
 
-	return gp_Pnt(Xt, Yt, 0);
-}
\ No newline at end of file
+		if (duplicate < keptPoints.size()) {
+			keptPoints[duplicate].SetSize(std::min(point.Size(), keptPoints[duplicate].Size()));
+			continue;
+		}
+		cells[getKey(cell)].push_back(keptPoints.size());
+		keptPoints.push_back(point);
+	}
+	thePoints = std::move(keptPoints);
+}
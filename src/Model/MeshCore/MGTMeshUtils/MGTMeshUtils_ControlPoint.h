@@ -26,6 +26,7 @@
 
 #include <gp_Pnt.hxx>
 
+#include <utility>
 #include <vector>
 
 class TopoDS_Face;
@@ -51,6 +52,14 @@ struct ControlPoint : public gp_Pnt {
 
 void createPointsSampleFromFace(
 	const TopoDS_Face& theFace, const double& theSize, std::vector<ControlPoint>& thePoints);
+
+// Samples faces with their sizes in parallel, faces without triangulation are
+// triangulated first. Points shared by adjacent faces are merged.
+void createPointsSampleFromFaces(const std::vector<std::pair<TopoDS_Face, double>>& theFaces,
+	std::vector<ControlPoint>& thePoints);
+
+// Merges points closer than tolerance times their size, keeping the smaller size
+void removeDuplicatePoints(std::vector<ControlPoint>& thePoints, double theTolerance);
 }
 
 #endif
\ No newline at end of file
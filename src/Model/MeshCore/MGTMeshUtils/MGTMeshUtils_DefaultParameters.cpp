@@ -26,6 +26,7 @@
 #include "MGTMeshUtils_DefaultParameters.hpp"
 
 #include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepTools.hxx>
 #include <BRep_Tool.hxx>
 #include <Bnd_B3d.hxx>
 #include <Poly_Triangulation.hxx>
@@ -34,17 +35,33 @@
 
 #include <cmath>
 
+// Relative deflection of the shape triangulation, as Netgen uses for untriangulated faces
+constexpr double ShapeDeflection = 0.01;
+
 //----------------------------------------------------------------------------
 void updateTriangulation(const TopoDS_Shape& shape) {
 
 	try {
-		BRepMesh_IncrementalMesh e(shape, 0.01, true);
+		BRepMesh_IncrementalMesh e(shape, ShapeDeflection, true);
 	} catch (Standard_Failure&) { }
 }
 
 //----------------------------------------------------------------------------
 double MGTMeshUtils_DefaultParameters::GetDefaultMinSize(
 	const TopoDS_Shape& geom, const double maxSize) {
+	return GetDefaultMinSize(GetShapeMinSize(geom), maxSize);
+}
+
+//----------------------------------------------------------------------------
+double MGTMeshUtils_DefaultParameters::GetDefaultMinSize(
+	const double shapeMinSize, const double maxSize) {
+	if (shapeMinSize > 0.5 * maxSize)
+		return maxSize / 3.0;
+	return shapeMinSize;
+}
+
+//----------------------------------------------------------------------------
+double MGTMeshUtils_DefaultParameters::GetShapeMinSize(const TopoDS_Shape& geom) {
 	updateTriangulation(geom);
 
 	TopLoc_Location loc;
@@ -95,8 +112,11 @@ double MGTMeshUtils_DefaultParameters::GetDefaultMinSize(
 		minh = sqrt(minh);
 	}
 
-	if (minh > 0.5 * maxSize)
-		minh = maxSize / 3.0;
-
 	return minh;
-}
\ No newline at end of file
+}
+
+//----------------------------------------------------------------------------
+void MGTMeshUtils_DefaultParameters::TriangulateShape(const TopoDS_Shape& geom) {
+	BRepTools::Clean(geom);
+	updateTriangulation(geom);
+}
@@ -31,6 +31,14 @@ class TopoDS_Shape;
 class MGTMeshUtils_DefaultParameters {
 public:
 	static double GetDefaultMinSize(const TopoDS_Shape& geom, double maxSize);
+	static double GetDefaultMinSize(double shapeMinSize, double maxSize);
+
+	// Smallest edge of shape triangulation, it does not depend on mesh parameters
+	static double GetShapeMinSize(const TopoDS_Shape& geom);
+
+	// Replaces triangulation of the shape by the one at fixed deflection, so that sizes
+	// derived from it do not depend on triangulations left on the shape by others
+	static void TriangulateShape(const TopoDS_Shape& geom);
 };
 
 #endif
@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : NetgenPlugin_LocalHSnapshot.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "NetgenPlugin_LocalHSnapshot.hpp"
+
+#ifndef OCCGEOMETRY
+#define OCCGEOMETRY
+#endif
+#include <meshing.hpp>
+#include <occgeom.hpp>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <ostream>
+
+namespace {
+
+constexpr std::uint32_t SnapshotMagic = 0x53484c4d; // "MLHS"
+constexpr std::uint32_t SnapshotVersion = 1;
+
+// Cells with local size above this fraction of global size are not sampled
+constexpr double GlobalSizeFraction = 0.999;
+
+//----------------------------------------------------------------------------
+void combineHash(std::size_t& seed, const double value) {
+	seed ^= std::hash<double> {}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+//----------------------------------------------------------------------------
+template <typename T>
+void writeValue(std::ostream& stream, const T& value) {
+	stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+//----------------------------------------------------------------------------
+template <typename T>
+bool readValue(std::istream& stream, T& value) {
+	return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+}
+
+//----------------------------------------------------------------------------
+std::size_t NetgenPlugin_LocalHSnapshot::ComputeKey(
+	const netgen::MeshingParameters& parameters, const netgen::OCCGeometry& geometry) {
+	std::size_t key = 0;
+	for (const double value : { parameters.maxh, parameters.minh, parameters.grading,
+			 parameters.curvaturesafety, parameters.segmentsperedge,
+			 static_cast<double>(parameters.uselocalh) })
+		combineHash(key, value);
+
+	const netgen::Box<3>& box = geometry.boundingbox;
+	for (int i = 0; i < 3; ++i) {
+		combineHash(key, box.PMin()(i));
+		combineHash(key, box.PMax()(i));
+	}
+	combineHash(key, geometry.fmap.Extent());
+	return key;
+}
+
+//----------------------------------------------------------------------------
+NetgenPlugin_LocalHSnapshot NetgenPlugin_LocalHSnapshot::Capture(netgen::Mesh& ngMesh,
+	const netgen::MeshingParameters& parameters, const netgen::OCCGeometry& geometry) {
+	NetgenPlugin_LocalHSnapshot snapshot;
+	snapshot._key = ComputeKey(parameters, geometry);
+	snapshot._grading = parameters.grading;
+	if (!ngMesh.LocalHFunctionGenerated())
+		return snapshot;
+
+	const netgen::LocalH& localH = ngMesh.LocalHFunction();
+	const netgen::Box<3>& box = localH.GetBoundingBox();
+	double side = 0.0;
+	for (int i = 0; i < 3; ++i) {
+		snapshot._bounds[2 * i] = box.PMin()(i);
+		snapshot._bounds[2 * i + 1] = box.PMax()(i);
+		side = std::max(side, box.PMax()(i) - box.PMin()(i));
+	}
+
+	// Cells are split like Netgen grading boxes until they are not larger than the
+	// smallest size in them, cells without restricted size are skipped
+	struct Cell {
+		netgen::Point<3> center;
+		double side;
+	};
+	const double maxSize = GlobalSizeFraction * parameters.maxh;
+	std::vector<Cell> stack { { netgen::Center(box.PMin(), box.PMax()), side } };
+	while (!stack.empty()) {
+		const Cell cell = stack.back();
+		stack.pop_back();
+
+		const netgen::Vec<3> halfDiagonal(0.5 * cell.side, 0.5 * cell.side, 0.5 * cell.side);
+		const double minSize
+			= localH.GetMinH(cell.center - halfDiagonal, cell.center + halfDiagonal);
+		if (minSize >= maxSize)
+			continue;
+
+		if (cell.side <= minSize || cell.side <= parameters.minh) {
+			const netgen::Point<3>& c = cell.center;
+			snapshot._samples.push_back({ { c(0), c(1), c(2) }, localH.GetH(c) });
+			continue;
+		}
+
+		for (int i = 0; i < 8; ++i) {
+			const netgen::Vec<3> offset((i & 1 ? 0.25 : -0.25) * cell.side,
+				(i & 2 ? 0.25 : -0.25) * cell.side, (i & 4 ? 0.25 : -0.25) * cell.side);
+			stack.push_back({ cell.center + offset, 0.5 * cell.side });
+		}
+	}
+	spdlog::debug("Local size function captured at {} points", snapshot._samples.size());
+	return snapshot;
+}
+
+//----------------------------------------------------------------------------
+void NetgenPlugin_LocalHSnapshot::Restore(netgen::Mesh& ngMesh) const {
+	ngMesh.SetLocalH(netgen::Point<3>(_bounds[0], _bounds[2], _bounds[4]),
+		netgen::Point<3>(_bounds[1], _bounds[3], _bounds[5]), _grading);
+	for (const Sample& sample : _samples) {
+		const netgen::Point3d point(sample.point[0], sample.point[1], sample.point[2]);
+		ngMesh.RestrictLocalH(point, sample.size);
+	}
+}
+
+//----------------------------------------------------------------------------
+bool NetgenPlugin_LocalHSnapshot::Write(std::ostream& stream) const {
+	writeValue(stream, SnapshotMagic);
+	writeValue(stream, SnapshotVersion);
+	writeValue(stream, static_cast<std::uint64_t>(_key));
+	writeValue(stream, _bounds);
+	writeValue(stream, _grading);
+	writeValue(stream, static_cast<std::uint64_t>(_samples.size()));
+	stream.write(reinterpret_cast<const char*>(_samples.data()),
+		static_cast<std::streamsize>(_samples.size() * sizeof(Sample)));
+	return stream.good();
+}
+
+//----------------------------------------------------------------------------
+bool NetgenPlugin_LocalHSnapshot::Read(std::istream& stream) {
+	std::uint32_t magic = 0;
+	std::uint32_t version = 0;
+	std::uint64_t key = 0;
+	std::uint64_t samplesNb = 0;
+	NetgenPlugin_LocalHSnapshot snapshot;
+	if (!readValue(stream, magic) || magic != SnapshotMagic || !readValue(stream, version)
+		|| version != SnapshotVersion) {
+		SPDLOG_WARN("Stream does not contain local size snapshot");
+		return false;
+	}
+	if (!readValue(stream, key) || !readValue(stream, snapshot._bounds)
+		|| !readValue(stream, snapshot._grading) || !readValue(stream, samplesNb))
+		return false;
+
+	// Samples are read one by one, so corrupted count fails on missing data
+	snapshot._key = static_cast<std::size_t>(key);
+	while (snapshot._samples.size() < samplesNb) {
+		Sample sample {};
+		if (!readValue(stream, sample))
+			return false;
+		snapshot._samples.push_back(sample);
+	}
+	*this = std::move(snapshot);
+	return true;
+}
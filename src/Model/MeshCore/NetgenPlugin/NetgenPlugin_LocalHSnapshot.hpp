@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : NetgenPlugin_LocalHSnapshot.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef NETGENPLUGIN_LOCALHSNAPSHOT_HPP
+#define NETGENPLUGIN_LOCALHSNAPSHOT_HPP
+
+#include "NetgenPlugin_Defs.hpp"
+
+#include <array>
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+
+namespace netgen {
+class Mesh;
+class MeshingParameters;
+class OCCGeometry;
+}
+
+/**
+ * Local mesh size function computed by Netgen geometry analysis, stored as sizes at
+ * centers of cells as large as the local size. Restoring replays the sizes into a new
+ * function instead of copying Netgen internals, so snapshots can be kept with meshes
+ * and written to files. Restored function may be restricted further, e.g. by sizings.
+ */
+class NETGENPLUGIN_EXPORT NetgenPlugin_LocalHSnapshot {
+public:
+	struct Sample {
+		std::array<double, 3> point;
+		double size;
+	};
+
+	NetgenPlugin_LocalHSnapshot() = default;
+
+	// Identifies parameters and geometry bounds that analysis result depends on
+	[[nodiscard]] static std::size_t ComputeKey(
+		const netgen::MeshingParameters& parameters, const netgen::OCCGeometry& geometry);
+
+	// Samples local size function of the mesh where it is below the global size
+	[[nodiscard]] static NetgenPlugin_LocalHSnapshot Capture(netgen::Mesh& ngMesh,
+		const netgen::MeshingParameters& parameters, const netgen::OCCGeometry& geometry);
+
+	// Replaces local size function of the mesh
+	void Restore(netgen::Mesh& ngMesh) const;
+
+	[[nodiscard]] std::size_t GetKey() const { return _key; }
+	[[nodiscard]] const std::vector<Sample>& GetSamples() const { return _samples; }
+
+	// Binary serialization, Read returns false for streams not written by Write
+	bool Write(std::ostream& stream) const;
+	bool Read(std::istream& stream);
+
+private:
+	std::size_t _key {};
+	std::array<double, 6> _bounds {};
+	double _grading {};
+	std::vector<Sample> _samples;
+};
+
+#endif
@@ -23,7 +23,6 @@
 */
 
 #include "NetgenPlugin_MeshInfo.h"
-#include "NetgenPlugin_NetgenLibWrapper.h"
 
 #ifndef OCCGEOMETRY
 #define OCCGEOMETRY
@@ -34,8 +33,7 @@
 //----------------------------------------------------------------------------
 NetgenPlugin_MeshInfo::NetgenPlugin_MeshInfo(
 	netgen::Mesh* ngMesh, bool checkRemovedElems)
-	: _elementsRemoved(false)
-	, _copyOfLocalH(nullptr) {
+	: _elementsRemoved(false) {
 	if (ngMesh) {
 		_nbNodes = ngMesh->GetNP();
 		_nbSegments = ngMesh->GetNSeg();
@@ -51,30 +49,3 @@ NetgenPlugin_MeshInfo::NetgenPlugin_MeshInfo(
 		_nbNodes = _nbSegments = _nbFaces = _nbVolumes = 0;
 	}
 }
-
-//----------------------------------------------------------------------------
-void NetgenPlugin_MeshInfo::transferLocalH(
-	netgen::Mesh* fromMesh, netgen::Mesh* toMesh) {
-	if (!fromMesh->LocalHFunctionGenerated()) {
-		return;
-	}
-
-	if (!toMesh->LocalHFunctionGenerated()) {
-		NetgenPlugin_NetgenLibWrapper::CalcLocalH(toMesh);
-	}
-
-	const size_t size = sizeof(netgen::LocalH);
-	_copyOfLocalH = new char[size];
-	memcpy((void*)_copyOfLocalH, (void*)&toMesh->LocalHFunction(), size);
-	memcpy((void*)&toMesh->LocalHFunction(), (void*)&fromMesh->LocalHFunction(), size);
-}
-
-//----------------------------------------------------------------------------
-void NetgenPlugin_MeshInfo::restoreLocalH(netgen::Mesh* toMesh) {
-	if (_copyOfLocalH) {
-		const size_t size = sizeof(netgen::LocalH);
-		memcpy((void*)&toMesh->LocalHFunction(), (void*)_copyOfLocalH, size);
-		delete[] _copyOfLocalH;
-		_copyOfLocalH = 0;
-	}
-}
\ No newline at end of file
@@ -33,12 +33,9 @@ class Mesh;
 
 struct NetgenPlugin_MeshInfo {
 	explicit NetgenPlugin_MeshInfo(netgen::Mesh* ngMesh = nullptr, bool checkRemovedElems = false);
-	void transferLocalH(netgen::Mesh* fromMesh, netgen::Mesh* toMesh);
-	void restoreLocalH(netgen::Mesh* ngMesh);
 
 	int _nbNodes, _nbSegments, _nbFaces, _nbVolumes;
 	bool _elementsRemoved; // case where netgen can remove free nodes
-	char* _copyOfLocalH;
 };
 
 #endif
\ No newline at end of file
@@ -25,25 +25,21 @@
 
 #include "NetgenPlugin_Mesher.hpp"
 #include "MGTMeshUtils_ComputeError.hpp"
-#include "MGTMeshUtils_ControlPoint.h"
 #include "MGTMeshUtils_DefaultParameters.hpp"
 #include "MGTMesh_Algorithm.hpp"
 #include "MGTMesh_MeshObject.hpp"
+#include "MGTMesh_SizeField.hpp"
+#include "NetgenPlugin_LocalHSnapshot.hpp"
 #include "NetgenPlugin_MeshInfo.h"
 #include "NetgenPlugin_Netgen2VTK.h"
 #include "NetgenPlugin_NetgenLibWrapper.h"
 #include "NetgenPlugin_Parameters.hpp"
+#include "NetgenPlugin_PreparedGeometry.hpp"
 
 #include <BRepBndLib.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
-#include <BRep_Tool.hxx>
-#include <Geom_Curve.hxx>
 #include <Standard_Failure.hxx>
-#include <TopExp_Explorer.hxx>
-#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopoDS.hxx>
-#include <TopoDS_Iterator.hxx>
-#include <gp_Pnt.hxx>
 #include <gp_XYZ.hxx>
 
 #ifndef OCCGEOMETRY
@@ -54,8 +50,10 @@
 
 #include <spdlog/spdlog.h>
 
-#include <map>
-#include <set>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
 #include <vector>
 
 namespace netgen {
@@ -63,81 +61,6 @@ NETGENPLUGIN_DLL_HEADER
 extern MeshingParameters mparam;
 }
 
-TopTools_IndexedMapOfShape ShapesWithLocalSize;
-std::map<int, double> VertexId2LocalSize;
-std::map<int, double> EdgeId2LocalSize;
-std::map<int, double> FaceId2LocalSize;
-std::map<int, double> SolidId2LocalSize;
-
-std::vector<MGTMeshUtils::ControlPoint> ControlPoints;
-std::set<int> ShapesWithControlPoints;
-
-//----------------------------------------------------------------------------
-void setLocalSize(const TopoDS_Shape& GeomShape, double LocalSize) {
-	if (GeomShape.IsNull())
-		return;
-	TopAbs_ShapeEnum GeomType = GeomShape.ShapeType();
-	if (GeomType == TopAbs_COMPOUND) {
-		for (TopoDS_Iterator it(GeomShape); it.More(); it.Next()) {
-			setLocalSize(it.Value(), LocalSize);
-		}
-		return;
-	}
-	int key;
-	if (!ShapesWithLocalSize.Contains(GeomShape))
-		key = ShapesWithLocalSize.Add(GeomShape);
-	else
-		key = ShapesWithLocalSize.FindIndex(GeomShape);
-
-	if (GeomType == TopAbs_VERTEX) {
-		VertexId2LocalSize[key] = LocalSize;
-	} else if (GeomType == TopAbs_EDGE) {
-		EdgeId2LocalSize[key] = LocalSize;
-	} else if (GeomType == TopAbs_FACE) {
-		FaceId2LocalSize[key] = LocalSize;
-	} else if (GeomType == TopAbs_SOLID) {
-		SolidId2LocalSize[key] = LocalSize;
-	}
-	return;
-}
-
-//----------------------------------------------------------------------------
-void setLocalSize(const TopoDS_Edge& edge, double size, netgen::Mesh& mesh,
-	const bool overrideMinH = true) {
-	if (size <= std::numeric_limits<double>::min())
-		return;
-
-	Standard_Real u1, u2;
-	Handle(Geom_Curve) curve = BRep_Tool::Curve(edge, u1, u2);
-
-	if (curve.IsNull()) {
-		TopoDS_Iterator vIt(edge);
-		if (!vIt.More())
-			return;
-		gp_Pnt p = BRep_Tool::Pnt(TopoDS::Vertex(vIt.Value()));
-		NetgenPlugin_Mesher::RestrictLocalSize(
-			mesh, p.XYZ(), size, overrideMinH);
-
-	} else {
-		const int nb = (int)(1.5 * MGTMesh_Algorithm::EdgeLength(edge) / size);
-		Standard_Real delta = (u2 - u1) / nb;
-
-		for (int i = 0; i < nb; i++) {
-			Standard_Real u = u1 + delta * i;
-			gp_Pnt p = curve->Value(u);
-			NetgenPlugin_Mesher::RestrictLocalSize(
-				mesh, p.XYZ(), size, overrideMinH);
-			netgen::Point3d pi(p.X(), p.Y(), p.Z());
-			double resultSize = mesh.GetH(pi);
-
-			if (resultSize - size > 0.1 * size)
-				// netgen does restriction iff oldH/newH > 1.2 (localh.cpp:136)
-				NetgenPlugin_Mesher::RestrictLocalSize(
-					mesh, p.XYZ(), resultSize / 1.201, overrideMinH);
-		}
-	}
-}
-
 //----------------------------------------------------------------------------
 NetgenPlugin_Mesher::NetgenPlugin_Mesher(MGTMesh_MeshObject* mesh,
 	const TopoDS_Shape& shape, const NetgenPlugin_Parameters* algorithm)
@@ -149,18 +72,13 @@ NetgenPlugin_Mesher::NetgenPlugin_Mesher(MGTMesh_MeshObject* mesh,
 	, _isViscousLayers2D(false)
 	, _ngMesh(nullptr)
 	, _occgeom(nullptr)
+	, _preparedGeometry(nullptr)
+	, _localHSnapshots(nullptr)
 	, _selfPtr(nullptr) {
 
 	SPDLOG_INFO("Initializing NetgenPlugin_Mesher object");
 
 	this->SetMeshParameters();
-	ShapesWithLocalSize.Clear();
-	VertexId2LocalSize.clear();
-	EdgeId2LocalSize.clear();
-	FaceId2LocalSize.clear();
-	SolidId2LocalSize.clear();
-	ControlPoints.clear();
-	ShapesWithControlPoints.clear();
 }
 
 //----------------------------------------------------------------------------
@@ -188,17 +106,34 @@ void NetgenPlugin_Mesher::SetMeshParameters() {
 
 	mParams.quad = _algorithm->quadAllowed;
 
+	mParams.optsteps2d = _algorithm->nbSurfOptSteps;
+	mParams.optsteps3d = _algorithm->nbVolOptSteps;
+	mParams.elsizeweight = _algorithm->elemSizeWeight;
+	mParams.opterrpow = _algorithm->worstElemMeasure;
+
 	_fineness = -_algorithm->fineness;
 	mParams.uselocalh = _algorithm->surfaceCurvature;
 }
 
+//----------------------------------------------------------------------------
+void NetgenPlugin_Mesher::SetPreparedGeometry(
+	NetgenPlugin_PreparedGeometry* geometry) {
+	_preparedGeometry = geometry;
+}
+
+//----------------------------------------------------------------------------
+void NetgenPlugin_Mesher::SetLocalHSnapshots(
+	std::vector<NetgenPlugin_LocalHSnapshot>* snapshots) {
+	_localHSnapshots = snapshots;
+}
+
 //----------------------------------------------------------------------------
 void NetgenPlugin_Mesher::PrepareOCCgeometry(
 	netgen::OCCGeometry& occgeom, const TopoDS_Shape& shape) {
 	occgeom.shape = shape;
 	occgeom.changed = 1;
 	occgeom.BuildFMap();
-	occgeom.BuildVisualizationMesh(0.01);
+	// Faces are triangulated by NetgenPlugin_PreparedGeometry, visualization mesh is not needed
 	occgeom.CalcBoundingBox();
 	// occgeom.PrintNrShapes();
 }
@@ -208,10 +143,15 @@ int NetgenPlugin_Mesher::ComputeMesh() {
 	NetgenPlugin_NetgenLibWrapper ngLib;
 	netgen::MeshingParameters& mParams = netgen::mparam;
 
-	netgen::OCCGeometry occgeo;
-	SPDLOG_INFO("Preparing geometry...");
+	std::optional<NetgenPlugin_PreparedGeometry> ownGeometry;
+	if (!_preparedGeometry) {
+		SPDLOG_INFO("Preparing geometry...");
+		ownGeometry.emplace(_shape);
+	}
+	NetgenPlugin_PreparedGeometry& geometry
+		= _preparedGeometry ? *_preparedGeometry : *ownGeometry;
 	std::cout << "ALG MAX SIZE: " << _algorithm->maxSize << std::endl;
-	NetgenPlugin_Mesher::PrepareOCCgeometry(occgeo, _shape);
+	netgen::OCCGeometry& occgeo = geometry.GetOCCGeometry();
 	_occgeom = &occgeo;
 
 	_ngMesh = nullptr;
@@ -224,11 +164,12 @@ int NetgenPlugin_Mesher::ComputeMesh() {
 	if (mParams.minh == 0.0
 		&& _fineness != NetgenPlugin_Parameters::UserDefined)
 		mParams.minh = MGTMeshUtils_DefaultParameters::GetDefaultMinSize(
-			_shape, mParams.maxh);
+			geometry.GetShapeMinSize(), mParams.maxh);
 
 	SPDLOG_INFO("Mesh input parameters:");
 	std::cout << mParams << std::endl;
 
+	// Resets also face sizes left in shared geometry by previous meshers
 	occgeo.face_maxh = mParams.maxh;
 
 	int startWith = netgen::MESHCONST_ANALYSE;
@@ -236,13 +177,32 @@ int NetgenPlugin_Mesher::ComputeMesh() {
 
 	SPDLOG_INFO("Starting mesh generation process");
 
-	try {
-		err = NetgenPlugin_NetgenLibWrapper::GenerateMesh(
-			occgeo, startWith, endWith, _ngMesh);
-	} catch (Standard_Failure& ex) {
-		SPDLOG_ERROR("OpenCASCADE Exception: {}", ex.GetMessageString());
-	} catch (netgen::NgException& ex) {
-		SPDLOG_ERROR("Netgen Exception: {}", ex.What());
+	// Analysis is skipped if its result for the same parameters was kept
+	const std::size_t localHKey = NetgenPlugin_LocalHSnapshot::ComputeKey(mParams, occgeo);
+	const NetgenPlugin_LocalHSnapshot* localHSnapshot = nullptr;
+	if (_localHSnapshots) {
+		const auto found = std::ranges::find(
+			*_localHSnapshots, localHKey, &NetgenPlugin_LocalHSnapshot::GetKey);
+		if (found != _localHSnapshots->end())
+			localHSnapshot = &*found;
+	}
+
+	if (localHSnapshot) {
+		SPDLOG_INFO("Restoring local mesh size of previous mesh");
+		_ngMesh = new netgen::Mesh;
+		_ngMesh->geomtype = netgen::Mesh::GEOM_OCC;
+		_ngMesh->SetGlobalH(mParams.maxh);
+		_ngMesh->SetMinimalH(mParams.minh);
+		localHSnapshot->Restore(*_ngMesh);
+	} else {
+		try {
+			err = NetgenPlugin_NetgenLibWrapper::GenerateMesh(
+				occgeo, startWith, endWith, _ngMesh);
+		} catch (Standard_Failure& ex) {
+			SPDLOG_ERROR("OpenCASCADE Exception: {}", ex.GetMessageString());
+		} catch (netgen::NgException& ex) {
+			SPDLOG_ERROR("Netgen Exception: {}", ex.What());
+		}
 	}
 
 	if (!_ngMesh)
@@ -252,13 +212,16 @@ int NetgenPlugin_Mesher::ComputeMesh() {
 	if (err)
 		return err;
 
+	// Snapshot is taken before sizings, they are restricted again on restored function
+	if (!localHSnapshot && _localHSnapshots)
+		_localHSnapshots->push_back(
+			NetgenPlugin_LocalHSnapshot::Capture(*_ngMesh, mParams, occgeo));
+
 	// if (!mParams.uselocalh)
 	// 	_ngMesh->LocalHFunction().SetGrading(mParams.grading);
 
-	// const TopoDS_Shape& shape = occgeo.fmap.FindKey(1);
-	// setLocalSize(shape, 2);
-
-	SetLocalSize(occgeo, *_ngMesh);
+	if (_algorithm->sizeField && !_algorithm->sizeField->IsEmpty())
+		SetLocalSize(*_algorithm->sizeField, occgeo, *_ngMesh);
 
 	// Compute 1D mesh
 	startWith = endWith = netgen::MESHCONST_MESHEDGES;
@@ -292,8 +255,7 @@ int NetgenPlugin_Mesher::ComputeMesh() {
 	if (err)
 		return err;
 
-	const NetgenPlugin_Netgen2VTK netgen2vtk(*_ngMesh);
-	netgen2vtk.ConvertToBoundaryMesh(_mesh);
+	const NetgenPlugin_Netgen2VTK netgen2vtk(*_ngMesh, _algorithm->renumber);
 
 	if (_algorithm->Is3DAlgortihm()) {
 		startWith = netgen::MESHCONST_MESHVOLUME;
@@ -309,13 +271,14 @@ int NetgenPlugin_Mesher::ComputeMesh() {
 			SPDLOG_ERROR("Netgen Exception: {}", ex.What());
 		}
 	} else {
+		netgen2vtk.ConvertToMeshData(_mesh);
 		return MGTMeshUtils_ComputeErrorName::COMPERR_OK;
 	}
 
 	if (err)
 		return err;
 
-	netgen2vtk.ConvertToInternalMesh(_mesh);
+	netgen2vtk.ConvertToMeshData(_mesh);
 
 	return MGTMeshUtils_ComputeErrorName::COMPERR_OK;
 }
@@ -339,57 +302,72 @@ void NetgenPlugin_Mesher::RestrictLocalSize(netgen::Mesh& ngMesh,
 }
 
 //----------------------------------------------------------------------------
-void NetgenPlugin_Mesher::SetLocalSize(
+void NetgenPlugin_Mesher::SetLocalSize(const MGTMesh_SizeField& sizeField,
 	netgen::OCCGeometry& occgeo, netgen::Mesh& ngMesh) {
-	// edges
-	std::map<int, double>::const_iterator it;
-	for (it = EdgeId2LocalSize.begin(); it != EdgeId2LocalSize.end(); it++) {
-		int key = (*it).first;
-		double hi = (*it).second;
-		const TopoDS_Shape& shape = ShapesWithLocalSize.FindKey(key);
-		setLocalSize(TopoDS::Edge(shape), hi, ngMesh);
+	for (const auto& [face, size] : sizeField.GetFaceSizes()) {
+		const int faceNgID = occgeo.fmap.FindIndex(face);
+		if (faceNgID >= 1)
+			occgeo.SetFaceMaxH(faceNgID, size, netgen::mparam);
 	}
 
-	// vertices
-	for (it = VertexId2LocalSize.begin(); it != VertexId2LocalSize.end();
-		it++) {
-		int key = (*it).first;
-		double hi = (*it).second;
-		const TopoDS_Shape& shape = ShapesWithLocalSize.FindKey(key);
-		gp_Pnt p = BRep_Tool::Pnt(TopoDS::Vertex(shape));
-		NetgenPlugin_Mesher::RestrictLocalSize(ngMesh, p.XYZ(), hi);
+	// Minimal size is lowered once for all sources
+	const double minSize = sizeField.GetMinSize();
+	if (netgen::mparam.minh > minSize) {
+		ngMesh.SetMinimalH(minSize);
+		netgen::mparam.minh = minSize;
 	}
 
-	// faces
-	for (it = FaceId2LocalSize.begin(); it != FaceId2LocalSize.end(); it++) {
-		int key = (*it).first;
-		double val = (*it).second;
-		const TopoDS_Shape& shape = ShapesWithLocalSize.FindKey(key);
-		int faceNgID = occgeo.fmap.FindIndex(shape);
-
-		if (faceNgID >= 1) {
-			occgeo.SetFaceMaxH(faceNgID, val, netgen::mparam);
-			for (TopExp_Explorer edgeExp(shape, TopAbs_EDGE); edgeExp.More();
-				edgeExp.Next()) {
-				setLocalSize(TopoDS::Edge(edgeExp.Current()), val, ngMesh);
+	if (!ngMesh.LocalHFunctionGenerated())
+		return;
+
+	// Box of the local size function is split level by level into cells, the field is
+	// evaluated at centres of all cells of a level in one batch. Cells are split while
+	// the field may be smaller than both the cell and the local size somewhere in it,
+	// local size is restricted only where the field is below it.
+	const netgen::LocalH& localH = ngMesh.LocalHFunction();
+	const netgen::Box<3>& box = localH.GetBoundingBox();
+	double side = 0.0;
+	for (int k = 0; k < 3; ++k)
+		side = std::max(side, box.PMax()(k) - box.PMin()(k));
+	const netgen::Point<3> center = netgen::Center(box.PMin(), box.PMax());
+
+	const double growthRate = sizeField.GetGrowthRate();
+	std::vector<double> centers { center(0), center(1), center(2) };
+	std::vector<double> sizes;
+	std::size_t evaluatedNb = 0;
+	std::size_t restrictedNb = 0;
+	while (!centers.empty()) {
+		sizes.resize(centers.size() / 3);
+		sizeField.Evaluate(centers, sizes);
+		evaluatedNb += sizes.size();
+
+		std::vector<double> splitCenters;
+		const double halfDiagonal = 0.5 * std::sqrt(3.0) * side;
+		for (std::size_t i = 0; i < sizes.size(); ++i) {
+			const netgen::Point3d point(centers[3 * i], centers[3 * i + 1], centers[3 * i + 2]);
+			if (sizes[i] < ngMesh.GetH(point)) {
+				ngMesh.RestrictLocalH(point, sizes[i]);
+				++restrictedNb;
 			}
-		} else if (!ShapesWithControlPoints.count(key)) {
-			std::cout << "Creating control points for face " << key
-					  << std::endl;
-			MGTMeshUtils::createPointsSampleFromFace(
-				TopoDS::Face(shape), val, ControlPoints);
-			ShapesWithControlPoints.insert(key);
-		}
-	}
-	// ToDo: support for solids
 
-	if (!ControlPoints.empty()) {
-		std::cout << "Restricting local size for control point " << std::endl;
-		for (size_t i = 0; i < ControlPoints.size(); ++i)
-			NetgenPlugin_Mesher::RestrictLocalSize(
-				ngMesh, ControlPoints[i].XYZ(), ControlPoints[i].Size());
+			const double cellMinSize = std::max(sizes[i] - growthRate * halfDiagonal, minSize);
+			if (side <= cellMinSize)
+				continue;
+			const netgen::Vec<3> halfSide(0.5 * side, 0.5 * side, 0.5 * side);
+			const netgen::Point<3> cellCenter(point.X(), point.Y(), point.Z());
+			if (cellMinSize >= localH.GetMinH(cellCenter - halfSide, cellCenter + halfSide))
+				continue;
+			for (int j = 0; j < 8; ++j) {
+				splitCenters.push_back(centers[3 * i] + (j & 1 ? 0.25 : -0.25) * side);
+				splitCenters.push_back(centers[3 * i + 1] + (j & 2 ? 0.25 : -0.25) * side);
+				splitCenters.push_back(centers[3 * i + 2] + (j & 4 ? 0.25 : -0.25) * side);
+			}
+		}
+		centers = std::move(splitCenters);
+		side *= 0.5;
 	}
-	return;
+	spdlog::debug("Local size restricted at {} of {} evaluated points", restrictedNb,
+		evaluatedNb);
 }
 
 //----------------------------------------------------------------------------
@@ -27,6 +27,8 @@
 
 #include "NetgenPlugin_Defs.hpp"
 
+#include <vector>
+
 namespace netgen {
 class OCCGeometry;
 class Mesh;
@@ -35,9 +37,12 @@ class Mesh;
 class gp_XYZ;
 class TopoDS_Shape;
 class MGTMesh_MeshObject;
+class MGTMesh_SizeField;
 class NetgenPlugin_Netgen2VTK;
 class MGTMeshUtils_ViscousLayers;
 class NetgenPlugin_Parameters;
+class NetgenPlugin_PreparedGeometry;
+class NetgenPlugin_LocalHSnapshot;
 
 class NETGENPLUGIN_EXPORT NetgenPlugin_Mesher {
 public:
@@ -51,9 +56,17 @@ public:
 
 	static void RestrictLocalSize(netgen::Mesh& ngMesh, const gp_XYZ& p,
 		double size, const bool overrideMinH = true);
-	static void SetLocalSize(netgen::OCCGeometry& occgeo, netgen::Mesh& ngMesh);
+	static void SetLocalSize(const MGTMesh_SizeField& sizeField,
+		netgen::OCCGeometry& occgeo, netgen::Mesh& ngMesh);
 
 	void SetMeshParameters();
+
+	// Geometry shared with other meshers of the same shape, it must outlive the mesher.
+	// Without it the geometry is prepared by ComputeMesh.
+	void SetPreparedGeometry(NetgenPlugin_PreparedGeometry* geometry);
+	// Local size functions of previous meshes of the shape. The one computed for the
+	// same parameters replaces geometry analysis, otherwise a new one is added.
+	void SetLocalHSnapshots(std::vector<NetgenPlugin_LocalHSnapshot>* snapshots);
 	void SetParameters(const MGTMeshUtils_ViscousLayers* layersScheme);
 
 private:
@@ -67,6 +80,8 @@ private:
 
 	netgen::Mesh* _ngMesh;
 	netgen::OCCGeometry* _occgeom;
+	NetgenPlugin_PreparedGeometry* _preparedGeometry;
+	std::vector<NetgenPlugin_LocalHSnapshot>* _localHSnapshots;
 
 	const MGTMeshUtils_ViscousLayers* _viscousLayers;
 
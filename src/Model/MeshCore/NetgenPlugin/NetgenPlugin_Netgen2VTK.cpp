@@ -23,149 +23,164 @@
 * Date      : 23/11/2024
 */
 #include "NetgenPlugin_Netgen2VTK.h"
+#include "MGTMesh_MeshData.hpp"
 #include "MGTMesh_MeshObject.hpp"
+#include "MGTMesh_Renumbering.hpp"
 
-#include <vtkCellArray.h>
-#include <vtkHexahedron.h>
-#include <vtkLogger.h>
-#include <vtkPoints.h>
-#include <vtkQuad.h>
-#include <vtkTetra.h>
-#include <vtkTriangle.h>
-#include <vtkUnsignedCharArray.h>
+#include <vtkCellType.h>
+#include <vtkNew.h>
+#include <vtkSMPTools.h>
 
 #include <meshing.hpp>
 
 #include "spdlog/spdlog.h"
 
-//----------------------------------------------------------------------------
-NetgenPlugin_Netgen2VTK::NetgenPlugin_Netgen2VTK(const netgen::Mesh& netgenMesh)
-	: _netgenMesh(netgenMesh) { }
+#include <map>
+#include <vector>
+
+namespace {
+
+// Higher order elements are converted to linear ones, corner nodes come first
+int GetVolumeCellType(const netgen::ELEMENT_TYPE type) {
+	switch (type) {
+	case netgen::TET:
+	case netgen::TET10:
+		return VTK_TETRA;
+	case netgen::PYRAMID:
+		return VTK_PYRAMID;
+	case netgen::PRISM:
+	case netgen::PRISM12:
+		return VTK_WEDGE;
+	case netgen::HEX:
+		return VTK_HEXAHEDRON;
+	default:
+		return 0;
+	}
+}
 
-//----------------------------------------------------------------------------
-vtkSmartPointer<vtkPoints> NetgenPlugin_Netgen2VTK::PopulateMeshNodes() const {
-	vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
-	const int nbN = static_cast<int>(_netgenMesh.GetNP());
-	if (!nbN) {
-		return points;
+int GetSurfaceCellType(const netgen::ELEMENT_TYPE type) {
+	switch (type) {
+	case netgen::TRIG:
+	case netgen::TRIG6:
+		return VTK_TRIANGLE;
+	case netgen::QUAD:
+	case netgen::QUAD6:
+	case netgen::QUAD8:
+		return VTK_QUAD;
+	default:
+		return 0;
 	}
+}
 
-	// Insert all node points
-	for (int i = 1; i <= nbN; ++i) {
-		const netgen::MeshPoint& mp = _netgenMesh.Point(i);
-		const double coords[3] = { mp(0), mp(1), mp(2) };
-		points->InsertNextPoint(coords[0], coords[1], coords[2]);
+// Indices of elements grouped by VTK cell type, so that each type forms single block
+template <typename GetCellType>
+std::map<int, std::vector<int>> GroupElements(const int elementsNb, GetCellType getCellType) {
+	std::map<int, std::vector<int>> groups;
+	for (int i = 1; i <= elementsNb; ++i) {
+		const int cellType = getCellType(i);
+		if (cellType == 0) {
+			SPDLOG_ERROR("Unsupported element type encountered in element: {}", i);
+			continue;
+		}
+		groups[cellType].push_back(i);
 	}
-	return points;
+	return groups;
+}
+
 }
 
 //----------------------------------------------------------------------------
-void NetgenPlugin_Netgen2VTK::ConvertToInternalMesh(
-	MGTMesh_MeshObject* mesh) const {
-	const int nbE = static_cast<int>(_netgenMesh.GetNE());
-	if (!nbE) {
-		SPDLOG_WARN("No volume elements found in the Netgen mesh.");
+NetgenPlugin_Netgen2VTK::NetgenPlugin_Netgen2VTK(
+	const netgen::Mesh& netgenMesh, const bool renumber)
+	: _netgenMesh(netgenMesh)
+	, _renumber(renumber) { }
+
+//----------------------------------------------------------------------------
+void NetgenPlugin_Netgen2VTK::PopulateMeshNodes(MGTMesh_MeshData* meshData) const {
+	const auto nbN = static_cast<vtkIdType>(_netgenMesh.GetNP());
+	const std::span<double> coords = meshData->AllocateNodes(nbN);
+	if (coords.empty())
 		return;
-	}
 
-	const vtkSmartPointer<vtkUnstructuredGrid> internalMesh
-		= vtkUnstructuredGrid::New();
-
-	const vtkSmartPointer<vtkPoints> points = this->PopulateMeshNodes();
-	const vtkSmartPointer<vtkCellArray> cells
-		= vtkSmartPointer<vtkCellArray>::New();
-	const vtkSmartPointer<vtkUnsignedCharArray> cellTypes
-		= vtkSmartPointer<vtkUnsignedCharArray>::New();
-
-	for (int i = 1; i <= nbE; ++i) {
-		const netgen::Element& elem = _netgenMesh.VolumeElement(i);
-		const int elementType = elem.GetType();
-		const auto vertices = elem.PNums();
-
-		if (elementType == netgen::TET) { //! Tetrahedral element
-			auto tetra = vtkSmartPointer<vtkTetra>::New();
-			tetra->GetPointIds()->SetId(0, vertices[0] - 1);
-			tetra->GetPointIds()->SetId(1, vertices[1] - 1);
-			tetra->GetPointIds()->SetId(2, vertices[2] - 1);
-			tetra->GetPointIds()->SetId(3, vertices[3] - 1);
-			cells->InsertNextCell(tetra);
-			cellTypes->InsertNextValue(VTK_TETRA);
-
-		} else if (elementType == netgen::HEX) { //! Hexahedral element
-			auto hex = vtkSmartPointer<vtkHexahedron>::New();
-			for (int j = 0; j < 8; ++j) {
-				hex->GetPointIds()->SetId(j, vertices[j] - 1);
-			}
-			cells->InsertNextCell(hex);
-			cellTypes->InsertNextValue(VTK_HEXAHEDRON);
-
-		} else {
-			std::cerr << "Unsupported element type encountered: " << elementType
-					  << std::endl;
+	// Note: Netgen indices are 1-based, VTK is 0-based
+	vtkSMPTools::For(0, nbN, [&](vtkIdType begin, vtkIdType end) {
+		for (vtkIdType i = begin; i < end; ++i) {
+			const netgen::MeshPoint& mp = _netgenMesh.Point(static_cast<int>(i + 1));
+			coords[3 * i] = mp(0);
+			coords[3 * i + 1] = mp(1);
+			coords[3 * i + 2] = mp(2);
 		}
-	}
-
-	// Populate internal mesh data
-	internalMesh->SetPoints(points);
-	internalMesh->SetCells(cellTypes, cells);
-	SPDLOG_INFO(
-		"Internal mesh conversion completed: {} points, {} cells created.",
-		points->GetNumberOfPoints(), cells->GetNumberOfCells());
-
-	mesh->SetInternalMesh(internalMesh);
+	});
 }
 
 //----------------------------------------------------------------------------
-void NetgenPlugin_Netgen2VTK::ConvertToBoundaryMesh(
-	MGTMesh_MeshObject* mesh) const {
+void NetgenPlugin_Netgen2VTK::PopulateSurfaceElements(MGTMesh_MeshData* meshData) const {
 	const int nbSE = static_cast<int>(_netgenMesh.GetNSE());
-
-	if (!nbSE) {
-		SPDLOG_WARN("No surface elements found in the Netgen mesh.");
-		return;
+	const auto groups = GroupElements(nbSE, [this](int i) {
+		return GetSurfaceCellType(_netgenMesh.SurfaceElement(i).GetType());
+	});
+
+	for (const auto& [cellType, elements] : groups) {
+		const auto block = meshData->AppendBlock(
+			MGTMesh_MeshData::Dimension::Surface, cellType, static_cast<vtkIdType>(elements.size()));
+		const int nodesNb = MGTMesh_MeshData::GetNodesNb(cellType);
+
+		vtkSMPTools::For(0, static_cast<vtkIdType>(elements.size()),
+			[&](vtkIdType begin, vtkIdType end) {
+				for (vtkIdType i = begin; i < end; ++i) {
+					const netgen::Element2d& elem = _netgenMesh.SurfaceElement(elements[i]);
+					for (int j = 0; j < nodesNb; ++j)
+						block.connectivity[i * nodesNb + j] = elem[j] - 1;
+
+					// Surface number is 0-based index of the geometric face
+					block.tags[i] = _netgenMesh.GetFaceDescriptor(elem.GetIndex()).SurfNr() + 1;
+				}
+			});
 	}
+}
 
-	const vtkSmartPointer<vtkPolyData> boundaryMesh = vtkPolyData::New();
-	const vtkSmartPointer<vtkPoints> points = this->PopulateMeshNodes();
-	const vtkSmartPointer<vtkCellArray> polygons
-		= vtkSmartPointer<vtkCellArray>::New();
-
-	for (int i = 1; i <= nbSE; ++i) {
-		const netgen::Element2d& elem = _netgenMesh.SurfaceElement(i);
-		const int elementType = elem.GetType();
-
-		const auto vertices = elem.PNums();
-
-		// FIXME: Add support for higher-order elements
-		// Note: Netgen indices are 1-based, VTK is 0-based
-		if (elementType == netgen::TRIG) { //! Triangle element
-			auto triangle = vtkSmartPointer<vtkTriangle>::New();
-			triangle->GetPointIds()->SetId(0, vertices[0] - 1);
-			triangle->GetPointIds()->SetId(1, vertices[1] - 1);
-			triangle->GetPointIds()->SetId(2, vertices[2] - 1);
-			polygons->InsertNextCell(triangle);
-
-		} else if (elementType == netgen::QUAD) { //! Quad element
-			auto quad = vtkSmartPointer<vtkQuad>::New();
-			quad->GetPointIds()->SetId(0, vertices[0] - 1);
-			quad->GetPointIds()->SetId(1, vertices[1] - 1);
-			quad->GetPointIds()->SetId(2, vertices[2] - 1);
-			quad->GetPointIds()->SetId(3, vertices[3] - 1);
-			polygons->InsertNextCell(quad);
-
-		} else {
-			SPDLOG_ERROR(
-				"Unsupported element type encountered: {}", elementType);
-			continue;
-		}
+//----------------------------------------------------------------------------
+void NetgenPlugin_Netgen2VTK::PopulateVolumeElements(MGTMesh_MeshData* meshData) const {
+	const int nbE = static_cast<int>(_netgenMesh.GetNE());
+	const auto groups = GroupElements(nbE, [this](int i) {
+		return GetVolumeCellType(_netgenMesh.VolumeElement(i).GetType());
+	});
+
+	for (const auto& [cellType, elements] : groups) {
+		const auto block = meshData->AppendBlock(
+			MGTMesh_MeshData::Dimension::Volume, cellType, static_cast<vtkIdType>(elements.size()));
+		const int nodesNb = MGTMesh_MeshData::GetNodesNb(cellType);
+
+		vtkSMPTools::For(0, static_cast<vtkIdType>(elements.size()),
+			[&](vtkIdType begin, vtkIdType end) {
+				for (vtkIdType i = begin; i < end; ++i) {
+					const netgen::Element& elem = _netgenMesh.VolumeElement(elements[i]);
+					for (int j = 0; j < nodesNb; ++j)
+						block.connectivity[i * nodesNb + j] = elem[j] - 1;
+					block.tags[i] = elem.GetIndex();
+				}
+			});
 	}
+}
+
+//----------------------------------------------------------------------------
+void NetgenPlugin_Netgen2VTK::ConvertToMeshData(MGTMesh_MeshObject* mesh) const {
+	vtkNew<MGTMesh_MeshData> meshData;
+	this->PopulateMeshNodes(meshData);
+	this->PopulateSurfaceElements(meshData);
+	this->PopulateVolumeElements(meshData);
+
+	if (meshData->GetNumberOfElements(MGTMesh_MeshData::Dimension::Surface) == 0)
+		SPDLOG_WARN("No surface elements found in the Netgen mesh.");
 
-	// Populate poly data
-	boundaryMesh->SetPoints(points);
-	boundaryMesh->SetPolys(polygons);
-	SPDLOG_INFO(
-		"Boundary mesh conversion completed: {} points, {} polygons created.",
-		points->GetNumberOfPoints(), polygons->GetNumberOfCells());
+	if (_renumber)
+		MGTMesh_Renumbering::Renumber(meshData);
 
-	mesh->SetBoundaryMesh(boundaryMesh);
+	mesh->SetMeshData(meshData);
+	SPDLOG_INFO("Mesh conversion completed: {} points, {} volume and {} surface elements, "
+				"{} bytes of mesh data.",
+		meshData->GetNumberOfNodes(),
+		meshData->GetNumberOfElements(MGTMesh_MeshData::Dimension::Volume),
+		meshData->GetNumberOfElements(MGTMesh_MeshData::Dimension::Surface),
+		meshData->GetMemorySize());
 }
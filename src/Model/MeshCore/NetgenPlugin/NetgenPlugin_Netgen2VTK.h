@@ -26,11 +26,7 @@
 
 #include "NetgenPlugin_Defs.hpp"
 
-#include <vtkSmartPointer.h>
-#include <vtkUnstructuredGrid.h>
-
-#include <memory>
-
+class MGTMesh_MeshData;
 class MGTMesh_MeshObject;
 
 namespace netgen {
@@ -39,17 +35,23 @@ class Mesh;
 
 class NETGENPLUGIN_EXPORT NetgenPlugin_Netgen2VTK {
 public:
-	explicit NetgenPlugin_Netgen2VTK(const netgen::Mesh& netgenMesh);
+	explicit NetgenPlugin_Netgen2VTK(const netgen::Mesh& netgenMesh, bool renumber = false);
 
 public:
-	void ConvertToInternalMesh(MGTMesh_MeshObject* mesh) const;
-	void ConvertToBoundaryMesh(MGTMesh_MeshObject* mesh) const;
+	// Converts nodes, surface elements and volume elements (if any) to native mesh
+	// data, blocks of the mesh object become views of it. Surface elements are tagged
+	// with geometric face IDs and volume elements with solid IDs. Nodes and elements
+	// are renumbered for cache locality if requested.
+	void ConvertToMeshData(MGTMesh_MeshObject* mesh) const;
 
 private:
-	vtkSmartPointer<vtkPoints> PopulateMeshNodes() const;
+	void PopulateMeshNodes(MGTMesh_MeshData* meshData) const;
+	void PopulateSurfaceElements(MGTMesh_MeshData* meshData) const;
+	void PopulateVolumeElements(MGTMesh_MeshData* meshData) const;
 
 private:
 	const netgen::Mesh& _netgenMesh;
+	bool _renumber;
 };
 
 #endif
\ No newline at end of file
@@ -36,11 +36,15 @@ NetgenPlugin_Parameters::NetgenPlugin_Parameters(const int schemeId)
 	growthRate = GetDefaultGrowthRate();
 	nbSegPerRadius = GetDefaultNbSegPerRadius();
 	nbSegPerEdge = GetDefaultNbSegPerEdge();
+	nbSegPerGap = GetDefaultNbSegPerGap();
 	optimize = GetDefaultOptimize();
 	nbSurfOptSteps = GetDefaultNbSurfOptSteps();
 	nbVolOptSteps = GetDefaultNbVolOptSteps();
 	elemSizeWeight = GetDefaultElemSizeWeight();
 	worstElemMeasure = GetDefaultWorstElemMeasure();
+	renumber = GetDefaultRenumber();
+	sharedTopology = GetDefaultSharedTopology();
+	sweep = GetDefaultSweep();
 	surfaceCurvature = GetDefaultSurfaceCurvature();
 	useDelauney = GetDefaultUseDelauney();
 	checkOverlapping = GetDefaultCheckOverlapping();
@@ -61,11 +65,16 @@ NetgenPlugin_Parameters::NetgenPlugin_Parameters(
 	growthRate = algorithm.growthRate;
 	nbSegPerRadius = algorithm.nbSegPerRadius;
 	nbSegPerEdge = algorithm.nbSegPerEdge;
+	nbSegPerGap = algorithm.nbSegPerGap;
+	sizeField = algorithm.sizeField;
 	optimize = algorithm.optimize;
 	nbSurfOptSteps = algorithm.nbSurfOptSteps;
 	nbVolOptSteps = algorithm.nbVolOptSteps;
 	elemSizeWeight = algorithm.elemSizeWeight;
 	worstElemMeasure = algorithm.worstElemMeasure;
+	renumber = algorithm.renumber;
+	sharedTopology = algorithm.sharedTopology;
+	sweep = algorithm.sweep;
 	surfaceCurvature = algorithm.surfaceCurvature;
 	useDelauney = algorithm.useDelauney;
 	checkOverlapping = algorithm.checkOverlapping;
@@ -44,11 +44,15 @@ public:
 	static double GetDefaultGrowthRate() { return 0.3; }
 	static double GetDefaultNbSegPerRadius() { return 2; }
 	static double GetDefaultNbSegPerEdge() { return 1; }
+	static double GetDefaultNbSegPerGap() { return 0; }
 	static bool GetDefaultOptimize() { return true; }
 	static int GetDefaultNbSurfOptSteps() { return 3; }
 	static int GetDefaultNbVolOptSteps() { return 3; }
 	static double GetDefaultElemSizeWeight() { return 0.2; }
 	static int GetDefaultWorstElemMeasure() { return 2; }
+	static bool GetDefaultRenumber() { return false; }
+	static bool GetDefaultSharedTopology() { return false; }
+	static bool GetDefaultSweep() { return false; }
 	static bool GetDefaultSurfaceCurvature() { return true; }
 	static bool GetDefaultUseDelauney() { return true; }
 	static bool GetDefaultCheckOverlapping() { return true; }
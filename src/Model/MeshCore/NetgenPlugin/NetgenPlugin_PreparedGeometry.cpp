@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : NetgenPlugin_PreparedGeometry.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "NetgenPlugin_PreparedGeometry.hpp"
+#include "MGTMeshUtils_DefaultParameters.hpp"
+#include "NetgenPlugin_Mesher.hpp"
+#include "NetgenPlugin_SurfaceProjector.hpp"
+
+#ifndef OCCGEOMETRY
+#define OCCGEOMETRY
+#endif
+#include <meshing.hpp>
+#include <occgeom.hpp>
+
+//----------------------------------------------------------------------------
+NetgenPlugin_PreparedGeometry::NetgenPlugin_PreparedGeometry(const TopoDS_Shape& shape)
+	: _shape(shape)
+	, _occgeo(std::make_unique<netgen::OCCGeometry>()) {
+	// Netgen restricts local size by curvature of the face triangulation, it is made
+	// here once so that the sizes do not depend on triangulations left by others
+	MGTMeshUtils_DefaultParameters::TriangulateShape(_shape);
+	NetgenPlugin_Mesher::PrepareOCCgeometry(*_occgeo, _shape);
+}
+
+//----------------------------------------------------------------------------
+NetgenPlugin_PreparedGeometry::~NetgenPlugin_PreparedGeometry() = default;
+
+//----------------------------------------------------------------------------
+double NetgenPlugin_PreparedGeometry::GetShapeMinSize() {
+	if (!_shapeMinSize)
+		_shapeMinSize = MGTMeshUtils_DefaultParameters::GetShapeMinSize(_shape);
+	return *_shapeMinSize;
+}
+
+//----------------------------------------------------------------------------
+std::shared_ptr<const NetgenPlugin_SurfaceProjector>
+NetgenPlugin_PreparedGeometry::GetSurfaceProjector() {
+	if (!_surfaceProjector)
+		_surfaceProjector = std::make_shared<NetgenPlugin_SurfaceProjector>(*_occgeo);
+	return _surfaceProjector;
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : NetgenPlugin_PreparedGeometry.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef NETGENPLUGIN_PREPAREDGEOMETRY_HPP
+#define NETGENPLUGIN_PREPAREDGEOMETRY_HPP
+
+#include "NetgenPlugin_Defs.hpp"
+
+#include <TopoDS_Shape.hxx>
+
+#include <memory>
+#include <optional>
+
+namespace netgen {
+class OCCGeometry;
+}
+
+class NetgenPlugin_SurfaceProjector;
+
+/**
+ * Netgen geometry of a shape with data that do not depend on mesh parameters. It is
+ * prepared once per part and shared by meshes of the same shape generated one after
+ * another with different parameters, each mesher resets per-face sizes before meshing.
+ */
+class NETGENPLUGIN_EXPORT NetgenPlugin_PreparedGeometry {
+public:
+	explicit NetgenPlugin_PreparedGeometry(const TopoDS_Shape& shape);
+	~NetgenPlugin_PreparedGeometry();
+
+	NetgenPlugin_PreparedGeometry(const NetgenPlugin_PreparedGeometry&) = delete;
+	NetgenPlugin_PreparedGeometry& operator=(const NetgenPlugin_PreparedGeometry&) = delete;
+
+	[[nodiscard]] const TopoDS_Shape& GetShape() const { return _shape; }
+	[[nodiscard]] netgen::OCCGeometry& GetOCCGeometry() { return *_occgeo; }
+
+	// Smallest feature of the shape, computed on first use
+	[[nodiscard]] double GetShapeMinSize();
+
+	// Projection onto faces numbered as in the geometry, created on first use
+	[[nodiscard]] std::shared_ptr<const NetgenPlugin_SurfaceProjector> GetSurfaceProjector();
+
+private:
+	TopoDS_Shape _shape;
+	std::unique_ptr<netgen::OCCGeometry> _occgeo;
+	std::optional<double> _shapeMinSize;
+	std::shared_ptr<const NetgenPlugin_SurfaceProjector> _surfaceProjector;
+};
+
+#endif
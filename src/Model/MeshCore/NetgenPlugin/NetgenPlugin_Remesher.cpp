@@ -0,0 +1,625 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : NetgenPlugin_Remesher.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "NetgenPlugin_Remesher.hpp"
+#include "MGTMeshUtils_ComputeError.hpp"
+#include "MGTMesh_MeshData.hpp"
+#include "MGTMesh_MeshObject.hpp"
+#include "NetgenPlugin_NetgenLibWrapper.h"
+#include "NetgenPlugin_Parameters.hpp"
+
+#include <vtkCellData.h>
+#include <vtkCellType.h>
+#include <vtkFloatArray.h>
+#include <vtkNew.h>
+
+#include <meshing.hpp>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace netgen {
+NETGENPLUGIN_DLL_HEADER
+extern MeshingParameters mparam;
+}
+
+namespace {
+
+using Dimension = MGTMesh_MeshData::Dimension;
+using Metric = MGTMesh_Quality::Metric;
+using Face = std::array<std::int32_t, 3>;
+
+// Nodes of tetrahedron faces followed by the opposite node
+constexpr std::array<std::array<int, 4>, 4> TetraFaces { {
+	{ 0, 1, 3, 2 },
+	{ 1, 2, 3, 0 },
+	{ 2, 0, 3, 1 },
+	{ 0, 2, 1, 3 },
+} };
+
+// Relative difference of volumes of removed and new elements of a cavity
+constexpr double VolumeTolerance = 1e-6;
+
+// Volume elements of mesh data with node to tetrahedra adjacency
+struct VolumeTopology {
+	std::span<const std::int32_t> connectivity;
+	std::span<const std::int32_t> tags;
+	std::vector<vtkIdType> offsets;
+	std::vector<vtkIdType> nodeOffsets;
+	std::vector<vtkIdType> nodeTetrahedra;
+
+	explicit VolumeTopology(const MGTMesh_MeshData* meshData)
+		: connectivity(meshData->GetConnectivity(Dimension::Volume))
+		, tags(meshData->GetTags(Dimension::Volume)) {
+		offsets.assign(meshData->GetNumberOfElements(Dimension::Volume) + 1, 0);
+		for (const MGTMesh_MeshData::ElementBlock& block :
+			meshData->GetBlocks(Dimension::Volume)) {
+			for (vtkIdType i = block.firstElement; i < block.firstElement + block.elementsNb; ++i)
+				offsets[i + 1] = offsets[i] + block.nodesNb;
+		}
+
+		nodeOffsets.assign(meshData->GetNumberOfNodes() + 1, 0);
+		for (vtkIdType element = 0; element < this->GetElementsNb(); ++element) {
+			if (this->IsTetra(element)) {
+				for (const std::int32_t node : this->GetNodes(element))
+					++nodeOffsets[node + 1];
+			}
+		}
+		std::partial_sum(nodeOffsets.begin(), nodeOffsets.end(), nodeOffsets.begin());
+
+		nodeTetrahedra.resize(nodeOffsets.back());
+		std::vector<vtkIdType> positions(nodeOffsets.begin(), nodeOffsets.end() - 1);
+		for (vtkIdType element = 0; element < this->GetElementsNb(); ++element) {
+			if (this->IsTetra(element)) {
+				for (const std::int32_t node : this->GetNodes(element))
+					nodeTetrahedra[positions[node]++] = element;
+			}
+		}
+	}
+
+	[[nodiscard]] vtkIdType GetElementsNb() const {
+		return static_cast<vtkIdType>(offsets.size()) - 1;
+	}
+
+	[[nodiscard]] bool IsTetra(const vtkIdType element) const {
+		return offsets[element + 1] - offsets[element] == 4;
+	}
+
+	[[nodiscard]] std::span<const std::int32_t> GetNodes(const vtkIdType element) const {
+		return connectivity.subspan(offsets[element], offsets[element + 1] - offsets[element]);
+	}
+
+	[[nodiscard]] std::span<const vtkIdType> GetNodeTetrahedra(const std::int32_t node) const {
+		return std::span(nodeTetrahedra)
+			.subspan(nodeOffsets[node], nodeOffsets[node + 1] - nodeOffsets[node]);
+	}
+};
+
+// Restores global Netgen meshing parameters of the caller when leaving the scope
+class MeshingParametersGuard {
+public:
+	MeshingParametersGuard()
+		: _saved(netgen::mparam) { }
+	~MeshingParametersGuard() { netgen::mparam = _saved; }
+
+	MeshingParametersGuard(const MeshingParametersGuard&) = delete;
+	MeshingParametersGuard& operator=(const MeshingParametersGuard&) = delete;
+
+private:
+	netgen::MeshingParameters _saved;
+};
+
+// Tetrahedra filling a cavity, nodes on the cavity boundary come first
+struct CavityMesh {
+	std::vector<std::int32_t> boundaryNodes;
+	std::vector<double> nodes;
+	std::vector<std::int32_t> connectivity;
+};
+
+// Volume elements to be removed and tetrahedra with new nodes replacing them
+struct Splice {
+	std::vector<char> removed;
+	std::vector<double> nodes;
+	std::vector<std::int32_t> connectivity;
+	std::vector<std::int32_t> tags;
+};
+
+const double* GetPoint(const std::span<const double> nodes, const std::int32_t node) {
+	return nodes.data() + 3 * static_cast<std::size_t>(node);
+}
+
+double GetDistance(const double* p0, const double* p1) {
+	return std::hypot(p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2]);
+}
+
+// Positive if p3 lies on the side of p0, p1, p2 triangle normal
+double GetSignedVolume(const double* p0, const double* p1, const double* p2, const double* p3) {
+	const double a[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+	const double b[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+	const double c[3] = { p3[0] - p0[0], p3[1] - p0[1], p3[2] - p0[2] };
+	return (c[0] * (a[1] * b[2] - a[2] * b[1]) + c[1] * (a[2] * b[0] - a[0] * b[2])
+			   + c[2] * (a[0] * b[1] - a[1] * b[0]))
+		/ 6.0;
+}
+
+// Tetrahedra worse than the threshold followed by layers of their node neighbours
+std::vector<vtkIdType> MarkElements(const VolumeTopology& topology, const vtkFloatArray* values,
+	const Metric metric, const double threshold, const int layersNb) {
+	std::vector<char> isMarked(topology.GetElementsNb(), 0);
+	std::vector<vtkIdType> marked;
+	for (vtkIdType element = 0; element < topology.GetElementsNb(); ++element) {
+		if (topology.IsTetra(element)
+			&& MGTMesh_Quality::IsWorse(metric, values->GetValue(element), threshold)) {
+			isMarked[element] = 1;
+			marked.push_back(element);
+		}
+	}
+
+	std::size_t layerBegin = 0;
+	for (int layer = 0; layer < layersNb; ++layer) {
+		const std::size_t layerEnd = marked.size();
+		for (std::size_t i = layerBegin; i < layerEnd; ++i) {
+			for (const std::int32_t node : topology.GetNodes(marked[i])) {
+				for (const vtkIdType neighbour : topology.GetNodeTetrahedra(node)) {
+					if (!isMarked[neighbour]) {
+						isMarked[neighbour] = 1;
+						marked.push_back(neighbour);
+					}
+				}
+			}
+		}
+		layerBegin = layerEnd;
+	}
+	return marked;
+}
+
+// Groups marked elements of the same solid connected through their faces
+std::vector<std::vector<vtkIdType>> SplitIntoCavities(
+	const VolumeTopology& topology, const std::vector<vtkIdType>& marked) {
+	std::vector<std::pair<Face, std::size_t>> faces;
+	faces.reserve(4 * marked.size());
+	for (std::size_t i = 0; i < marked.size(); ++i) {
+		const std::span<const std::int32_t> nodes = topology.GetNodes(marked[i]);
+		for (const std::array<int, 4>& face : TetraFaces) {
+			Face key { nodes[face[0]], nodes[face[1]], nodes[face[2]] };
+			std::ranges::sort(key);
+			faces.emplace_back(key, i);
+		}
+	}
+	std::ranges::sort(faces);
+
+	std::vector<std::size_t> parents(marked.size());
+	std::iota(parents.begin(), parents.end(), 0);
+	const auto findRoot = [&parents](std::size_t i) {
+		while (parents[i] != i)
+			i = parents[i] = parents[parents[i]];
+		return i;
+	};
+	for (std::size_t i = 1; i < faces.size(); ++i) {
+		const std::size_t first = faces[i - 1].second;
+		const std::size_t second = faces[i].second;
+		if (faces[i - 1].first == faces[i].first
+			&& topology.tags[marked[first]] == topology.tags[marked[second]])
+			parents[findRoot(first)] = findRoot(second);
+	}
+
+	std::vector<std::vector<vtkIdType>> cavities;
+	std::vector<std::size_t> cavityIds(marked.size(), std::numeric_limits<std::size_t>::max());
+	for (std::size_t i = 0; i < marked.size(); ++i) {
+		const std::size_t root = findRoot(i);
+		if (cavityIds[root] == std::numeric_limits<std::size_t>::max()) {
+			cavityIds[root] = cavities.size();
+			cavities.emplace_back();
+		}
+		cavities[cavityIds[root]].push_back(marked[i]);
+	}
+	return cavities;
+}
+
+// Faces of cavity elements that are not shared by two of them, oriented out of the cavity
+std::vector<Face> GetBoundaryFaces(const VolumeTopology& topology,
+	const std::span<const double> nodes, const std::vector<vtkIdType>& cavity) {
+	std::vector<std::pair<Face, Face>> faces;
+	faces.reserve(4 * cavity.size());
+	for (const vtkIdType element : cavity) {
+		const std::span<const std::int32_t> elementNodes = topology.GetNodes(element);
+		for (const std::array<int, 4>& face : TetraFaces) {
+			Face oriented { elementNodes[face[0]], elementNodes[face[1]], elementNodes[face[2]] };
+			if (GetSignedVolume(GetPoint(nodes, oriented[0]), GetPoint(nodes, oriented[1]),
+					GetPoint(nodes, oriented[2]), GetPoint(nodes, elementNodes[face[3]]))
+				> 0.0)
+				std::swap(oriented[1], oriented[2]);
+
+			Face key = oriented;
+			std::ranges::sort(key);
+			faces.emplace_back(key, oriented);
+		}
+	}
+	std::ranges::sort(faces, {}, &std::pair<Face, Face>::first);
+
+	std::vector<Face> boundaryFaces;
+	for (std::size_t i = 0; i < faces.size();) {
+		std::size_t next = i + 1;
+		while (next < faces.size() && faces[next].first == faces[i].first)
+			++next;
+		if (next - i == 1)
+			boundaryFaces.push_back(faces[i].second);
+		i = next;
+	}
+	return boundaryFaces;
+}
+
+// Fills cavity bounded by the faces with tetrahedra, boundary nodes are kept in place
+bool RemeshCavity(NetgenPlugin_NetgenLibWrapper& ngLib, const std::span<const double> nodes,
+	const std::vector<Face>& faces, const int optStepsNb, CavityMesh& cavityMesh) {
+	std::vector<std::int32_t>& boundaryNodes = cavityMesh.boundaryNodes;
+	boundaryNodes.clear();
+	for (const Face& face : faces)
+		boundaryNodes.insert(boundaryNodes.end(), face.begin(), face.end());
+	std::ranges::sort(boundaryNodes);
+	boundaryNodes.erase(std::ranges::unique(boundaryNodes).begin(), boundaryNodes.end());
+
+	auto* ngMesh = new netgen::Mesh;
+	ngLib.setMesh(reinterpret_cast<nglib::Ng_Mesh*>(ngMesh));
+
+	// Fixed points are not moved by volume optimization
+	std::vector<netgen::PointIndex> pointIds;
+	pointIds.reserve(boundaryNodes.size());
+	for (const std::int32_t node : boundaryNodes) {
+		const double* p = GetPoint(nodes, node);
+		pointIds.push_back(
+			ngMesh->AddPoint(netgen::Point3d(p[0], p[1], p[2]), 1, netgen::FIXEDPOINT));
+	}
+
+	// Faces point out of the domain on their inner side
+	const int faceIndex = ngMesh->AddFaceDescriptor(netgen::FaceDescriptor(1, 1, 0, 1));
+	double maxEdge = 0.0;
+	for (const Face& face : faces) {
+		netgen::Element2d element(3);
+		element.SetIndex(faceIndex);
+		for (int j = 0; j < 3; ++j) {
+			const auto local = std::ranges::lower_bound(boundaryNodes, face[j]) - boundaryNodes.begin();
+			element[j] = pointIds[local];
+			maxEdge = std::max(maxEdge,
+				GetDistance(GetPoint(nodes, face[j]), GetPoint(nodes, face[(j + 1) % 3])));
+		}
+		ngMesh->AddSurfaceElement(element);
+	}
+
+	const MeshingParametersGuard parametersGuard;
+	netgen::MeshingParameters& mParams = netgen::mparam;
+	mParams = netgen::MeshingParameters();
+	mParams.maxh = maxEdge;
+	mParams.optsteps3d = optStepsNb;
+
+	try {
+		ngMesh->CalcLocalH(mParams.grading);
+		if (netgen::MeshVolume(mParams, *ngMesh) != netgen::MESHING3_OK)
+			return false;
+		netgen::RemoveIllegalElements(*ngMesh);
+		netgen::OptimizeVolume(mParams, *ngMesh);
+	} catch (netgen::NgException& ex) {
+		SPDLOG_ERROR("Netgen Exception: {}", ex.What());
+		return false;
+	}
+
+	const auto nodesNb = static_cast<std::size_t>(ngMesh->GetNP());
+	cavityMesh.nodes.resize(3 * nodesNb);
+	for (std::size_t i = 0; i < nodesNb; ++i) {
+		const netgen::MeshPoint& point = ngMesh->Point(static_cast<int>(i + 1));
+		for (int k = 0; k < 3; ++k)
+			cavityMesh.nodes[3 * i + k] = point(k);
+	}
+
+	// Splicing relies on boundary nodes staying in front of new ones
+	if (nodesNb < boundaryNodes.size())
+		return false;
+	for (std::size_t i = 0; i < boundaryNodes.size(); ++i) {
+		if (!std::equal(cavityMesh.nodes.begin() + 3 * i, cavityMesh.nodes.begin() + 3 * i + 3,
+				GetPoint(nodes, boundaryNodes[i]))) {
+			SPDLOG_WARN("Boundary of re-meshed cavity was modified by Netgen");
+			return false;
+		}
+	}
+
+	cavityMesh.connectivity.clear();
+	for (int i = 1; i <= static_cast<int>(ngMesh->GetNE()); ++i) {
+		const netgen::Element& element = ngMesh->VolumeElement(i);
+		if (element.GetType() != netgen::TET)
+			return false;
+		for (int j = 0; j < 4; ++j)
+			cavityMesh.connectivity.push_back(element[j] - 1);
+	}
+	return !cavityMesh.connectivity.empty();
+}
+
+// New tetrahedra must have orientation of the removed ones and the same total volume
+bool FillsCavity(const CavityMesh& cavityMesh, const VolumeTopology& topology,
+	const std::span<const double> nodes, const std::vector<vtkIdType>& cavity) {
+	double cavityVolume = 0.0;
+	for (const vtkIdType element : cavity) {
+		const std::span<const std::int32_t> elementNodes = topology.GetNodes(element);
+		cavityVolume += GetSignedVolume(GetPoint(nodes, elementNodes[0]),
+			GetPoint(nodes, elementNodes[1]), GetPoint(nodes, elementNodes[2]),
+			GetPoint(nodes, elementNodes[3]));
+	}
+
+	const std::span<const double> localNodes = cavityMesh.nodes;
+	const std::span<const std::int32_t> connectivity = cavityMesh.connectivity;
+	double volume = 0.0;
+	for (std::size_t i = 0; i + 3 < connectivity.size(); i += 4) {
+		const double elementVolume = GetSignedVolume(GetPoint(localNodes, connectivity[i]),
+			GetPoint(localNodes, connectivity[i + 1]), GetPoint(localNodes, connectivity[i + 2]),
+			GetPoint(localNodes, connectivity[i + 3]));
+		if (elementVolume * cavityVolume <= 0.0)
+			return false;
+		volume += elementVolume;
+	}
+	return std::abs(volume - cavityVolume) <= VolumeTolerance * std::abs(cavityVolume);
+}
+
+// Worst metric value of cavity mesh elements, NaN if it could not be evaluated
+double GetWorstValue(const CavityMesh& cavityMesh, const Metric metric) {
+	vtkNew<MGTMesh_MeshData> meshData;
+	const std::span<double> coords
+		= meshData->AllocateNodes(static_cast<vtkIdType>(cavityMesh.nodes.size() / 3));
+	std::ranges::copy(cavityMesh.nodes, coords.begin());
+
+	const MGTMesh_MeshData::BlockData block = meshData->AppendBlock(Dimension::Volume,
+		VTK_TETRA, static_cast<vtkIdType>(cavityMesh.connectivity.size() / 4));
+	std::ranges::copy(cavityMesh.connectivity, block.connectivity.begin());
+	std::ranges::fill(block.tags, 0);
+
+	vtkNew<MGTMesh_MeshObject> meshObject;
+	meshObject->SetMeshData(meshData);
+
+	MGTMesh_Quality quality(metric);
+	quality.SetWorstElementsNumber(1);
+	if (!quality.Evaluate(meshObject) || quality.GetInternalReport().worstElements.empty())
+		return std::numeric_limits<double>::quiet_NaN();
+	return quality.GetInternalReport().worstElements.front().second;
+}
+
+// Copy of mesh data with removed volume elements replaced by spliced ones. Nodes used
+// only by removed elements are dropped, the rest keep their order.
+vtkSmartPointer<MGTMesh_MeshData> ApplySplice(
+	const MGTMesh_MeshData* meshData, const Splice& splice) {
+	const std::span<const double> nodes = meshData->GetNodes();
+	const vtkIdType oldNodesNb = meshData->GetNumberOfNodes();
+	const std::span<const std::int32_t> surfaceConnectivity
+		= meshData->GetConnectivity(Dimension::Surface);
+	const std::span<const std::int32_t> volumeConnectivity
+		= meshData->GetConnectivity(Dimension::Volume);
+	const std::vector<MGTMesh_MeshData::ElementBlock>& volumeBlocks
+		= meshData->GetBlocks(Dimension::Volume);
+
+	std::vector<char> isUsed(oldNodesNb + static_cast<vtkIdType>(splice.nodes.size() / 3), 0);
+	for (const std::int32_t node : surfaceConnectivity)
+		isUsed[node] = 1;
+	for (const std::int32_t node : splice.connectivity)
+		isUsed[node] = 1;
+	vtkIdType offset = 0;
+	for (const MGTMesh_MeshData::ElementBlock& block : volumeBlocks) {
+		for (vtkIdType i = 0; i < block.elementsNb; ++i) {
+			if (splice.removed[block.firstElement + i])
+				continue;
+			for (int j = 0; j < block.nodesNb; ++j)
+				isUsed[volumeConnectivity[offset + i * block.nodesNb + j]] = 1;
+		}
+		offset += block.elementsNb * block.nodesNb;
+	}
+
+	std::vector<std::int32_t> newIds(isUsed.size(), -1);
+	std::int32_t usedNodesNb = 0;
+	for (std::size_t node = 0; node < isUsed.size(); ++node) {
+		if (isUsed[node])
+			newIds[node] = usedNodesNb++;
+	}
+	const auto toNewId = [&newIds](const std::int32_t node) { return newIds[node]; };
+
+	auto result = vtkSmartPointer<MGTMesh_MeshData>::New();
+	const std::span<double> coords = result->AllocateNodes(usedNodesNb);
+	if (coords.empty())
+		return nullptr;
+	for (std::size_t node = 0; node < isUsed.size(); ++node) {
+		if (!isUsed[node])
+			continue;
+		const double* point = static_cast<vtkIdType>(node) < oldNodesNb
+			? GetPoint(nodes, static_cast<std::int32_t>(node))
+			: GetPoint(splice.nodes, static_cast<std::int32_t>(node - oldNodesNb));
+		std::copy_n(point, 3, coords.begin() + 3 * static_cast<std::ptrdiff_t>(newIds[node]));
+	}
+	spdlog::debug("Dropped {} nodes of removed elements",
+		static_cast<vtkIdType>(isUsed.size()) - usedNodesNb);
+
+	const std::span<const std::int32_t> surfaceTags = meshData->GetTags(Dimension::Surface);
+	offset = 0;
+	for (const MGTMesh_MeshData::ElementBlock& block : meshData->GetBlocks(Dimension::Surface)) {
+		const vtkIdType valuesNb = block.elementsNb * block.nodesNb;
+		const MGTMesh_MeshData::BlockData target
+			= result->AppendBlock(Dimension::Surface, block.cellType, block.elementsNb);
+		std::ranges::transform(surfaceConnectivity.subspan(offset, valuesNb),
+			target.connectivity.begin(), toNewId);
+		std::ranges::copy(
+			surfaceTags.subspan(block.firstElement, block.elementsNb), target.tags.begin());
+		offset += valuesNb;
+	}
+
+	// Spliced tetrahedra are appended to the first block of tetrahedra
+	const std::span<const std::int32_t> volumeTags = meshData->GetTags(Dimension::Volume);
+	const auto addedNb = static_cast<vtkIdType>(splice.tags.size());
+	bool isSpliced = false;
+	offset = 0;
+	for (const MGTMesh_MeshData::ElementBlock& block : volumeBlocks) {
+		const vtkIdType lastElement = block.firstElement + block.elementsNb;
+		const vtkIdType keptNb = std::count(splice.removed.begin() + block.firstElement,
+			splice.removed.begin() + lastElement, 0);
+		const bool isSplicedBlock = block.cellType == VTK_TETRA && !isSpliced;
+		const vtkIdType elementsNb = keptNb + (isSplicedBlock ? addedNb : 0);
+
+		if (elementsNb > 0) {
+			const MGTMesh_MeshData::BlockData target
+				= result->AppendBlock(Dimension::Volume, block.cellType, elementsNb);
+			vtkIdType position = 0;
+			for (vtkIdType element = block.firstElement; element < lastElement; ++element) {
+				if (splice.removed[element])
+					continue;
+				const auto first = volumeConnectivity.begin()
+					+ (offset + (element - block.firstElement) * block.nodesNb);
+				std::transform(first, first + block.nodesNb,
+					target.connectivity.begin() + position * block.nodesNb, toNewId);
+				target.tags[position++] = volumeTags[element];
+			}
+			if (isSplicedBlock) {
+				std::ranges::transform(
+					splice.connectivity, target.connectivity.begin() + position * 4, toNewId);
+				std::ranges::copy(splice.tags, target.tags.begin() + position);
+				isSpliced = true;
+			}
+		}
+		offset += block.elementsNb * block.nodesNb;
+	}
+	return result;
+}
+
+}
+
+//----------------------------------------------------------------------------
+NetgenPlugin_Remesher::NetgenPlugin_Remesher(
+	MGTMesh_MeshObject* mesh, const MGTMesh_Quality::Metric metric, const double threshold)
+	: _mesh(mesh)
+	, _metric(metric)
+	, _threshold(threshold)
+	, _layersNb(1)
+	, _optStepsNb(NetgenPlugin_Parameters::GetDefaultNbVolOptSteps()) { }
+
+//----------------------------------------------------------------------------
+int NetgenPlugin_Remesher::Compute() {
+	const vtkSmartPointer<MGTMesh_MeshData> meshData = _mesh ? _mesh->GetMeshData() : nullptr;
+	if (!meshData) {
+		SPDLOG_ERROR("Local re-meshing requires native data of generated mesh");
+		return COMPERR_BAD_INPUT_MESH;
+	}
+
+	MGTMesh_Quality quality(_metric);
+	quality.SetWorstElementsNumber(1);
+	const std::string arrayName = MGTMesh_Quality::GetArrayName(_metric);
+	const vtkSmartPointer<vtkFloatArray> values = quality.Evaluate(_mesh)
+		? vtkFloatArray::SafeDownCast(
+			  _mesh->GetInternalMesh()->GetCellData()->GetArray(arrayName.c_str()))
+		: nullptr;
+	if (!values || quality.GetInternalReport().worstElements.empty()) {
+		SPDLOG_ERROR("Quality of volume elements could not be evaluated");
+		return COMPERR_BAD_INPUT_MESH;
+	}
+	const std::string metricName = MGTMesh_Quality::GetMetricName(_metric);
+	const double worstBefore = quality.GetInternalReport().worstElements.front().second;
+
+	const VolumeTopology topology(meshData);
+	const std::vector<vtkIdType> marked
+		= MarkElements(topology, values, _metric, _threshold, _layersNb);
+	if (marked.empty()) {
+		SPDLOG_INFO("No tetrahedra with {} worse than {}, nothing to re-mesh", metricName,
+			_threshold);
+		return COMPERR_OK;
+	}
+
+	const std::vector<std::vector<vtkIdType>> cavities = SplitIntoCavities(topology, marked);
+	SPDLOG_INFO("Re-meshing {} cavities of {} tetrahedra", cavities.size(), marked.size());
+
+	const std::span<const double> nodes = meshData->GetNodes();
+	Splice splice;
+	splice.removed.assign(topology.GetElementsNb(), 0);
+	std::size_t remeshedNb = 0;
+	vtkIdType removedNb = 0;
+
+	NetgenPlugin_NetgenLibWrapper ngLib;
+	CavityMesh cavityMesh;
+	for (const std::vector<vtkIdType>& cavity : cavities) {
+		const std::vector<Face> faces = GetBoundaryFaces(topology, nodes, cavity);
+		if (!RemeshCavity(ngLib, nodes, faces, _optStepsNb, cavityMesh)
+			|| !FillsCavity(cavityMesh, topology, nodes, cavity)) {
+			spdlog::debug("Re-meshing of cavity of {} elements failed", cavity.size());
+			continue;
+		}
+
+		double worstRemoved = values->GetValue(cavity.front());
+		for (const vtkIdType element : cavity) {
+			if (MGTMesh_Quality::IsWorse(_metric, values->GetValue(element), worstRemoved))
+				worstRemoved = values->GetValue(element);
+		}
+		const double worstAdded = GetWorstValue(cavityMesh, _metric);
+		if (!MGTMesh_Quality::IsWorse(_metric, worstRemoved, worstAdded)) {
+			spdlog::debug("Re-meshed cavity of {} elements rejected, {} {:.4g} not improved: {:.4g}",
+				cavity.size(), metricName, worstRemoved, worstAdded);
+			continue;
+		}
+
+		// Inner nodes created by Netgen are appended after already spliced ones
+		const auto boundaryNodesNb = static_cast<std::int32_t>(cavityMesh.boundaryNodes.size());
+		const auto newNodesOffset = static_cast<std::int32_t>(meshData->GetNumberOfNodes()
+			+ static_cast<vtkIdType>(splice.nodes.size() / 3) - boundaryNodesNb);
+		splice.nodes.insert(splice.nodes.end(), cavityMesh.nodes.begin() + 3 * boundaryNodesNb,
+			cavityMesh.nodes.end());
+		for (const std::int32_t node : cavityMesh.connectivity) {
+			splice.connectivity.push_back(
+				node < boundaryNodesNb ? cavityMesh.boundaryNodes[node] : newNodesOffset + node);
+		}
+		splice.tags.insert(
+			splice.tags.end(), cavityMesh.connectivity.size() / 4, topology.tags[cavity.front()]);
+
+		for (const vtkIdType element : cavity)
+			splice.removed[element] = 1;
+		removedNb += static_cast<vtkIdType>(cavity.size());
+		++remeshedNb;
+	}
+
+	if (remeshedNb == 0) {
+		SPDLOG_WARN("None of {} cavities could be improved by re-meshing", cavities.size());
+		return COMPERR_OK;
+	}
+
+	const vtkSmartPointer<MGTMesh_MeshData> repaired = ApplySplice(meshData, splice);
+	if (!repaired)
+		return COMPERR_ALGO_FAILED;
+	_mesh->SetMeshData(repaired);
+
+	const double worstAfter = quality.Evaluate(_mesh)
+			&& !quality.GetInternalReport().worstElements.empty()
+		? quality.GetInternalReport().worstElements.front().second
+		: std::numeric_limits<double>::quiet_NaN();
+	SPDLOG_INFO("Re-meshed {} of {} cavities, {} tetrahedra replaced by {}, worst {}: {:.4g} -> {:.4g}",
+		remeshedNb, cavities.size(), removedNb, splice.tags.size(), metricName, worstBefore,
+		worstAfter);
+	return COMPERR_OK;
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : NetgenPlugin_Remesher.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef NETGENPLUGIN_REMESHER_HPP
+#define NETGENPLUGIN_REMESHER_HPP
+
+#include "MGTMesh_Quality.hpp"
+#include "NetgenPlugin_Defs.hpp"
+
+class MGTMesh_MeshObject;
+
+/**
+ * Local repair of volume mesh. Tetrahedra worse than the threshold are marked together
+ * with layers of their neighbours, marked region is split into face-connected cavities
+ * and each cavity is re-meshed by Netgen with its boundary triangles kept. New elements
+ * replace the cavity only if the worst of them is better than the worst removed one,
+ * the rest of the volume mesh and the surface mesh stay untouched. Requires native mesh
+ * data, cell arrays attached to mesh blocks are dropped.
+ */
+class NETGENPLUGIN_EXPORT NetgenPlugin_Remesher {
+public:
+	NetgenPlugin_Remesher(
+		MGTMesh_MeshObject* mesh, MGTMesh_Quality::Metric metric, double threshold);
+
+	// Number of layers of node neighbours added around bad elements
+	void SetLayersNumber(int layersNb) { _layersNb = layersNb; }
+	void SetOptimizationSteps(int optStepsNb) { _optStepsNb = optStepsNb; }
+
+	// Returns COMPERR_OK also if no element is worse than the threshold
+	int Compute();
+
+private:
+	MGTMesh_MeshObject* _mesh;
+	MGTMesh_Quality::Metric _metric;
+	double _threshold;
+	int _layersNb;
+	int _optStepsNb;
+};
+
+#endif
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : NetgenPlugin_SurfaceProjector.cpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+
+#include "NetgenPlugin_SurfaceProjector.hpp"
+
+#include <BRepTools.hxx>
+#include <BRepTopAdaptor_FClass2d.hxx>
+#include <BRep_Tool.hxx>
+#include <Extrema_ExtAlgo.hxx>
+#include <GeomAPI_ProjectPointOnSurf.hxx>
+#include <Standard_Failure.hxx>
+#include <TopoDS.hxx>
+#include <gp_Pnt.hxx>
+#include <gp_Pnt2d.hxx>
+
+#ifndef OCCGEOMETRY
+#define OCCGEOMETRY
+#endif
+#include <meshing.hpp>
+#include <occgeom.hpp>
+
+#include <spdlog/spdlog.h>
+
+struct NetgenPlugin_SurfaceProjector::FaceProjection {
+	explicit FaceProjection(const Face& face)
+		: classifier(face.face, BRep_Tool::Tolerance(face.face)) {
+		projection.Init(face.surface, face.bounds[0], face.bounds[1], face.bounds[2],
+			face.bounds[3], Extrema_ExtAlgo_Tree);
+	}
+
+	GeomAPI_ProjectPointOnSurf projection;
+	BRepTopAdaptor_FClass2d classifier;
+};
+
+//----------------------------------------------------------------------------
+NetgenPlugin_SurfaceProjector::NetgenPlugin_SurfaceProjector(const TopoDS_Shape& shape) {
+	netgen::OCCGeometry occgeo;
+	occgeo.shape = shape;
+	occgeo.changed = 1;
+	occgeo.BuildFMap();
+	this->AddFaces(occgeo);
+}
+
+//----------------------------------------------------------------------------
+NetgenPlugin_SurfaceProjector::NetgenPlugin_SurfaceProjector(
+	const netgen::OCCGeometry& occgeo) {
+	this->AddFaces(occgeo);
+}
+
+//----------------------------------------------------------------------------
+void NetgenPlugin_SurfaceProjector::AddFaces(const netgen::OCCGeometry& occgeo) {
+	_faces.reserve(occgeo.fmap.Extent());
+	for (int i = 1; i <= occgeo.fmap.Extent(); ++i) {
+		const TopoDS_Face& face = TopoDS::Face(occgeo.fmap(i));
+		Face& projectedFace = _faces.emplace_back();
+		projectedFace.face = face;
+		projectedFace.surface = BRep_Tool::Surface(face);
+		BRepTools::UVBounds(face, projectedFace.bounds[0], projectedFace.bounds[1],
+			projectedFace.bounds[2], projectedFace.bounds[3]);
+	}
+	spdlog::debug("Surface projector prepared for {} faces", _faces.size());
+}
+
+//----------------------------------------------------------------------------
+bool NetgenPlugin_SurfaceProjector::Project(const int faceId, double point[3]) const {
+	if (faceId < 1 || faceId > static_cast<int>(_faces.size()))
+		return false;
+
+	const Face& face = _faces[faceId - 1];
+	if (face.surface.IsNull())
+		return false;
+
+	std::vector<std::shared_ptr<FaceProjection>>& projections = _projections.Local();
+	if (projections.empty())
+		projections.resize(_faces.size());
+	std::shared_ptr<FaceProjection>& faceProjection = projections[faceId - 1];
+
+	try {
+		if (!faceProjection)
+			faceProjection = std::make_shared<FaceProjection>(face);
+
+		GeomAPI_ProjectPointOnSurf& projection = faceProjection->projection;
+		projection.Perform(gp_Pnt(point[0], point[1], point[2]));
+		if (!projection.IsDone() || projection.NbPoints() == 0)
+			return false;
+
+		// Bounds of parameters do not exclude holes and trimmed corners of the face
+		double u, v;
+		projection.LowerDistanceParameters(u, v);
+		if (faceProjection->classifier.Perform(gp_Pnt2d(u, v)) == TopAbs_OUT)
+			return false;
+
+		const gp_Pnt nearestPoint = projection.NearestPoint();
+		point[0] = nearestPoint.X();
+		point[1] = nearestPoint.Y();
+		point[2] = nearestPoint.Z();
+	} catch (const Standard_Failure&) {
+		return false;
+	}
+	return true;
+}
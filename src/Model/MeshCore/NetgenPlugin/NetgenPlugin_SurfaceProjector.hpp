@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*=============================================================================
+* File      : NetgenPlugin_SurfaceProjector.hpp
+* Author    : Paweł Gilewicz
+* Date      : 19/10/2026
+*/
+#ifndef NETGENPLUGIN_SURFACEPROJECTOR_HPP
+#define NETGENPLUGIN_SURFACEPROJECTOR_HPP
+
+#include "NetgenPlugin_Defs.hpp"
+
+#include <Geom_Surface.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <vtkSMPThreadLocal.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace netgen {
+class OCCGeometry;
+}
+
+/**
+ * Projection of points onto faces of the meshed shape. Faces are numbered as in
+ * Netgen OCC geometry, the same IDs are stored as face tags of generated surface
+ * elements. Projection only reads the shape, so it can be called concurrently; every
+ * thread keeps its own projectors of the faces it projected onto.
+ */
+class NETGENPLUGIN_EXPORT NetgenPlugin_SurfaceProjector {
+public:
+	explicit NetgenPlugin_SurfaceProjector(const TopoDS_Shape& shape);
+	// Uses face map of already prepared geometry
+	explicit NetgenPlugin_SurfaceProjector(const netgen::OCCGeometry& occgeo);
+
+	// Moves point to the nearest point of the face, false if face ID is unknown,
+	// projection failed or the nearest point of the surface lies outside of the face
+	bool Project(int faceId, double point[3]) const;
+
+private:
+	void AddFaces(const netgen::OCCGeometry& occgeo);
+
+private:
+	struct Face {
+		TopoDS_Face face;
+		Handle(Geom_Surface) surface;
+		std::array<double, 4> bounds;
+	};
+
+	// Projector and classifier of a face, they are not shared between threads
+	struct FaceProjection;
+
+	// Faces ordered by their IDs starting from 1
+	std::vector<Face> _faces;
+
+	// Face projections of each thread, created on first projection onto the face
+	mutable vtkSMPThreadLocal<std::vector<std::shared_ptr<FaceProjection>>> _projections;
+};
+
+#endif
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MGTMeshUtils_ControlPoint.h"
+
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepTools.hxx>
+#include <BRep_Builder.hxx>
+#include <Bnd_Box.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <string>
+
+namespace {
+
+constexpr int BoxesNb = 84;
+constexpr double FaceSize = 0.2;
+
+// Time of the call in seconds
+template <typename Function>
+double Measure(Function&& function) {
+	const auto start = std::chrono::steady_clock::now();
+	function();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+}
+
+class ControlPointTest : public ::testing::Test {
+protected:
+	void SetUp() override {
+		// Part of 504 faces, boxes are apart so their points are never merged
+		BRep_Builder builder;
+		builder.MakeCompound(part);
+		for (int i = 0; i < BoxesNb; ++i) {
+			const gp_Pnt corner(2.0 * i, 0.0, 0.0);
+			builder.Add(part, BRepPrimAPI_MakeBox(corner, 1.0, 1.0, 1.0).Shape());
+		}
+
+		TopTools_IndexedMapOfShape faces;
+		TopExp::MapShapes(part, TopAbs_FACE, faces);
+		for (int i = 1; i <= faces.Extent(); ++i)
+			sizedFaces.emplace_back(TopoDS::Face(faces(i)), FaceSize);
+	}
+
+	TopoDS_Compound part;
+	std::vector<std::pair<TopoDS_Face, double>> sizedFaces;
+};
+
+TEST_F(ControlPointTest, BatchSamplingMatchesPerFaceSampling) {
+	// Sampling as it was done before, faces triangulated and sampled one by one
+	std::vector<MGTMeshUtils::ControlPoint> perFacePoints;
+	BRepTools::Clean(part);
+	const double perFaceTime = Measure([&] {
+		for (const auto& [face, size] : sizedFaces)
+			MGTMeshUtils::createPointsSampleFromFace(face, size, perFacePoints);
+	});
+
+	std::vector<MGTMeshUtils::ControlPoint> batchPoints;
+	BRepTools::Clean(part);
+	const double batchTime = Measure(
+		[&] { MGTMeshUtils::createPointsSampleFromFaces(sizedFaces, batchPoints); });
+
+	RecordProperty("PerFaceTime", std::to_string(perFaceTime));
+	RecordProperty("BatchTime", std::to_string(batchTime));
+	RecordProperty("Speedup", std::to_string(perFaceTime / batchTime));
+
+	ASSERT_EQ(sizedFaces.size(), 6u * BoxesNb);
+	ASSERT_FALSE(perFacePoints.empty());
+	// Merging may only drop points lying within a fraction of size from each other
+	EXPECT_LE(batchPoints.size(), perFacePoints.size());
+	EXPECT_GE(batchPoints.size(), perFacePoints.size() * 99 / 100);
+
+	Bnd_Box perFaceBox, batchBox;
+	for (const MGTMeshUtils::ControlPoint& point : perFacePoints)
+		perFaceBox.Add(point);
+	for (const MGTMeshUtils::ControlPoint& point : batchPoints) {
+		EXPECT_DOUBLE_EQ(point.Size(), FaceSize);
+		batchBox.Add(point);
+	}
+	EXPECT_NEAR(std::sqrt(batchBox.SquareExtent()), std::sqrt(perFaceBox.SquareExtent()), 1e-9);
+}
+
+TEST_F(ControlPointTest, SharedPointsAreMerged) {
+	std::vector<MGTMeshUtils::ControlPoint> points {
+		{ 0.0, 0.0, 0.0, 1.0 }, { 0.01, 0.0, 0.0, 1.0 }, { 1.0, 0.0, 0.0, 1.0 }
+	};
+	MGTMeshUtils::removeDuplicatePoints(points, 0.05);
+	ASSERT_EQ(points.size(), 2u);
+	EXPECT_DOUBLE_EQ(points[1].X(), 1.0);
+}
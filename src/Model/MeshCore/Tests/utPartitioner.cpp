@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MGTMesh_MeshObject.hpp"
+#include "MGTMesh_Partitioner.hpp"
+
+#include <gtest/gtest.h>
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
+#include <vtkCellType.h>
+#include <vtkIdList.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkTypeInt32Array.h>
+#include <vtkTypeInt64Array.h>
+#include <vtkUnsignedCharArray.h>
+#include <vtkUnstructuredGrid.h>
+
+#include <algorithm>
+#include <map>
+
+namespace {
+
+constexpr int CellsNb = 12;
+constexpr int PartsNb = 7;
+
+vtkIdType NodeId(const int i, const int j, const int k) {
+	return i + (CellsNb + 1) * (j + (CellsNb + 1) * k);
+}
+
+// Slanted block of hexahedra with quads on its bottom face, quad i + n * j bounds cell i + n * j
+vtkSmartPointer<MGTMesh_MeshObject> CreateSlantedBlock() {
+	vtkNew<vtkPoints> points;
+	for (int k = 0; k <= CellsNb; ++k) {
+		for (int j = 0; j <= CellsNb; ++j) {
+			for (int i = 0; i <= CellsNb; ++i)
+				points->InsertNextPoint(i + 0.5 * j, j, 0.3 * k);
+		}
+	}
+
+	vtkNew<vtkUnstructuredGrid> grid;
+	grid->SetPoints(points);
+	for (int k = 0; k < CellsNb; ++k) {
+		for (int j = 0; j < CellsNb; ++j) {
+			for (int i = 0; i < CellsNb; ++i) {
+				const vtkIdType nodes[8] = { NodeId(i, j, k), NodeId(i + 1, j, k),
+					NodeId(i + 1, j + 1, k), NodeId(i, j + 1, k), NodeId(i, j, k + 1),
+					NodeId(i + 1, j, k + 1), NodeId(i + 1, j + 1, k + 1),
+					NodeId(i, j + 1, k + 1) };
+				grid->InsertNextCell(VTK_HEXAHEDRON, 8, nodes);
+			}
+		}
+	}
+
+	vtkNew<vtkCellArray> polys;
+	for (int j = 0; j < CellsNb; ++j) {
+		for (int i = 0; i < CellsNb; ++i) {
+			const vtkIdType nodes[4] = { NodeId(i, j, 0), NodeId(i + 1, j, 0),
+				NodeId(i + 1, j + 1, 0), NodeId(i, j + 1, 0) };
+			polys->InsertNextCell(4, nodes);
+		}
+	}
+	vtkNew<vtkPolyData> boundary;
+	boundary->SetPoints(points);
+	boundary->SetPolys(polys);
+
+	auto mesh = vtkSmartPointer<MGTMesh_MeshObject>::New();
+	mesh->SetInternalMesh(grid);
+	mesh->SetBoundaryMesh(boundary);
+	return mesh;
+}
+
+}
+
+TEST(PartitionerTest, PartsAreBalanced) {
+	const vtkSmartPointer<MGTMesh_MeshObject> mesh = CreateSlantedBlock();
+
+	for (const auto method :
+		{ MGTMesh_Partitioner::Method::Coordinate, MGTMesh_Partitioner::Method::Inertial }) {
+		SCOPED_TRACE(static_cast<int>(method));
+		ASSERT_TRUE(MGTMesh_Partitioner::Partition(mesh, PartsNb, method));
+		ASSERT_TRUE(MGTMesh_Partitioner::IsPartitioned(mesh));
+
+		const auto* partitions = vtkTypeInt32Array::SafeDownCast(
+			mesh->GetInternalMesh()->GetCellData()->GetArray(
+				MGTMesh_Partitioner::PartitionArrayName));
+		ASSERT_NE(partitions, nullptr);
+
+		std::map<int, vtkIdType> counts;
+		for (vtkIdType cell = 0; cell < partitions->GetNumberOfValues(); ++cell)
+			++counts[partitions->GetValue(cell)];
+		ASSERT_EQ(static_cast<int>(counts.size()), PartsNb);
+		const auto [smallest, largest] = std::ranges::minmax_element(
+			counts, {}, [](const auto& count) { return count.second; });
+		EXPECT_LE(largest->second - smallest->second, 1);
+
+		// Bottom quads belong to partitions of the cells of the first layer
+		const auto* boundaryPartitions = vtkTypeInt32Array::SafeDownCast(
+			mesh->GetBoundaryMesh()->GetCellData()->GetArray(
+				MGTMesh_Partitioner::PartitionArrayName));
+		ASSERT_NE(boundaryPartitions, nullptr);
+		for (vtkIdType quad = 0; quad < CellsNb * CellsNb; ++quad)
+			EXPECT_EQ(boundaryPartitions->GetValue(quad), partitions->GetValue(quad));
+	}
+}
+
+TEST(PartitionerTest, ExtractedPartitionsReferenceGlobalMesh) {
+	const vtkSmartPointer<MGTMesh_MeshObject> mesh = CreateSlantedBlock();
+	ASSERT_TRUE(MGTMesh_Partitioner::Partition(mesh, PartsNb));
+
+	const std::vector<vtkSmartPointer<MGTMesh_MeshObject>> parts
+		= MGTMesh_Partitioner::ExtractPartitions(mesh);
+	ASSERT_EQ(static_cast<int>(parts.size()), PartsNb);
+
+	vtkCellArray* globalCells = mesh->GetInternalMesh()->GetCells();
+	vtkNew<vtkIdList> nodes;
+	vtkNew<vtkIdList> globalNodes;
+	vtkIdType ownedNb = 0;
+	for (const vtkSmartPointer<MGTMesh_MeshObject>& part : parts) {
+		const vtkSmartPointer<vtkUnstructuredGrid> grid = part->GetInternalMesh();
+		const auto* ghosts = vtkUnsignedCharArray::SafeDownCast(
+			grid->GetCellData()->GetArray("vtkGhostType"));
+		const auto* globalCellIds = vtkTypeInt64Array::SafeDownCast(
+			grid->GetCellData()->GetArray(MGTMesh_Partitioner::GlobalCellArrayName));
+		const auto* globalNodeIds = vtkTypeInt64Array::SafeDownCast(
+			grid->GetPointData()->GetArray(MGTMesh_Partitioner::GlobalNodeArrayName));
+		ASSERT_NE(ghosts, nullptr);
+		ASSERT_NE(globalCellIds, nullptr);
+		ASSERT_NE(globalNodeIds, nullptr);
+
+		for (vtkIdType cell = 0; cell < grid->GetNumberOfCells(); ++cell) {
+			ownedNb += ghosts->GetValue(cell) == 0;
+			grid->GetCells()->GetCellAtId(cell, nodes);
+			globalCells->GetCellAtId(globalCellIds->GetValue(cell), globalNodes);
+			ASSERT_EQ(nodes->GetNumberOfIds(), globalNodes->GetNumberOfIds());
+			for (vtkIdType n = 0; n < nodes->GetNumberOfIds(); ++n)
+				EXPECT_EQ(globalNodeIds->GetValue(nodes->GetId(n)), globalNodes->GetId(n));
+		}
+	}
+	EXPECT_EQ(ownedNb, CellsNb * CellsNb * CellsNb);
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MGTMesh_MeshData.hpp"
+#include "MGTMesh_MeshObject.hpp"
+#include "MGTMesh_ProxyMesh.hpp"
+
+#include <gtest/gtest.h>
+#include <vtkCellType.h>
+#include <vtkSmartPointer.h>
+
+#include <algorithm>
+#include <set>
+#include <unordered_map>
+
+namespace {
+
+using Dimension = MGTMesh_MeshData::Dimension;
+using MeshObjectsMap = std::unordered_map<int, vtkSmartPointer<MGTMesh_MeshObject>>;
+
+// Unit cube of one hexahedron shifted along x, tagged as solid 1 with faces 1 to 6
+vtkSmartPointer<MGTMesh_MeshObject> CreateCube(const double shift) {
+	auto meshData = vtkSmartPointer<MGTMesh_MeshData>::New();
+	const std::span<double> nodes = meshData->AllocateNodes(8);
+	for (int node = 0; node < 8; ++node) {
+		nodes[3 * node] = shift + ((node + 1) / 2 % 2);
+		nodes[3 * node + 1] = node / 2 % 2;
+		nodes[3 * node + 2] = node / 4;
+	}
+
+	const MGTMesh_MeshData::BlockData volume
+		= meshData->AppendBlock(Dimension::Volume, VTK_HEXAHEDRON, 1);
+	std::ranges::copy(std::array { 0, 1, 2, 3, 4, 5, 6, 7 }, volume.connectivity.begin());
+	volume.tags[0] = 1;
+
+	constexpr std::int32_t Faces[6][4] = { { 0, 4, 7, 3 }, { 1, 2, 6, 5 }, { 0, 1, 5, 4 },
+		{ 3, 7, 6, 2 }, { 0, 3, 2, 1 }, { 4, 5, 6, 7 } };
+	const MGTMesh_MeshData::BlockData surface
+		= meshData->AppendBlock(Dimension::Surface, VTK_QUAD, 6);
+	for (int face = 0; face < 6; ++face) {
+		std::ranges::copy(Faces[face], surface.connectivity.begin() + 4 * face);
+		surface.tags[face] = face + 1;
+	}
+
+	auto mesh = vtkSmartPointer<MGTMesh_MeshObject>::New();
+	mesh->SetMeshData(meshData);
+	return mesh;
+}
+
+std::set<std::int32_t> GetTags(const MGTMesh_MeshData* meshData, const Dimension dimension) {
+	const std::span<const std::int32_t> tags = meshData->GetTags(dimension);
+	return { tags.begin(), tags.end() };
+}
+
+}
+
+TEST(ProxyMeshTest, WeldMergesInterfaceNodes) {
+	const MeshObjectsMap meshObjects { { 0, CreateCube(0.0) }, { 1, CreateCube(1.0) } };
+	const MGTMesh_ProxyMesh proxyMesh(meshObjects, MGTMesh_ProxyMesh::MergeMode::Weld);
+
+	ASSERT_NE(proxyMesh.GetMeshObject(), nullptr);
+	const vtkSmartPointer<MGTMesh_MeshData> merged = proxyMesh.GetMeshObject()->GetMeshData();
+	ASSERT_NE(merged, nullptr);
+	EXPECT_EQ(merged->GetNumberOfNodes(), 12);
+	EXPECT_EQ(merged->GetNumberOfElements(Dimension::Volume), 2);
+	EXPECT_EQ(merged->GetNumberOfElements(Dimension::Surface), 12);
+
+	// Second hexahedron starts on the face x = 1 of the first one
+	const std::span<const std::int32_t> connectivity = merged->GetConnectivity(Dimension::Volume);
+	EXPECT_EQ(connectivity[8], connectivity[1]);
+	EXPECT_EQ(connectivity[11], connectivity[2]);
+	EXPECT_EQ(connectivity[12], connectivity[5]);
+	EXPECT_EQ(connectivity[15], connectivity[6]);
+}
+
+TEST(ProxyMeshTest, WeldOffsetsTagsOfParts) {
+	const MeshObjectsMap meshObjects { { 0, CreateCube(0.0) }, { 1, CreateCube(1.0) } };
+	const MGTMesh_ProxyMesh proxyMesh(meshObjects, MGTMesh_ProxyMesh::MergeMode::Weld);
+
+	const vtkSmartPointer<MGTMesh_MeshData> merged = proxyMesh.GetMeshObject()->GetMeshData();
+	EXPECT_EQ(GetTags(merged, Dimension::Volume), (std::set<std::int32_t> { 1, 2 }));
+	EXPECT_EQ(GetTags(merged, Dimension::Surface).size(), 12u);
+	EXPECT_EQ(*GetTags(merged, Dimension::Surface).rbegin(), 12);
+}
+
+TEST(ProxyMeshTest, WeldKeepsSharedTags) {
+	const MeshObjectsMap meshObjects { { 0, CreateCube(0.0) }, { 1, CreateCube(1.0) } };
+	const MGTMesh_ProxyMesh proxyMesh(meshObjects, MGTMesh_ProxyMesh::MergeMode::Weld,
+		MGTMesh_ProxyMesh::TagMode::Shared);
+
+	const vtkSmartPointer<MGTMesh_MeshData> merged = proxyMesh.GetMeshObject()->GetMeshData();
+	EXPECT_EQ(GetTags(merged, Dimension::Volume), (std::set<std::int32_t> { 1 }));
+	EXPECT_EQ(GetTags(merged, Dimension::Surface), (std::set<std::int32_t> { 1, 2, 3, 4, 5, 6 }));
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MGTMesh_MeshObject.hpp"
+#include "MGTMesh_Quality.hpp"
+
+#include <gtest/gtest.h>
+#include <vtkCellType.h>
+#include <vtkPoints.h>
+#include <vtkSmartPointer.h>
+#include <vtkUnstructuredGrid.h>
+
+#include <cmath>
+#include <numeric>
+
+namespace {
+
+// Regular tetrahedron followed by a flat one with all nodes in z = 0 plane
+vtkSmartPointer<MGTMesh_MeshObject> CreateTetrahedra() {
+	auto points = vtkSmartPointer<vtkPoints>::New();
+	points->InsertNextPoint(1.0, 1.0, 1.0);
+	points->InsertNextPoint(1.0, -1.0, -1.0);
+	points->InsertNextPoint(-1.0, 1.0, -1.0);
+	points->InsertNextPoint(-1.0, -1.0, 1.0);
+	points->InsertNextPoint(0.0, 0.0, 0.0);
+	points->InsertNextPoint(1.0, 0.0, 0.0);
+	points->InsertNextPoint(0.0, 1.0, 0.0);
+	points->InsertNextPoint(1.0, 1.0, 0.0);
+
+	auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+	grid->SetPoints(points);
+	constexpr vtkIdType regular[4] = { 0, 1, 2, 3 };
+	constexpr vtkIdType flat[4] = { 4, 5, 6, 7 };
+	grid->InsertNextCell(VTK_TETRA, 4, regular);
+	grid->InsertNextCell(VTK_TETRA, 4, flat);
+
+	auto mesh = vtkSmartPointer<MGTMesh_MeshObject>::New();
+	mesh->SetInternalMesh(grid);
+	return mesh;
+}
+
+}
+
+TEST(QualityTest, DegeneratedElementFallsIntoLastBin) {
+	const vtkSmartPointer<MGTMesh_MeshObject> mesh = CreateTetrahedra();
+
+	MGTMesh_Quality quality(MGTMesh_Quality::Metric::AspectRatio);
+	quality.SetBinsNumber(10);
+	ASSERT_TRUE(quality.Evaluate(mesh));
+
+	const MGTMesh_Quality::Report& report = quality.GetInternalReport();
+	EXPECT_EQ(report.elementsNb, 2);
+	EXPECT_EQ(report.degeneratedNb, 1);
+
+	const std::vector<vtkIdType>& counts = report.histogram.counts;
+	ASSERT_EQ(counts.size(), 10u);
+	EXPECT_EQ(std::accumulate(counts.begin(), counts.end(), vtkIdType { 0 }), 2);
+	EXPECT_EQ(counts.front(), 1);
+	EXPECT_EQ(counts.back(), 1);
+	EXPECT_LE(report.histogram.max, 100.0);
+
+	ASSERT_FALSE(report.worstElements.empty());
+	EXPECT_EQ(report.worstElements.front().first, 1);
+}
+
+TEST(QualityTest, MeanSkipsDegeneratedElements) {
+	const vtkSmartPointer<MGTMesh_MeshObject> mesh = CreateTetrahedra();
+
+	MGTMesh_Quality quality(MGTMesh_Quality::Metric::AspectRatio);
+	ASSERT_TRUE(quality.Evaluate(mesh));
+
+	const MGTMesh_Quality::Report& report = quality.GetInternalReport();
+	EXPECT_TRUE(std::isfinite(report.mean));
+	EXPECT_NEAR(report.mean, 1.0, 1e-5);
+	EXPECT_NEAR(report.min, 1.0, 1e-5);
+}
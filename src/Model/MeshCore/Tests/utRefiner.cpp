@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MGTMesh_MeshData.hpp"
+#include "MGTMesh_MeshObject.hpp"
+#include "MGTMesh_Refiner.hpp"
+
+#include <gtest/gtest.h>
+#include <vtkCellType.h>
+#include <vtkSmartPointer.h>
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <ranges>
+#include <set>
+
+namespace {
+
+using Dimension = MGTMesh_MeshData::Dimension;
+using Triangle = std::array<std::int32_t, 3>;
+
+constexpr int CellsNb = 3;
+
+// Faces of VTK tetrahedron
+constexpr int TetraFaces[4][3] = { { 0, 1, 3 }, { 1, 2, 3 }, { 2, 0, 3 }, { 0, 2, 1 } };
+
+double GetVolume(const std::span<const double> nodes, const std::int32_t* tetra) {
+	const double* p0 = &nodes[3 * tetra[0]];
+	double u[3], v[3], w[3];
+	for (int i = 0; i < 3; ++i) {
+		u[i] = nodes[3 * tetra[1] + i] - p0[i];
+		v[i] = nodes[3 * tetra[2] + i] - p0[i];
+		w[i] = nodes[3 * tetra[3] + i] - p0[i];
+	}
+	return (w[0] * (u[1] * v[2] - u[2] * v[1]) + w[1] * (u[2] * v[0] - u[0] * v[2])
+			   + w[2] * (u[0] * v[1] - u[1] * v[0]))
+		/ 6.0;
+}
+
+Triangle Sorted(Triangle triangle) {
+	std::ranges::sort(triangle);
+	return triangle;
+}
+
+// Unit cubes split into 6 tetrahedra each, with boundary triangles tagged by cube side
+vtkSmartPointer<MGTMesh_MeshObject> CreateCube() {
+	constexpr int NodesNb = CellsNb + 1;
+	const auto id = [](const int i, const int j, const int k) {
+		return (k * NodesNb + j) * NodesNb + i;
+	};
+
+	auto meshData = vtkSmartPointer<MGTMesh_MeshData>::New();
+	const std::span<double> nodes = meshData->AllocateNodes(NodesNb * NodesNb * NodesNb);
+	for (int k = 0; k < NodesNb; ++k) {
+		for (int j = 0; j < NodesNb; ++j) {
+			for (int i = 0; i < NodesNb; ++i) {
+				nodes[3 * id(i, j, k)] = i;
+				nodes[3 * id(i, j, k) + 1] = j;
+				nodes[3 * id(i, j, k) + 2] = k;
+			}
+		}
+	}
+
+	constexpr int Paths[6][3]
+		= { { 0, 1, 2 }, { 0, 2, 1 }, { 1, 0, 2 }, { 1, 2, 0 }, { 2, 0, 1 }, { 2, 1, 0 } };
+	std::vector<std::array<std::int32_t, 4>> tetrahedra;
+	for (int k = 0; k < CellsNb; ++k) {
+		for (int j = 0; j < CellsNb; ++j) {
+			for (int i = 0; i < CellsNb; ++i) {
+				for (const auto& path : Paths) {
+					int corner[3] = { i, j, k };
+					std::array<std::int32_t, 4> tetra { id(i, j, k) };
+					for (int step = 0; step < 3; ++step) {
+						++corner[path[step]];
+						tetra[step + 1] = id(corner[0], corner[1], corner[2]);
+					}
+					if (GetVolume(nodes, tetra.data()) < 0.0)
+						std::swap(tetra[2], tetra[3]);
+					tetrahedra.push_back(tetra);
+				}
+			}
+		}
+	}
+
+	const MGTMesh_MeshData::BlockData volume = meshData->AppendBlock(
+		Dimension::Volume, VTK_TETRA, static_cast<vtkIdType>(tetrahedra.size()));
+	std::map<Triangle, std::pair<int, Triangle>> faces;
+	for (std::size_t e = 0; e < tetrahedra.size(); ++e) {
+		std::ranges::copy(tetrahedra[e], volume.connectivity.begin() + 4 * e);
+		volume.tags[e] = 1;
+		for (const auto& face : TetraFaces) {
+			const Triangle triangle
+				= { tetrahedra[e][face[0]], tetrahedra[e][face[1]], tetrahedra[e][face[2]] };
+			auto& [count, oriented] = faces[Sorted(triangle)];
+			++count;
+			oriented = triangle;
+		}
+	}
+
+	std::vector<std::pair<Triangle, int>> triangles;
+	for (const auto& [count, triangle] : faces | std::views::values) {
+		if (count != 1)
+			continue;
+		int tag = 0;
+		for (int axis = 0; axis < 3; ++axis) {
+			const auto onSide = [&](const double value) {
+				return std::ranges::all_of(
+					triangle, [&](const int node) { return nodes[3 * node + axis] == value; });
+			};
+			if (onSide(0.0))
+				tag = 1 + 2 * axis;
+			else if (onSide(CellsNb))
+				tag = 2 + 2 * axis;
+		}
+		triangles.emplace_back(triangle, tag);
+	}
+	const MGTMesh_MeshData::BlockData surface = meshData->AppendBlock(
+		Dimension::Surface, VTK_TRIANGLE, static_cast<vtkIdType>(triangles.size()));
+	for (std::size_t e = 0; e < triangles.size(); ++e) {
+		std::ranges::copy(triangles[e].first, surface.connectivity.begin() + 3 * e);
+		surface.tags[e] = triangles[e].second;
+	}
+
+	auto mesh = vtkSmartPointer<MGTMesh_MeshObject>::New();
+	mesh->SetMeshData(meshData);
+	return mesh;
+}
+
+// Checks positive volumes summing up to the cube volume, conforming faces and boundary
+// triangles covering exactly the faces of single tetrahedra
+void ExpectValidCube(const MGTMesh_MeshData* meshData) {
+	const std::span<const double> nodes = meshData->GetNodes();
+	const std::span<const std::int32_t> tetrahedra = meshData->GetConnectivity(Dimension::Volume);
+
+	double volume = 0.0;
+	std::map<Triangle, int> faces;
+	for (std::size_t e = 0; e < tetrahedra.size() / 4; ++e) {
+		const std::int32_t* tetra = &tetrahedra[4 * e];
+		const double tetraVolume = GetVolume(nodes, tetra);
+		EXPECT_GT(tetraVolume, 0.0) << "element " << e;
+		volume += tetraVolume;
+		for (const auto& face : TetraFaces)
+			++faces[Sorted({ tetra[face[0]], tetra[face[1]], tetra[face[2]] })];
+	}
+	EXPECT_NEAR(volume, CellsNb * CellsNb * CellsNb, 1e-9);
+
+	const std::span<const std::int32_t> triangles = meshData->GetConnectivity(Dimension::Surface);
+	std::set<Triangle> boundary;
+	for (std::size_t e = 0; e < triangles.size() / 3; ++e)
+		boundary.insert(Sorted({ triangles[3 * e], triangles[3 * e + 1], triangles[3 * e + 2] }));
+	EXPECT_EQ(boundary.size(), triangles.size() / 3);
+
+	for (const auto& [face, count] : faces) {
+		EXPECT_LE(count, 2);
+		EXPECT_EQ(count == 1, boundary.contains(face));
+	}
+}
+
+}
+
+TEST(RefinerTest, UniformRefinementSplitsAllElements) {
+	const vtkSmartPointer<MGTMesh_MeshObject> mesh = CreateCube();
+	const vtkSmartPointer<MGTMesh_MeshData> meshData = mesh->GetMeshData();
+	const vtkIdType tetrahedraNb = meshData->GetNumberOfElements(Dimension::Volume);
+	const vtkIdType trianglesNb = meshData->GetNumberOfElements(Dimension::Surface);
+
+	MGTMesh_Refiner refiner;
+	ASSERT_TRUE(refiner.Refine(mesh));
+
+	const vtkSmartPointer<MGTMesh_MeshData> refined = mesh->GetMeshData();
+	EXPECT_EQ(refined->GetNumberOfElements(Dimension::Volume), 8 * tetrahedraNb);
+	EXPECT_EQ(refined->GetNumberOfElements(Dimension::Surface), 4 * trianglesNb);
+	ExpectValidCube(refined);
+}
+
+TEST(RefinerTest, MarkedRefinementStaysConforming) {
+	const vtkSmartPointer<MGTMesh_MeshObject> mesh = CreateCube();
+	const vtkIdType tetrahedraNb = mesh->GetMeshData()->GetNumberOfElements(Dimension::Volume);
+
+	MGTMesh_Refiner refiner;
+	refiner.SetMarkedElements({ 0, 5, 17, 42, 100, tetrahedraNb - 1 });
+	ASSERT_TRUE(refiner.Refine(mesh));
+
+	const vtkSmartPointer<MGTMesh_MeshData> refined = mesh->GetMeshData();
+	const vtkIdType refinedNb = refined->GetNumberOfElements(Dimension::Volume);
+	EXPECT_GE(refinedNb, tetrahedraNb + 6 * 7);
+	EXPECT_LT(refinedNb, 8 * tetrahedraNb);
+	ExpectValidCube(refined);
+
+	// Children inherit tags of their parents
+	const std::span<const std::int32_t> tags = refined->GetTags(Dimension::Surface);
+	EXPECT_TRUE(std::ranges::all_of(tags, [](const int tag) { return tag >= 1 && tag <= 6; }));
+}
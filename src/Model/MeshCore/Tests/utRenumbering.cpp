@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MGTMesh_MeshData.hpp"
+#include "MGTMesh_Renumbering.hpp"
+
+#include <gtest/gtest.h>
+#include <vtkCellType.h>
+#include <vtkSmartPointer.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <random>
+#include <set>
+
+namespace {
+
+using Dimension = MGTMesh_MeshData::Dimension;
+using ElementNodes = std::set<std::array<double, 3>>;
+
+constexpr int GridSize = 12;
+
+// Structured grid of hexahedra with shuffled node and element IDs, tagged by index
+vtkSmartPointer<MGTMesh_MeshData> CreateShuffledGrid() {
+	std::vector<int> ids(GridSize * GridSize * GridSize);
+	std::iota(ids.begin(), ids.end(), 0);
+	std::mt19937 random(1);
+	std::ranges::shuffle(ids, random);
+	const auto id = [&ids](const int i, const int j, const int k) {
+		return ids[(k * GridSize + j) * GridSize + i];
+	};
+
+	auto meshData = vtkSmartPointer<MGTMesh_MeshData>::New();
+	const std::span<double> nodes = meshData->AllocateNodes(static_cast<vtkIdType>(ids.size()));
+	for (int k = 0; k < GridSize; ++k) {
+		for (int j = 0; j < GridSize; ++j) {
+			for (int i = 0; i < GridSize; ++i) {
+				const int node = id(i, j, k);
+				nodes[3 * node] = i;
+				nodes[3 * node + 1] = j;
+				nodes[3 * node + 2] = k;
+			}
+		}
+	}
+
+	std::vector<std::array<std::int32_t, 8>> hexahedra;
+	for (int k = 0; k + 1 < GridSize; ++k) {
+		for (int j = 0; j + 1 < GridSize; ++j) {
+			for (int i = 0; i + 1 < GridSize; ++i) {
+				hexahedra.push_back({ id(i, j, k), id(i + 1, j, k), id(i + 1, j + 1, k),
+					id(i, j + 1, k), id(i, j, k + 1), id(i + 1, j, k + 1),
+					id(i + 1, j + 1, k + 1), id(i, j + 1, k + 1) });
+			}
+		}
+	}
+	std::ranges::shuffle(hexahedra, random);
+
+	const MGTMesh_MeshData::BlockData block = meshData->AppendBlock(
+		Dimension::Volume, VTK_HEXAHEDRON, static_cast<vtkIdType>(hexahedra.size()));
+	for (std::size_t e = 0; e < hexahedra.size(); ++e) {
+		std::ranges::copy(hexahedra[e], block.connectivity.begin() + 8 * e);
+		block.tags[e] = static_cast<std::int32_t>(e);
+	}
+	return meshData;
+}
+
+// Coordinates of nodes of each element, indexed by element tag
+std::vector<ElementNodes> GetElementsGeometry(const MGTMesh_MeshData* meshData) {
+	const std::span<const std::int32_t> connectivity
+		= meshData->GetConnectivity(Dimension::Volume);
+	const std::span<const std::int32_t> tags = meshData->GetTags(Dimension::Volume);
+	const std::span<const double> nodes = meshData->GetNodes();
+
+	std::vector<ElementNodes> geometry(tags.size());
+	for (std::size_t e = 0; e < tags.size(); ++e) {
+		for (std::size_t n = 0; n < 8; ++n) {
+			const std::int32_t node = connectivity[8 * e + n];
+			geometry[tags[e]].insert({ nodes[3 * node], nodes[3 * node + 1], nodes[3 * node + 2] });
+		}
+	}
+	return geometry;
+}
+
+}
+
+TEST(RenumberingTest, NodesOrderIsPermutation) {
+	const vtkSmartPointer<MGTMesh_MeshData> meshData = CreateShuffledGrid();
+
+	std::vector<std::int32_t> order = MGTMesh_Renumbering::ComputeNodesOrder(meshData);
+	ASSERT_EQ(static_cast<vtkIdType>(order.size()), meshData->GetNumberOfNodes());
+
+	std::ranges::sort(order);
+	for (std::size_t i = 0; i < order.size(); ++i)
+		EXPECT_EQ(order[i], static_cast<std::int32_t>(i));
+}
+
+TEST(RenumberingTest, ReducesBandwidthAndKeepsGeometry) {
+	const vtkSmartPointer<MGTMesh_MeshData> meshData = CreateShuffledGrid();
+	const MGTMesh_Renumbering::Statistics before
+		= MGTMesh_Renumbering::ComputeStatistics(meshData);
+	const std::vector<ElementNodes> geometry = GetElementsGeometry(meshData);
+
+	MGTMesh_Renumbering::Renumber(meshData);
+
+	const MGTMesh_Renumbering::Statistics after
+		= MGTMesh_Renumbering::ComputeStatistics(meshData);
+	EXPECT_LT(after.bandwidth, before.bandwidth);
+	EXPECT_LT(after.profile, before.profile);
+	EXPECT_EQ(GetElementsGeometry(meshData), geometry);
+
+	const std::vector<MGTMesh_MeshData::ElementBlock>& blocks
+		= meshData->GetBlocks(Dimension::Volume);
+	ASSERT_EQ(blocks.size(), 1u);
+	EXPECT_EQ(blocks.front().cellType, VTK_HEXAHEDRON);
+}
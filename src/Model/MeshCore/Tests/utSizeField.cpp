@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MGTMesh_SizeField.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace {
+
+constexpr double GrowthRate = 0.3;
+constexpr double MaxSize = 1.5;
+
+// Field value computed from all sources
+double EvaluateBruteForce(
+	const std::vector<MGTMesh_SizeField::Source>& sources, const double point[3]) {
+	double size = MaxSize;
+	for (const auto& [sourcePoint, sourceSize] : sources) {
+		const double distance = std::hypot(sourcePoint[0] - point[0],
+			sourcePoint[1] - point[1], sourcePoint[2] - point[2]);
+		size = std::min(size, sourceSize + GrowthRate * distance);
+	}
+	return size;
+}
+
+}
+
+class SizeFieldTest : public ::testing::Test {
+protected:
+	void SetUp() override {
+		std::uniform_real_distribution<double> coordinate(0.0, 10.0);
+		std::uniform_real_distribution<double> size(0.1, 2.0);
+		for (int i = 0; i < 2000; ++i) {
+			const double point[3] = { coordinate(random), coordinate(random), coordinate(random) };
+			const double sourceSize = size(random);
+			field.AddSource(point, sourceSize);
+			sources.push_back({ { point[0], point[1], point[2] }, sourceSize });
+		}
+		field.Build();
+	}
+
+	std::mt19937 random { 1 };
+	MGTMesh_SizeField field { GrowthRate, MaxSize };
+	std::vector<MGTMesh_SizeField::Source> sources;
+};
+
+TEST_F(SizeFieldTest, EvaluationMatchesAllSources) {
+	std::uniform_real_distribution<double> coordinate(-1.0, 11.0);
+	std::vector<double> points(3 * 500);
+	std::ranges::generate(points, [&] { return coordinate(random); });
+
+	std::vector<double> sizes(points.size() / 3);
+	field.Evaluate(points, sizes);
+	for (std::size_t i = 0; i < sizes.size(); ++i) {
+		const double* point = &points[3 * i];
+		const double expected = EvaluateBruteForce(sources, point);
+		EXPECT_NEAR(sizes[i], expected, 1e-12);
+		EXPECT_NEAR(field.Evaluate(point), expected, 1e-12);
+	}
+}
+
+TEST_F(SizeFieldTest, DominatedSourcesAreRemoved) {
+	const std::vector<MGTMesh_SizeField::Source>& kept = field.GetSources();
+	EXPECT_LT(kept.size(), sources.size());
+
+	// No kept source is covered by another one
+	for (const auto& [point, size] : kept)
+		EXPECT_NEAR(EvaluateBruteForce(kept, point.data()), std::min(size, MaxSize), 1e-12);
+
+	const double minSize = std::ranges::min(sources, {}, &MGTMesh_SizeField::Source::size).size;
+	EXPECT_DOUBLE_EQ(field.GetMinSize(), minSize);
+}
+
+TEST(SizeFieldLimitTest, SizesAreLimitedByMaxSize) {
+	MGTMesh_SizeField field(GrowthRate, MaxSize);
+	const double source[3] = { 0.0, 0.0, 0.0 };
+	field.AddSource(source, 0.5);
+	field.Build();
+
+	const double near[3] = { 1.0, 0.0, 0.0 };
+	const double far[3] = { 100.0, 0.0, 0.0 };
+	EXPECT_DOUBLE_EQ(field.Evaluate(source), 0.5);
+	EXPECT_NEAR(field.Evaluate(near), 0.5 + GrowthRate, 1e-12);
+	EXPECT_DOUBLE_EQ(field.Evaluate(far), MaxSize);
+}
@@ -27,12 +27,35 @@
 #include "ProgressEvent.hpp"
 #include "MGTMeshUtils_ComputeError.hpp"
 #include "MGTMesh_Algorithm.hpp"
+#include "MGTMesh_Assembly.hpp"
+#include "MGTMesh_AutoSizing.hpp"
 #include "MGTMesh_Generator.hpp"
 #include "MGTMesh_MeshObject.hpp"
+#include "MGTMesh_Partitioner.hpp"
+#include "MGTMesh_Quality.hpp"
+#include "MGTMesh_Refiner.hpp"
+#include "MGTMesh_SizeField.hpp"
+#include "MGTMesh_Smoother.hpp"
 #include "MGTMesh_ProxyMesh.hpp"
+#include "MGTMeshIO_Exporter.hpp"
+#include "MGTMeshIO_Importer.hpp"
+#include "NetgenPlugin_LocalHSnapshot.hpp"
+#include "NetgenPlugin_PreparedGeometry.hpp"
+#include "NetgenPlugin_Remesher.hpp"
+#include "NetgenPlugin_SurfaceProjector.hpp"
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <ranges>
+
+namespace {
+
+// Key of the fused compound in caches of parts, parts are named by their documents
+const std::string AssemblyName = "<assembly>";
+
+}
+
 //----------------------------------------------------------------------------
 Model::Model(std::string modelName)
 	: _modelName(modelName)
@@ -58,6 +81,17 @@ void Model::addShapesToModel(const GeometryCore::PartsMap& shapesMap) {
 		// gmsh::model::occ::importShapesNativePointer(shape_ptr, outDimTags);
 	}
 	// gmsh::model::occ::synchronize();
+	this->purgeShapeCaches();
+}
+
+//----------------------------------------------------------------------------
+void Model::purgeShapeCaches() {
+	const auto isRemoved = [this](const auto& entry) {
+		return entry.first != AssemblyName && !_shapesMap.contains(entry.first);
+	};
+	std::erase_if(_preparedGeometries, isRemoved);
+	std::erase_if(_autoSizings, isRemoved);
+	std::erase_if(_localHSnapshots, isRemoved);
 }
 
 //----------------------------------------------------------------------------
@@ -74,35 +108,391 @@ void Model::importSTEP(const std::string& filePath) {
 }
 
 //----------------------------------------------------------------------------
-bool Model::generateMesh(const MGTMesh_Algorithm* algorithm) {
-	if (!algorithm)
+void Model::addSizing(const std::vector<TopoDS_Shape>& shapes, const double size) {
+	for (const TopoDS_Shape& shape : shapes)
+		_sizings.emplace_back(shape, size);
+}
+
+//----------------------------------------------------------------------------
+void Model::clearSizings() { _sizings.clear(); }
+
+//----------------------------------------------------------------------------
+const MGTMesh_AutoSizing& Model::getAutoSizing(
+	const std::string& name, const TopoDS_Shape& shape) {
+	std::unique_ptr<MGTMesh_AutoSizing>& autoSizing = _autoSizings[name];
+	if (!autoSizing || !autoSizing->GetShape().IsEqual(shape)) {
+		spdlog::debug("Computing automatic sizing of shape: {}", name);
+		autoSizing = std::make_unique<MGTMesh_AutoSizing>(shape);
+		autoSizing->Compute();
+	}
+	return *autoSizing;
+}
+
+//----------------------------------------------------------------------------
+MGTMesh_Algorithm Model::withSizeField(const MGTMesh_Algorithm& algorithm) {
+	MGTMesh_Algorithm sizedAlgorithm(algorithm);
+	const double nbSegPerRadius = algorithm.surfaceCurvature ? algorithm.nbSegPerRadius : 0.0;
+	const bool isAutoSized = nbSegPerRadius > 0.0 || algorithm.nbSegPerGap > 0.0;
+	if (_sizings.empty() && !isAutoSized)
+		return sizedAlgorithm;
+
+	auto sizeField = std::make_shared<MGTMesh_SizeField>(algorithm.growthRate, algorithm.maxSize);
+	for (const auto& [shape, size] : _sizings)
+		sizeField->AddSizing(shape, size);
+	if (isAutoSized) {
+		for (const auto& [name, shape] : _shapesMap)
+			this->getAutoSizing(name, shape).AddSizings(
+				*sizeField, nbSegPerRadius, algorithm.nbSegPerGap, algorithm.minSize);
+	}
+	sizeField->Build();
+	sizedAlgorithm.sizeField = std::move(sizeField);
+	// Curvature is already in the size field, meshers must not restrict sizes by it again
+	if (nbSegPerRadius > 0.0)
+		sizedAlgorithm.surfaceCurvature = false;
+	return sizedAlgorithm;
+}
+
+//----------------------------------------------------------------------------
+bool Model::generateMesh(const MGTMesh_Algorithm* inputAlgorithm) {
+	if (!inputAlgorithm)
 		return false;
 
+	const MGTMesh_Algorithm sizedAlgorithm = this->withSizeField(*inputAlgorithm);
+	const MGTMesh_Algorithm* algorithm = &sizedAlgorithm;
+
 	_meshObjectsMap.clear();
+	_meshShapesMap.clear();
 
 	spdlog::debug(std::format("Mesh algorithm parameters - Engine: {}, type: {}, id: {}",
 		algorithm->GetEngineLib(), algorithm->GetType(), algorithm->GetID()));
 
+	if (algorithm->sharedTopology && _shapesMap.size() > 1)
+		return this->generateAssemblyMesh(*algorithm);
+
+	int shapeKey = 0;
 	for (const auto& [fst, snd] : _shapesMap) {
 		spdlog::debug("Creating mesh generator for shape: {}", fst);
 
 		vtkSmartPointer<MGTMesh_MeshObject> meshObject = vtkSmartPointer<MGTMesh_MeshObject>::New();
 		MGTMesh_Generator meshGenerator(snd, *algorithm, meshObject);
+		if (algorithm->GetEngineLib() == MGTMesh_Scheme::Engine::NETGEN)
+			meshGenerator.SetPreparedGeometry(&this->getPreparedGeometry(fst, snd));
+		meshGenerator.SetLocalHSnapshots(&_localHSnapshots[fst]);
 		if (const int result = meshGenerator.Compute();
 			result != MGTMeshUtils_ComputeErrorName::COMPERR_OK) {
 			SPDLOG_ERROR("Error while generating mesh for shape: {}", fst);
 			return false;
 		}
 
-		_meshObjectsMap[algorithm->GetID()] = meshGenerator.GetOutputMesh();
+		_meshObjectsMap[shapeKey] = meshGenerator.GetOutputMesh();
+		_meshShapesMap[shapeKey++] = snd;
+	}
+	this->updateProxyMesh();
+	return true;
+}
+
+//----------------------------------------------------------------------------
+bool Model::generateAssemblyMesh(const MGTMesh_Algorithm& algorithm) {
+	if (!_assembly)
+		_assembly = std::make_unique<MGTMesh_Assembly>(_shapesMap);
+	if (!_assembly->Update(_shapesMap))
+		return false;
+
+	const TopoDS_Shape& shape = _assembly->GetShape();
+	spdlog::debug("Creating mesh generator for {} fused parts", _shapesMap.size());
+
+	vtkSmartPointer<MGTMesh_MeshObject> meshObject = vtkSmartPointer<MGTMesh_MeshObject>::New();
+	MGTMesh_Generator meshGenerator(shape, algorithm, meshObject);
+	if (algorithm.GetEngineLib() == MGTMesh_Scheme::Engine::NETGEN)
+		meshGenerator.SetPreparedGeometry(&this->getPreparedGeometry(AssemblyName, shape));
+	meshGenerator.SetLocalHSnapshots(&_localHSnapshots[AssemblyName]);
+	if (const int result = meshGenerator.Compute();
+		result != MGTMeshUtils_ComputeErrorName::COMPERR_OK) {
+		SPDLOG_ERROR("Error while generating mesh for fused parts");
+		return false;
+	}
+
+	// Tags of elements refer to the fused compound, which is kept for projections
+	const std::vector<vtkSmartPointer<MGTMesh_MeshObject>> partMeshes
+		= _assembly->SplitMesh(meshGenerator.GetOutputMesh());
+	for (int i = 0; i < static_cast<int>(partMeshes.size()); ++i) {
+		_meshObjectsMap[i] = partMeshes[i];
+		_meshShapesMap[i] = shape;
+	}
+	this->updateProxyMesh();
+	return !partMeshes.empty();
+}
+
+//----------------------------------------------------------------------------
+void Model::updateProxyMesh() {
+	// Parts split from the fused assembly mesh are all tagged on the fused compound
+	const bool isTaggedOnSameShape = _meshShapesMap.size() == _meshObjectsMap.size()
+		&& std::ranges::all_of(_meshShapesMap | std::views::values,
+			[this](const TopoDS_Shape& shape) {
+				return shape.IsSame(_meshShapesMap.begin()->second);
+			});
+	_proxyMesh = std::make_shared<MGTMesh_ProxyMesh>(_meshObjectsMap,
+		MGTMesh_ProxyMesh::MergeMode::Weld,
+		isTaggedOnSameShape ? MGTMesh_ProxyMesh::TagMode::Shared
+							: MGTMesh_ProxyMesh::TagMode::Offset);
+}
+
+//----------------------------------------------------------------------------
+bool Model::generateMeshFamily(const std::vector<const MGTMesh_Algorithm*>& inputAlgorithms) {
+	if (inputAlgorithms.empty() || std::ranges::contains(inputAlgorithms, nullptr))
+		return false;
+
+	// Members are selected by algorithm ID, meshes of the same ID would overwrite each other
+	std::vector<int> ids;
+	for (const MGTMesh_Algorithm* algorithm : inputAlgorithms)
+		ids.push_back(algorithm->GetID());
+	std::ranges::sort(ids);
+	if (const auto duplicate = std::ranges::adjacent_find(ids); duplicate != ids.end()) {
+		SPDLOG_ERROR("Algorithm ID {} is used by more than one family member", *duplicate);
+		return false;
+	}
+
+	_meshFamily.clear();
+	_meshFamilyShapes.clear();
+
+	std::vector<MGTMesh_Algorithm> sizedAlgorithms;
+	for (const MGTMesh_Algorithm* algorithm : inputAlgorithms)
+		sizedAlgorithms.push_back(this->withSizeField(*algorithm));
+	std::vector<const MGTMesh_Algorithm*> algorithms;
+	for (const MGTMesh_Algorithm& algorithm : sizedAlgorithms)
+		algorithms.push_back(&algorithm);
+
+	bool succeeded = true;
+	int shapeKey = 0;
+	for (const auto& [name, shape] : _shapesMap) {
+		spdlog::debug("Creating family of {} meshes for shape: {}", algorithms.size(), name);
+
+		std::vector<vtkSmartPointer<MGTMesh_MeshObject>> meshObjects;
+		for (std::size_t i = 0; i < algorithms.size(); ++i)
+			meshObjects.push_back(vtkSmartPointer<MGTMesh_MeshObject>::New());
+
+		NetgenPlugin_PreparedGeometry& geometry = this->getPreparedGeometry(name, shape);
+		const std::vector<int> results = MGTMesh_Generator::ComputeFamily(shape, algorithms,
+			std::vector<MGTMesh_MeshObject*>(meshObjects.begin(), meshObjects.end()),
+			&geometry, &_localHSnapshots[name]);
+		for (std::size_t i = 0; i < algorithms.size(); ++i) {
+			if (results[i] != MGTMeshUtils_ComputeErrorName::COMPERR_OK) {
+				SPDLOG_ERROR("Error while generating mesh {} for shape: {}",
+					algorithms[i]->GetID(), name);
+				succeeded = false;
+				continue;
+			}
+			_meshFamily[algorithms[i]->GetID()][shapeKey] = meshObjects[i];
+		}
+		_meshFamilyShapes[shapeKey++] = shape;
+	}
+
+	if (_meshFamily.contains(algorithms.front()->GetID()))
+		this->setCurrentFamilyMesh(algorithms.front()->GetID());
+	return succeeded;
+}
+
+//----------------------------------------------------------------------------
+bool Model::setCurrentFamilyMesh(const int algorithmId) {
+	const auto member = _meshFamily.find(algorithmId);
+	if (member == _meshFamily.end()) {
+		SPDLOG_WARN("There is no family mesh generated by algorithm {}", algorithmId);
+		return false;
 	}
-	_proxyMesh = std::make_shared<MGTMesh_ProxyMesh>(_meshObjectsMap);
+
+	_meshObjectsMap = member->second;
+	_meshShapesMap.clear();
+	for (const int key : _meshObjectsMap | std::views::keys)
+		_meshShapesMap[key] = _meshFamilyShapes.at(key);
+	this->updateProxyMesh();
 	return true;
 }
 
+//----------------------------------------------------------------------------
+std::vector<int> Model::getMeshFamilyIds() const {
+	std::vector<int> ids;
+	for (const int id : _meshFamily | std::views::keys)
+		ids.push_back(id);
+	return ids;
+}
+
 //----------------------------------------------------------------------------
 MGTMesh_ProxyMesh* Model::getProxyMesh() const { return _proxyMesh.get(); }
 
+//----------------------------------------------------------------------------
+bool Model::importMesh(const std::string& filePath) {
+	vtkSmartPointer<MGTMesh_MeshObject> meshObject = MGTMeshIO_Importer::Import(filePath);
+	if (!meshObject)
+		return false;
+
+	// Imported mesh is added next to already existing ones
+	int meshId = 0;
+	while (_meshObjectsMap.contains(meshId))
+		++meshId;
+
+	_meshObjectsMap[meshId] = meshObject;
+	this->updateProxyMesh();
+	spdlog::debug("Mesh imported as mesh object {}: {}", meshId, filePath);
+	return true;
+}
+
+//----------------------------------------------------------------------------
+bool Model::exportMesh(const std::string& filePath) const {
+	if (_meshObjectsMap.empty()) {
+		SPDLOG_WARN("There is no mesh to export");
+		return false;
+	}
+
+	const MGTMeshIO_Exporter exporter(_meshObjectsMap);
+	return exporter.Export(filePath);
+}
+
+//----------------------------------------------------------------------------
+bool Model::partitionMesh(const int partsNb) {
+	if (_meshObjectsMap.empty()) {
+		SPDLOG_WARN("There is no mesh to partition");
+		return false;
+	}
+
+	bool succeeded = true;
+	for (const auto& [id, meshObject] : _meshObjectsMap) {
+		spdlog::debug("Partitioning mesh object {} into {} parts", id, partsNb);
+		succeeded = MGTMesh_Partitioner::Partition(meshObject, partsNb) && succeeded;
+	}
+	return succeeded;
+}
+
+//----------------------------------------------------------------------------
+bool Model::checkMeshQuality() {
+	if (_meshObjectsMap.empty()) {
+		SPDLOG_WARN("There is no mesh to check");
+		return false;
+	}
+
+	const auto logReport = [](const int id, const std::string& block,
+							   const std::string& metric, const MGTMesh_Quality::Report& report) {
+		if (report.elementsNb == 0)
+			return;
+
+		SPDLOG_INFO("Mesh object {} {} elements, {}: min {:.4g}, mean {:.4g}, max {:.4g}", id,
+			block, metric, report.min, report.mean, report.max);
+		const MGTMesh_Quality::Histogram& histogram = report.histogram;
+		const double binWidth = (histogram.max - histogram.min)
+			/ static_cast<double>(std::max<std::size_t>(histogram.counts.size(), 1));
+		for (std::size_t bin = 0; bin < histogram.counts.size(); ++bin) {
+			spdlog::info("    [{:.4g}, {:.4g}]: {}", histogram.min + bin * binWidth,
+				histogram.min + (bin + 1) * binWidth, histogram.counts[bin]);
+		}
+		for (const auto& [elementId, value] : report.worstElements)
+			spdlog::info("    element {}: {:.4g}", elementId, value);
+	};
+
+	using Metric = MGTMesh_Quality::Metric;
+	for (const auto& [id, meshObject] : _meshObjectsMap) {
+		for (const Metric metric : { Metric::AspectRatio, Metric::ScaledJacobian,
+				 Metric::MinDihedralAngle, Metric::MaxDihedralAngle, Metric::Skewness }) {
+			MGTMesh_Quality quality(metric);
+			if (!quality.Evaluate(meshObject))
+				break;
+
+			const std::string metricName = MGTMesh_Quality::GetMetricName(metric);
+			logReport(id, "volume", metricName, quality.GetInternalReport());
+			logReport(id, "surface", metricName, quality.GetBoundaryReport());
+		}
+	}
+	return true;
+}
+
+//----------------------------------------------------------------------------
+bool Model::repairMesh(const double minDihedralAngle) {
+	if (_meshObjectsMap.empty()) {
+		SPDLOG_WARN("There is no mesh to repair");
+		return false;
+	}
+
+	bool succeeded = true;
+	for (const auto& [id, meshObject] : _meshObjectsMap) {
+		spdlog::debug("Re-meshing elements of mesh object {} with dihedral angles below {}", id,
+			minDihedralAngle);
+		NetgenPlugin_Remesher remesher(
+			meshObject, MGTMesh_Quality::Metric::MinDihedralAngle, minDihedralAngle);
+		succeeded = remesher.Compute() == MGTMeshUtils_ComputeErrorName::COMPERR_OK && succeeded;
+	}
+	this->updateProxyMesh();
+	return succeeded;
+}
+
+//----------------------------------------------------------------------------
+bool Model::smoothMesh(const double targetQuality) {
+	if (_meshObjectsMap.empty()) {
+		SPDLOG_WARN("There is no mesh to smooth");
+		return false;
+	}
+
+	bool succeeded = true;
+	for (const auto& [id, meshObject] : _meshObjectsMap) {
+		MGTMesh_Smoother smoother(MGTMesh_Smoother::Method::Smart);
+		smoother.SetTargetQuality(targetQuality);
+		smoother.SetProjection(this->createProjection(id));
+
+		spdlog::debug("Smoothing mesh object {} to mean ratio {}", id, targetQuality);
+		succeeded = smoother.Smooth(meshObject) && succeeded;
+	}
+	this->updateProxyMesh();
+	return succeeded;
+}
+
+//----------------------------------------------------------------------------
+bool Model::refineMesh() {
+	if (_meshObjectsMap.empty()) {
+		SPDLOG_WARN("There is no mesh to refine");
+		return false;
+	}
+
+	bool succeeded = true;
+	for (const auto& [id, meshObject] : _meshObjectsMap) {
+		spdlog::debug("Refining mesh object {}", id);
+		MGTMesh_Refiner refiner;
+		refiner.SetProjection(this->createProjection(id));
+		succeeded = refiner.Refine(meshObject) && succeeded;
+	}
+	this->updateProxyMesh();
+	return succeeded;
+}
+
+//----------------------------------------------------------------------------
+NetgenPlugin_PreparedGeometry& Model::getPreparedGeometry(
+	const std::string& name, const TopoDS_Shape& shape) {
+	std::unique_ptr<NetgenPlugin_PreparedGeometry>& geometry = _preparedGeometries[name];
+	if (!geometry || !geometry->GetShape().IsEqual(shape)) {
+		spdlog::debug("Preparing Netgen geometry of shape: {}", name);
+		geometry = std::make_unique<NetgenPlugin_PreparedGeometry>(shape);
+		_localHSnapshots.erase(name);
+	}
+	return *geometry;
+}
+
+//----------------------------------------------------------------------------
+std::function<bool(int, double[3])> Model::createProjection(const int meshId) {
+	const auto shape = _meshShapesMap.find(meshId);
+	if (shape == _meshShapesMap.end())
+		return {};
+
+	// Prepared geometry of the part already has face map the mesh was tagged with
+	std::shared_ptr<const NetgenPlugin_SurfaceProjector> projector;
+	for (const auto& geometry : _preparedGeometries | std::views::values) {
+		if (geometry->GetShape().IsEqual(shape->second)) {
+			projector = geometry->GetSurfaceProjector();
+			break;
+		}
+	}
+	if (!projector)
+		projector = std::make_shared<NetgenPlugin_SurfaceProjector>(shape->second);
+	return [projector](const int faceId, double point[3]) {
+		return projector->Project(faceId, point);
+	};
+}
+
 void Model::addObserver(std::shared_ptr<EventObserver> aObserver){
     subject.attachObserver(aObserver);
 }
\ No newline at end of file
@@ -28,6 +28,8 @@
 
 #include "DocumentHandler.hpp"
 #include "ModelSubject.hpp"
+#include <functional>
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -37,8 +39,12 @@ class EventObserver;
 #include <unordered_map>
 
 class MGTMesh_Algorithm;
+class MGTMesh_Assembly;
+class MGTMesh_AutoSizing;
 class MGTMesh_MeshObject;
 class MGTMesh_ProxyMesh;
+class NetgenPlugin_LocalHSnapshot;
+class NetgenPlugin_PreparedGeometry;
 
 class Model {
 public:
@@ -60,17 +66,75 @@ public:
 	void importSTL(const std::string& filePath);
 
 	//--------Meshing interface-----//
+	// Element size on shapes, applied to meshes generated afterwards
+	void addSizing(const std::vector<TopoDS_Shape>& shapes, double size);
+	void clearSizings();
 	bool generateMesh(const MGTMesh_Algorithm* algorithm);
+	// Meshes all shapes with each algorithm, e.g. at several finenesses for convergence
+	// studies. Shapes are prepared once for all meshes, which are kept side by side and
+	// the one of the first algorithm becomes the current mesh. Algorithm IDs must be unique.
+	bool generateMeshFamily(const std::vector<const MGTMesh_Algorithm*>& algorithms);
+	// Makes meshes generated by family algorithm with given ID the current mesh
+	bool setCurrentFamilyMesh(int algorithmId);
+	std::vector<int> getMeshFamilyIds() const;
 	MGTMesh_ProxyMesh* getProxyMesh() const;
+	bool importMesh(const std::string& filePath);
+	bool exportMesh(const std::string& filePath) const;
+	bool partitionMesh(int partsNb);
+	bool checkMeshQuality();
+	bool repairMesh(double minDihedralAngle);
+	bool smoothMesh(double targetQuality);
+	bool refineMesh();
 
 private:
 	void addShapesToModel(const GeometryCore::PartsMap& shapesMap);
 
+	// Drops prepared geometries, automatic sizings and local size snapshots of parts that
+	// are no longer in the model
+	void purgeShapeCaches();
+
+	// Projection onto faces of the shape mesh object was generated from, empty for
+	// imported meshes
+	std::function<bool(int, double[3])> createProjection(int meshId);
+
+	// Netgen geometry of the part prepared by previous meshing, or a new one if the part
+	// was not meshed yet or its shape changed
+	NetgenPlugin_PreparedGeometry& getPreparedGeometry(
+		const std::string& name, const TopoDS_Shape& shape);
+
+	// Meshes all parts fused into one compound and splits the mesh back into parts
+	bool generateAssemblyMesh(const MGTMesh_Algorithm& algorithm);
+
+	// Welds mesh objects into the displayed proxy mesh
+	void updateProxyMesh();
+
+	// Curvature and proximity of the part computed by previous meshing, or computed
+	// again if the part was not meshed yet or its shape changed
+	const MGTMesh_AutoSizing& getAutoSizing(const std::string& name, const TopoDS_Shape& shape);
+
+	// Copy of the algorithm with size field of sizings and automatic sizings built for
+	// its growth rate and maximal size
+	MGTMesh_Algorithm withSizeField(const MGTMesh_Algorithm& algorithm);
+
 private:
 	GeometryCore::PartsMap _shapesMap;
 
 	std::unordered_map<int, vtkSmartPointer<MGTMesh_MeshObject>>
 		_meshObjectsMap;
+	// Shapes the mesh objects were generated from, used to project smoothed nodes
+	std::unordered_map<int, TopoDS_Shape> _meshShapesMap;
+	std::vector<std::pair<TopoDS_Shape, double>> _sizings;
+	// Mesh objects of family members by algorithm ID, keyed as the shapes they were
+	// generated from
+	std::map<int, std::unordered_map<int, vtkSmartPointer<MGTMesh_MeshObject>>> _meshFamily;
+	std::unordered_map<int, TopoDS_Shape> _meshFamilyShapes;
+	// Local size functions of shapes by name, kept to skip geometry analysis when
+	// shapes are meshed again
+	std::map<std::string, std::vector<NetgenPlugin_LocalHSnapshot>> _localHSnapshots;
+	std::map<std::string, std::unique_ptr<NetgenPlugin_PreparedGeometry>> _preparedGeometries;
+	std::map<std::string, std::unique_ptr<MGTMesh_AutoSizing>> _autoSizings;
+	// Parts fused by previous meshing with shared topology
+	std::unique_ptr<MGTMesh_Assembly> _assembly;
 	std::shared_ptr<MGTMesh_ProxyMesh> _proxyMesh;
 };
 
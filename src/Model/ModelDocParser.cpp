@@ -22,6 +22,7 @@
 #include "DocUtils.hpp"
 
 #include "MGTMesh_Algorithm.hpp"
+#include "NetgenPlugin_Parameters.hpp"
 
 ModelDocParser::ModelDocParser(Model& aModel)
 	: _model(aModel)
@@ -30,14 +31,15 @@ ModelDocParser::ModelDocParser(Model& aModel)
 void ModelDocParser::applyElementSizings() {
 	QList<QDomElement> sizingElements
 		= _doc.getSubElements(ItemTypes::Mesh::ElementSizing);
+	_model.clearSizings();
 	for (auto sizingElem : sizingElements) {
-		std::pair<std::vector<int>, double> sizing
+		std::pair<std::vector<TopoDS_Shape>, double> sizing
 			= parseElementSizing(sizingElem);
-		// _model.addSizing(sizing.first, sizing.second);
+		_model.addSizing(sizing.first, sizing.second);
 	}
 }
 
-std::pair<std::vector<int>, double> ModelDocParser::parseElementSizing(
+std::pair<std::vector<TopoDS_Shape>, double> ModelDocParser::parseElementSizing(
 	const QDomElement& aSizingElement) {
 	// TODO: All those error checks should be in propertyValue - here they are
 	// redundant and clutter the code
@@ -67,7 +69,7 @@ std::pair<std::vector<int>, double> ModelDocParser::parseElementSizing(
 				   << aSizingElement.attribute("name") << " skipping...";
 	}
 	double size = sizeString.toDouble();
-	std::vector<int> verticesTags;
+	std::vector<TopoDS_Shape> shapes;
 	GeometryCore::EntityType selectionType = GeometryCore::EntityType::Vertex;
 	if (shapeTypeString == "Vertex") {
 		selectionType = GeometryCore::EntityType::Vertex;
@@ -84,14 +86,15 @@ std::pair<std::vector<int>, double> ModelDocParser::parseElementSizing(
 	QStringList tagsList = tagsString.split(',', Qt::SkipEmptyParts);
 	for (const QString& tagString : tagsList) {
 		int shapeTag = tagString.toInt();
-		const TopoDS_Shape& shape
-			= _model.geometry.getTagMap().getShape(selectionType, shapeTag);
-		std::vector<int> shapeVerticesTags
-			= _model.geometry.getShapeVerticesTags(shape);
-		verticesTags.insert(verticesTags.end(), shapeVerticesTags.begin(),
-			shapeVerticesTags.end());
+		try {
+			shapes.push_back(
+				_model.geometry.getTagMap().getShape(selectionType, shapeTag));
+		} catch (const char* error) {
+			qWarning() << error << " Tag " << shapeTag << " in "
+					   << aSizingElement.attribute("name") << " skipping...";
+		}
 	}
-	return std::pair<std::vector<int>, double>(verticesTags, size);
+	return std::pair<std::vector<TopoDS_Shape>, double>(shapes, size);
 }
 
 void ModelDocParser::applyMeshSettings() {
@@ -134,8 +137,19 @@ std::unique_ptr<MGTMesh_Algorithm> ModelDocParser::generateMeshAlgorithm(
 	auto algorithm = std::make_unique<MGTMesh_Algorithm>(schemeId);
 	algorithm->SetSchemeName(propMap.value("algName").toStdString());
 
+	// Optimizer settings are missing in documents saved by older versions
+	algorithm->nbSurfOptSteps = NetgenPlugin_Parameters::GetDefaultNbSurfOptSteps();
+	algorithm->nbVolOptSteps = NetgenPlugin_Parameters::GetDefaultNbVolOptSteps();
+	algorithm->elemSizeWeight = NetgenPlugin_Parameters::GetDefaultElemSizeWeight();
+	algorithm->worstElemMeasure = NetgenPlugin_Parameters::GetDefaultWorstElemMeasure();
+
 	const std::unordered_map<QString, std::function<void(const QString&)>>
 		setters = {
+			{ "meshEngine",
+				[&](const QString& v) {
+					algorithm->SetEngineLib(
+						static_cast<MGTMesh_Scheme::Engine>(v.toInt()));
+				} },
 			{ "elementsOrder",
 				[&](const QString& v) {
 					algorithm->secondOrder = v.toInt() != 0;
@@ -170,10 +184,42 @@ std::unique_ptr<MGTMesh_Algorithm> ModelDocParser::generateMeshAlgorithm(
 				[&](const QString& v) {
 					algorithm->nbSegPerEdge = v.toDouble();
 				} },
+			{ "nbPerGap",
+				[&](const QString& v) {
+					algorithm->nbSegPerGap = v.toDouble();
+				} },
 			{ "optimizeMesh",
 				[&](const QString& v) {
 					algorithm->optimize = v.toInt() != 0;
 				} },
+			{ "nbSurfOptSteps",
+				[&](const QString& v) {
+					algorithm->nbSurfOptSteps = v.toInt();
+				} },
+			{ "nbVolOptSteps",
+				[&](const QString& v) {
+					algorithm->nbVolOptSteps = v.toInt();
+				} },
+			{ "elemSizeWeight",
+				[&](const QString& v) {
+					algorithm->elemSizeWeight = v.toDouble();
+				} },
+			{ "worstElemMeasure",
+				[&](const QString& v) {
+					algorithm->worstElemMeasure = v.toInt();
+				} },
+			{ "renumberMesh",
+				[&](const QString& v) {
+					algorithm->renumber = v.toInt() != 0;
+				} },
+			{ "sharedTopology",
+				[&](const QString& v) {
+					algorithm->sharedTopology = v.toInt() != 0;
+				} },
+			{ "sweepMesh",
+				[&](const QString& v) {
+					algorithm->sweep = v.toInt() != 0;
+				} },
 		};
 
 	for (auto it = propMap.constBegin(); it != propMap.constEnd(); ++it) {
@@ -34,7 +34,8 @@ public:
 	void applyMeshSettings();
 	void applyElementSizings();
 
-	std::pair<std::vector<int>, double> parseElementSizing(
+	// Shapes selected by sizing item and element size on them
+	std::pair<std::vector<TopoDS_Shape>, double> parseElementSizing(
 		const QDomElement& aSizingElement);
 	std::unique_ptr<MGTMesh_Algorithm> generateMeshAlgorithm(
 		bool surfaceMesh = false) const;
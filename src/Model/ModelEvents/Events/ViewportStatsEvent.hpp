@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIEWPORTSTATSEVENT_HPP
+#define VIEWPORTSTATSEVENT_HPP
+
+#include "Event.hpp"
+#include "EventObserver.hpp"
+
+#include <cstdint>
+
+/**
+ * Statistics of a single frame rendered in the viewport. Published after every render
+ * so that viewport benchmarks can record them.
+ */
+class ViewportStatsEvent : public Event {
+
+    public:
+    double frameTime = 0.0;        // [ms] duration of this frame
+    double averageFrameTime = 0.0; // [ms] rolling average over last frames
+    double pickTime = 0.0;         // [ms] duration of the last pick on mouse move
+    int actorsNb = 0;              // visible actors
+    int pipelinesNb = 0;           // shape selection pipelines
+    std::int64_t trianglesNb = 0;
+    std::int64_t linesNb = 0;
+    std::int64_t pointsNb = 0;
+    std::uint64_t requestedRenders = 0;
+    std::uint64_t executedRenders = 0;
+
+    void accept(EventObserver& aEventObserver) const override {
+        aEventObserver.visit(*this);
+    }
+
+};
+
+#endif
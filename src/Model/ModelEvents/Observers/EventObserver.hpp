@@ -23,6 +23,7 @@
 #include "Event.hpp"
 
 class ProgressEvent;
+class ViewportStatsEvent;
 class EventObserver {
    public:
 
@@ -35,6 +36,9 @@ class EventObserver {
 
    virtual void visit(const ProgressEvent& aModelEvent) = 0;
 
+   // Instrumentation events are ignored unless observer is interested in them
+   virtual void visit(const ViewportStatsEvent&) {};
+
 };
 
 
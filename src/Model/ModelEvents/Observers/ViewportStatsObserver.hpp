@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIEWPORTSTATSOBSERVER_HPP
+#define VIEWPORTSTATSOBSERVER_HPP
+
+#include <functional>
+#include "EventObserver.hpp"
+
+class ViewportStatsObserver : public EventObserver {
+
+    using ViewportStatsCallback = std::function<void(const ViewportStatsEvent&)>;
+
+    public:
+
+    void setViewportStatsCallback(ViewportStatsCallback aViewportStatsCallback);
+
+    private:
+
+    void visit(const ProgressEvent&) override {};
+    void visit(const ViewportStatsEvent&) override;
+    ViewportStatsCallback _viewportStatsCallback = [](const ViewportStatsEvent&) {};
+};
+
+#endif
@@ -19,7 +19,13 @@
 
 #include "ModelDataView.hpp"
 
+#include "MGTMesh_MeshObject.hpp"
 #include "MGTMesh_ProxyMesh.hpp"
+#include "MGTMesh_SectionView.hpp"
+
+#include <vtkCellTypes.h>
+#include <vtkUnsignedCharArray.h>
+#include <vtkUnstructuredGrid.h>
 
 using ShapeRef = std::reference_wrapper<const TopoDS_Shape>;
 
@@ -95,3 +101,38 @@ vtkSmartPointer<vtkActor> ModelDataView::getMeshActor() const {
 	const Model& model = _modelManager.getModel();
 	return model.getProxyMesh()->GetProxyMeshActor();
 }
+
+//----------------------------------------------------------------------------
+vtkMTimeType ModelDataView::getMeshMTime() const {
+	const Model& model = _modelManager.getModel();
+	const MGTMesh_ProxyMesh* proxyMesh = model.getProxyMesh();
+	return proxyMesh ? proxyMesh->GetMTime() : 0;
+}
+
+//----------------------------------------------------------------------------
+std::unique_ptr<MGTMesh_SectionView> ModelDataView::createMeshSectionView() const {
+	const Model& model = _modelManager.getModel();
+	const MGTMesh_ProxyMesh* proxyMesh = model.getProxyMesh();
+	return proxyMesh ? proxyMesh->CreateSectionView() : nullptr;
+}
+
+//----------------------------------------------------------------------------
+bool ModelDataView::hasVolumeMesh() const {
+	const Model& model = _modelManager.getModel();
+	const MGTMesh_ProxyMesh* proxyMesh = model.getProxyMesh();
+	const MGTMesh_MeshObject* meshObject = proxyMesh ? proxyMesh->GetMeshObject() : nullptr;
+	const vtkSmartPointer<vtkUnstructuredGrid> internalMesh
+		= meshObject ? meshObject->GetInternalMesh() : nullptr;
+	if (!internalMesh)
+		return false;
+
+	vtkUnsignedCharArray* cellTypes = internalMesh->GetCellTypesArray();
+	if (!cellTypes)
+		return false;
+
+	for (vtkIdType cellId = 0; cellId < cellTypes->GetNumberOfValues(); ++cellId) {
+		if (vtkCellTypes::GetDimension(cellTypes->GetValue(cellId)) == 3)
+			return true;
+	}
+	return false;
+}
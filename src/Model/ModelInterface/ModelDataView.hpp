@@ -22,6 +22,12 @@
 
 #include "ModelManager.hpp"
 
+#include <vtkType.h>
+
+#include <memory>
+
+class MGTMesh_SectionView;
+
 class ModelDataView {
 
 public:
@@ -48,6 +54,22 @@ public:
 
 	[[nodiscard]] vtkSmartPointer<vtkActor> getMeshActor() const;
 
+	/**
+	 * @brief Modification time of current mesh, 0 if no mesh was generated. Allows renderer to
+	 * tell whether its mesh actor is out of date without rebuilding it.
+	 */
+	[[nodiscard]] vtkMTimeType getMeshMTime() const;
+
+	/**
+	 * @brief Creates section view of current mesh, nullptr if no mesh was generated.
+	 */
+	[[nodiscard]] std::unique_ptr<MGTMesh_SectionView> createMeshSectionView() const;
+
+	/**
+	 * @brief Whether current mesh has volume cells, section view is meaningful only then.
+	 */
+	[[nodiscard]] bool hasVolumeMesh() const;
+
 private:
 	const ModelManager& _modelManager;
 };
@@ -62,13 +62,56 @@ bool ModelInterface::generateMesh(bool surfaceMesh) {
 			surfaceMesh));
 
 	Model& model = _modelManager.getModel();
-	const ModelDocParser modelDocument(model);
+	ModelDocParser modelDocument(model);
+	modelDocument.applyElementSizings();
 	const std::unique_ptr<MGTMesh_Algorithm> algorithm
 		= modelDocument.generateMeshAlgorithm(surfaceMesh);
 
 	return model.generateMesh(algorithm.get());
 }
 
+//----------------------------------------------------------------------------
+bool ModelInterface::importMesh(const QString& aFilePath) {
+	Model& model = _modelManager.getModel();
+	return model.importMesh(aFilePath.toStdString());
+}
+
+//----------------------------------------------------------------------------
+bool ModelInterface::exportMesh(const QString& aFilePath) {
+	const Model& model = _modelManager.getModel();
+	return model.exportMesh(aFilePath.toStdString());
+}
+
+//----------------------------------------------------------------------------
+bool ModelInterface::partitionMesh(const int aPartsNb) {
+	Model& model = _modelManager.getModel();
+	return model.partitionMesh(aPartsNb);
+}
+
+//----------------------------------------------------------------------------
+bool ModelInterface::checkMeshQuality() {
+	Model& model = _modelManager.getModel();
+	return model.checkMeshQuality();
+}
+
+//----------------------------------------------------------------------------
+bool ModelInterface::repairMesh(const double aMinDihedralAngle) {
+	Model& model = _modelManager.getModel();
+	return model.repairMesh(aMinDihedralAngle);
+}
+
+//----------------------------------------------------------------------------
+bool ModelInterface::smoothMesh(const double aTargetQuality) {
+	Model& model = _modelManager.getModel();
+	return model.smoothMesh(aTargetQuality);
+}
+
+//----------------------------------------------------------------------------
+bool ModelInterface::refineMesh() {
+	Model& model = _modelManager.getModel();
+	return model.refineMesh();
+}
+
 void ModelInterface::addObserver(std::shared_ptr<EventObserver> aObserver){
     Model& model = _modelManager.getModel();
     model.addObserver(aObserver);
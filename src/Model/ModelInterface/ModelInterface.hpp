@@ -43,6 +43,13 @@ public:
         int importSTL(const QString& aFilePath);
 
 	bool generateMesh(bool surfaceMesh = false);
+	bool importMesh(const QString& aFilePath);
+	bool exportMesh(const QString& aFilePath);
+	bool partitionMesh(int aPartsNb);
+	bool checkMeshQuality();
+	bool repairMesh(double aMinDihedralAngle);
+	bool smoothMesh(double aTargetQuality);
+	bool refineMesh();
 
 	const ModelDataView& modelDataView() { return _modelDataView; };
 
@@ -27,6 +27,8 @@
 #include "ProgressObserver.hpp"
 // #include "ProgressBarPlugin.hpp"
 
+#include <QSignalBlocker>
+
 //----------------------------------------------------------------------------
 MainWindow::MainWindow(
 	std::shared_ptr<ModelInterface> aModelInterface, QWidget* parent)
@@ -111,6 +113,25 @@ void MainWindow::connectActionsToModel() {
 	connect(ui->actionImportSTL, &QAction::triggered,
 		_modelHandler->_geometryHandler, &GeometryActionsHandler::importSTL);
 
+	connect(ui->actionImportMesh, &QAction::triggered,
+		_modelHandler->_meshHandler, &MeshActionsHandler::importMesh);
+
+	connect(ui->actionExportMesh, &QAction::triggered,
+		_modelHandler->_meshHandler, &MeshActionsHandler::exportMesh);
+
+	connect(ui->actionPartitionMesh, &QAction::triggered,
+		_modelHandler->_meshHandler, &MeshActionsHandler::partitionMesh);
+
+	connect(ui->actionCheckMeshQuality, &QAction::triggered,
+		_modelHandler->_meshHandler, &MeshActionsHandler::checkMeshQuality);
+
+	connect(ui->actionRepairMesh, &QAction::triggered,
+		_modelHandler->_meshHandler, &MeshActionsHandler::repairMesh);
+	connect(ui->actionSmoothMesh, &QAction::triggered,
+		_modelHandler->_meshHandler, &MeshActionsHandler::smoothMesh);
+	connect(ui->actionRefineMesh, &QAction::triggered,
+		_modelHandler->_meshHandler, &MeshActionsHandler::refineMesh);
+
 	connect(&this->buttonGroup,
 		QOverload<QAbstractButton*>::of(&QButtonGroup::buttonClicked), this,
 		&MainWindow::handleSelectorButtonClicked);
@@ -133,20 +154,47 @@ void MainWindow::connectModelToRenderWindow(RenderSignalSender* aSignalSender,
 	Rendering::MeshRenderHandler* meshRender = aSignalHandler->mesh();
 
 	QObject::connect(geometrySignals, &GeometrySignalSender::geometryImported,
-		geoRender, &Rendering::GeometryRenderHandler::addAllShapesToRenderer);
+		geoRender, &Rendering::GeometryRenderHandler::syncShapesWithModel);
 
 	QObject::connect(meshSignals, &MeshSignalSender::meshGenerated, meshRender,
 		&Rendering::MeshRenderHandler::showMeshActor);
 
+	// Section can be shown only for volume mesh
+	QObject::connect(meshSignals, &MeshSignalSender::meshGenerated, this, [this]() {
+		ui->actionShowMeshSection->setEnabled(_modelInterface->modelDataView().hasVolumeMesh());
+	});
+
 	QObject::connect(ui->actionShowMesh, &QAction::toggled,
 		[geoRender, meshRender](bool checked) {
 			if (checked) {
 				meshRender->showMeshActor();
 			} else {
+				meshRender->hideMeshActor();
 				geoRender->showExistingShapes();
 			}
 		});
 
+	QObject::connect(ui->actionShowMeshSection, &QAction::toggled,
+		[this, geoRender, meshRender](bool checked) {
+			if (checked) {
+				meshRender->showMeshSection();
+			} else {
+				meshRender->hideMeshSection();
+				if (ui->actionShowMesh->isChecked()) {
+					meshRender->showMeshActor();
+				} else {
+					geoRender->showExistingShapes();
+				}
+			}
+		});
+
+	// Keep action checked state in sync when section is hidden by other views
+	QObject::connect(meshRender, &Rendering::MeshRenderHandler::meshSectionVisibilityChanged,
+		this, [this](bool visible) {
+			const QSignalBlocker blocker(ui->actionShowMeshSection);
+			ui->actionShowMeshSection->setChecked(visible);
+		});
+
 	QObject::connect(geometrySignals,
 		&GeometrySignalSender::requestSelectedShapes, geoRender,
 		&Rendering::GeometryRenderHandler::selectedShapesRequested);
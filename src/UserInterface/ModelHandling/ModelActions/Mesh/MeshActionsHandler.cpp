@@ -25,8 +25,11 @@
 #include "MeshActionsHandler.hpp"
 #include "AddSizingCommand.hpp"
 #include "CommandManager.hpp"
+#include "FileDialogUtils.hpp"
 #include "ModelInterface.hpp"
 
+#include <QInputDialog>
+
 // logging
 #include <spdlog/spdlog.h>
 
@@ -58,6 +61,106 @@ void MeshActionsHandler::generate2DMesh() {
 	}
 }
 
+//----------------------------------------------------------------------------
+void MeshActionsHandler::importMesh() {
+	const QString filePath
+		= FileDialogUtils::getFileSelection("Import Mesh", FileDialogUtils::FilterMeshImport);
+	if (filePath.isEmpty()) {
+		SPDLOG_INFO("Import mesh cancelled");
+		return;
+	}
+
+	if (!_modelInterface->importMesh(filePath)) {
+		SPDLOG_ERROR("Mesh import failed: {}", filePath.toStdString());
+		return;
+	}
+	SPDLOG_INFO("Adding imported mesh to render view");
+	emit _signalSender->meshSignals->meshGenerated();
+}
+
+//----------------------------------------------------------------------------
+void MeshActionsHandler::exportMesh() {
+	const QString filePath
+		= FileDialogUtils::getSaveFileSelection("Export Mesh", FileDialogUtils::FilterMesh);
+	if (filePath.isEmpty()) {
+		SPDLOG_INFO("Export mesh cancelled");
+		return;
+	}
+
+	if (!_modelInterface->exportMesh(filePath)) {
+		SPDLOG_ERROR("Mesh export failed: {}", filePath.toStdString());
+		return;
+	}
+	SPDLOG_INFO("Mesh exported: {}", filePath.toStdString());
+}
+
+//----------------------------------------------------------------------------
+void MeshActionsHandler::partitionMesh() {
+	bool accepted = false;
+	const int partsNb = QInputDialog::getInt(nullptr, "Partition Mesh",
+		"Number of partitions:", 2, 1, 65536, 1, &accepted);
+	if (!accepted) {
+		SPDLOG_INFO("Partition mesh cancelled");
+		return;
+	}
+
+	if (!_modelInterface->partitionMesh(partsNb)) {
+		SPDLOG_ERROR("Mesh partitioning failed");
+		return;
+	}
+	SPDLOG_INFO("Mesh partitioned into {} parts", partsNb);
+}
+
+//----------------------------------------------------------------------------
+void MeshActionsHandler::checkMeshQuality() {
+	SPDLOG_INFO("Mesh quality check triggered");
+	if (!_modelInterface->checkMeshQuality())
+		SPDLOG_ERROR("Mesh quality check failed");
+}
+
+//----------------------------------------------------------------------------
+void MeshActionsHandler::repairMesh() {
+	bool accepted = false;
+	const double minDihedralAngle = QInputDialog::getDouble(nullptr, "Repair Mesh",
+		"Minimal dihedral angle [deg]:", 10.0, 0.0, 70.0, 1, &accepted);
+	if (!accepted) {
+		SPDLOG_INFO("Repair mesh cancelled");
+		return;
+	}
+
+	if (!_modelInterface->repairMesh(minDihedralAngle)) {
+		SPDLOG_ERROR("Mesh repair failed");
+		return;
+	}
+	emit _signalSender->meshSignals->meshGenerated();
+}
+
+//----------------------------------------------------------------------------
+void MeshActionsHandler::smoothMesh() {
+	bool accepted = false;
+	const double targetQuality = QInputDialog::getDouble(nullptr, "Smooth Mesh",
+		"Target element quality (mean ratio):", 0.3, 0.0, 1.0, 2, &accepted);
+	if (!accepted) {
+		SPDLOG_INFO("Smooth mesh cancelled");
+		return;
+	}
+
+	if (!_modelInterface->smoothMesh(targetQuality)) {
+		SPDLOG_ERROR("Mesh smoothing failed");
+		return;
+	}
+	emit _signalSender->meshSignals->meshGenerated();
+}
+
+//----------------------------------------------------------------------------
+void MeshActionsHandler::refineMesh() {
+	if (!_modelInterface->refineMesh()) {
+		SPDLOG_ERROR("Mesh refinement failed");
+		return;
+	}
+	emit _signalSender->meshSignals->meshGenerated();
+}
+
 //----------------------------------------------------------------------------
 void MeshActionsHandler::addSizingToShapes(const std::vector<int>& aShapesVec) {
 	AddSizingCommand* sizingCommand
@@ -69,6 +69,52 @@ public slots:
 
 	void generate2DMesh();
 
+	/**
+	 * @brief Action that asks user for a .vtu or .msh file and adds mesh read from it
+	 * to the model. The file is memory-mapped, so large meshes are displayed without
+	 * being copied.
+	 */
+	void importMesh();
+
+	/**
+	 * @brief Action that asks user for a file and exports generated mesh to it. Format is
+	 * deduced from the file extension, each part is written to its own file.
+	 */
+	void exportMesh();
+
+	/**
+	 * @brief Action that asks user for number of partitions and splits volume mesh into
+	 * them for parallel solvers. Partitioned mesh exported to .vtu is written as one file
+	 * per partition, with ghost cells.
+	 */
+	void partitionMesh();
+
+	/**
+	 * @brief Action that evaluates quality metrics of mesh elements and reports their
+	 * statistics, histograms and the worst elements. Metric values are attached to the
+	 * mesh as cell arrays.
+	 */
+	void checkMeshQuality();
+
+	/**
+	 * @brief Action that asks user for minimal dihedral angle and re-meshes only regions
+	 * around tetrahedra with smaller angles, keeping the rest of the mesh. Regions are
+	 * replaced only if their quality improves.
+	 */
+	void repairMesh();
+
+	/**
+	 * @brief Action that asks user for target mean ratio of elements and smooths the mesh
+	 * until its worst element reaches it. Surface nodes slide on faces of the geometry.
+	 */
+	void smoothMesh();
+
+	/**
+	 * @brief Action that splits every element of the mesh into 8 tetrahedra (4 triangles)
+	 * giving the next level of mesh convergence study without regenerating it.
+	 */
+	void refineMesh();
+
 	/**
 	 * @brief Undoable action that creates fetches currently selected shapes ids
 	 * and creates an ElementSizing TreeItem adding it to TreeStructure.
@@ -32,19 +32,39 @@ namespace Rendering{
         _modelDataView(aModelDataView){};
 
 
-    void GeometryRenderHandler::addAllShapesToRenderer(){
-        const PartsMap& shapesMap = _modelDataView.getPartsMap();
-        _renderWindow->clearRenderer();
-        for (const auto shapePair : shapesMap){
-            _renderWindow->addShapeToRenderer(shapePair.second);
+    void GeometryRenderHandler::syncShapesWithModel(){
+        const PartsMap& partsMap = _modelDataView.getPartsMap();
+        bool sceneChanged = false;
+
+        // Drop parts that were removed from model or whose shape was replaced
+        for (auto entryIt = _scene.begin(); entryIt != _scene.end();){
+            const auto partIt = partsMap.find(entryIt->first);
+            if (partIt != partsMap.end() && partIt->second.IsEqual(entryIt->second.shape)){
+                ++entryIt;
+                continue;
+            }
+            _renderWindow->removeShapeFromRenderer(entryIt->second.pipelineId);
+            entryIt = _scene.erase(entryIt);
+            sceneChanged = true;
+        }
+
+        // Create pipelines only for parts that are not in the scene yet
+        for (const auto& [name, shape] : partsMap){
+            if (_scene.find(name) != _scene.end()){
+                continue;
+            }
+            const IVtk_IdType pipelineId = _renderWindow->addShapeToRenderer(shape);
+            _scene.emplace(name, SceneEntry{shape, pipelineId});
+            sceneChanged = true;
+        }
+
+        if (sceneChanged){
+            _renderWindow->fitView();
         }
     }
 
     void GeometryRenderHandler::showExistingShapes(){
-        const PartsMap& shapesMap = _modelDataView.getPartsMap();
-        // TODO: clear renderer if we are readding all shapes, alternatively add only required shapes - shapesAdded should take ids as input
-        _renderWindow->clearRenderer();
-        _renderWindow->addPipelinesToRenderer();
+        _renderWindow->setShapesVisibility(true);
         _renderWindow->RenderScene();
     }
 
@@ -22,6 +22,10 @@
 
 #include <QObject>
 #include <IVtk_Types.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <map>
+#include <string>
 
 class ModelDataView;
 
@@ -48,24 +52,18 @@ class GeometryRenderHandler : public QObject{
 
     public slots:
 
-    // void shapeAdded();
-    // void shapeRemoved();
-    // void shapeModified();
-    
     /**
-     * @brief Slot that clears the renderer, fetches all TopoDS_Shapes that are currently in model and
-     * passes them to the renderer. Renderer will create selection pipelines and display them.
+     * @brief Slot that fetches all parts that are currently in model and compares them with the
+     * scene registry. Only parts that were added, removed or modified since last synchronization
+     * are passed to the renderer, pipelines (and tessellation) of unchanged parts are reused.
      */
-    void addAllShapesToRenderer();
+    void syncShapesWithModel();
 
     /**
-    * @brief Slot that clears the renderer. Adds existing selection pipelines to the renderer.
+    * @brief Slot that shows existing selection pipelines. Pipelines are not rebuilt.
     */
     void showExistingShapes();
 
-    // void shapesRemoved();
-    // void shapesModified();
-
     /**
     * @brief Slot that upon triggered will fetch ids of currently selected TopoDS_Shapes and send them
     * in sendSelectedShapes signal.
@@ -94,8 +92,19 @@ class GeometryRenderHandler : public QObject{
     void sendSelectedShapes(const std::vector<int>& selectedShapes);
 
     private:
+    /**
+    * @brief Entry of the scene registry - part as it was last passed to the renderer.
+    */
+    struct SceneEntry{
+        TopoDS_Shape shape;
+        IVtk_IdType pipelineId;
+    };
+
     QVTKRenderWindow* _renderWindow;
     const ModelDataView& _modelDataView;
+
+    // Scene registry keyed by part name
+    std::map<std::string, SceneEntry> _scene;
 };
 
 }
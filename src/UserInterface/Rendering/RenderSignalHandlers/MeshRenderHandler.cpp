@@ -21,19 +21,99 @@
 #include "ModelDataView.hpp"
 #include "QVTKRenderWindow.hpp"
 
+#include "MGTMesh_SectionView.hpp"
+
 namespace Rendering{
 
     MeshRenderHandler::MeshRenderHandler(QVTKRenderWindow* aRenderWindow, const ModelDataView& aModelDataView, QObject* aParent) : 
         QObject(aParent),
         _renderWindow(aRenderWindow),
-        _modelDataView(aModelDataView){};
+        _modelDataView(aModelDataView),
+        _meshActorMTime(0),
+        _sectionViewMTime(0),
+        _sectionVisible(false){};
+
+    MeshRenderHandler::~MeshRenderHandler() = default;
 
     void MeshRenderHandler::showMeshActor(){
-        _renderWindow->clearRenderer();
-        vtkSmartPointer<vtkActor> meshActor = _modelDataView.getMeshActor();
-        if(meshActor){
-            _renderWindow->addActor(meshActor);
-            _renderWindow->RenderScene();
+        const vtkMTimeType meshMTime = _modelDataView.getMeshMTime();
+        if(!_meshActor || meshMTime != _meshActorMTime){
+            if(_meshActor){
+                _renderWindow->removeActor(_meshActor);
+                _meshActor = nullptr;
+            }
+            if(meshMTime != 0){
+                _meshActor = _modelDataView.getMeshActor();
+                _renderWindow->addActor(_meshActor);
+            }
+            _meshActorMTime = meshMTime;
+        }
+
+        hideMeshSection();
+        _renderWindow->setShapesVisibility(false);
+        if(_meshActor){
+            _meshActor->SetVisibility(true);
+        }
+        _renderWindow->RenderScene();
+    }
+
+    void MeshRenderHandler::hideMeshActor(){
+        if(_meshActor){
+            _meshActor->SetVisibility(false);
+        }
+    }
+
+    void MeshRenderHandler::showMeshSection(){
+        const vtkMTimeType meshMTime = _modelDataView.getMeshMTime();
+        if(!_sectionView || meshMTime != _sectionViewMTime){
+            if(_sectionView){
+                _renderWindow->removeActor(_sectionView->GetBoundaryActor());
+                _renderWindow->removeActor(_sectionView->GetSectionActor());
+                _sectionView = nullptr;
+            }
+            if(meshMTime != 0 && _modelDataView.hasVolumeMesh()){
+                _sectionView = _modelDataView.createMeshSectionView();
+                _renderWindow->addActor(_sectionView->GetBoundaryActor());
+                _renderWindow->addActor(_sectionView->GetSectionActor());
+            }
+            _sectionViewMTime = meshMTime;
+        }
+
+        if(!_sectionView){
+            // Emitted even if section was hidden, so that the request to show it is reverted
+            _renderWindow->hidePlaneWidget();
+            _sectionVisible = false;
+            emit meshSectionVisibilityChanged(false);
+            return;
+        }
+
+        hideMeshActor();
+        _renderWindow->setShapesVisibility(false);
+        _sectionView->GetBoundaryActor()->SetVisibility(true);
+        _sectionView->GetSectionActor()->SetVisibility(true);
+
+        double bounds[6];
+        _sectionView->GetBounds(bounds);
+        MGTMesh_SectionView* sectionView = _sectionView.get();
+        _renderWindow->showPlaneWidget(bounds,
+            [sectionView](const double* origin, const double* normal){
+                sectionView->SetPlane(origin, normal);
+            });
+        if(!_sectionVisible){
+            _sectionVisible = true;
+            emit meshSectionVisibilityChanged(true);
+        }
+    }
+
+    void MeshRenderHandler::hideMeshSection(){
+        _renderWindow->hidePlaneWidget();
+        if(_sectionView){
+            _sectionView->GetBoundaryActor()->SetVisibility(false);
+            _sectionView->GetSectionActor()->SetVisibility(false);
+        }
+        if(_sectionVisible){
+            _sectionVisible = false;
+            emit meshSectionVisibilityChanged(false);
         }
     }
 }
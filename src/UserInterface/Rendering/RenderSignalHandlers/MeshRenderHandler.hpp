@@ -23,7 +23,13 @@
 #include <IVtk_Types.hxx>
 #include <QObject>
 
+#include <vtkActor.h>
+#include <vtkSmartPointer.h>
+
+#include <memory>
+
 class ModelDataView;
+class MGTMesh_SectionView;
 
 namespace Rendering {
 
@@ -41,7 +47,7 @@ class MeshRenderHandler : public QObject {
 	friend class RenderSignalHandler;
 
 public:
-	virtual ~MeshRenderHandler() = default;
+	virtual ~MeshRenderHandler();
 
 private:
 	MeshRenderHandler(
@@ -50,16 +56,55 @@ private:
 public slots:
 
 	/**
-	 * @brief Slot that upon triggered will clear the renderer, fetch current MeshActor from
-	 * model view and add it to the renderer.
+	 * @brief Slot that upon triggered will hide shape pipelines and show mesh actor. Mesh actor
+	 * is fetched from model view only if the mesh was regenerated since it was last shown.
 	 */
 	void showMeshActor();
 
+	/**
+	 * @brief Slot that hides mesh actor without removing it from the renderer.
+	 */
+	void hideMeshActor();
+
+	/**
+	 * @brief Slot that shows mesh clipped by interactive plane, with cells cut by the plane
+	 * displayed as a whole. Section view is rebuilt only if the mesh was regenerated.
+	 */
+	void showMeshSection();
+
+	/**
+	 * @brief Slot that hides mesh section and the plane widget.
+	 */
+	void hideMeshSection();
+
+signals:
+
+	/**
+	 * @brief Emitted when mesh section is shown or hidden, also when it is hidden implicitly
+	 * by showing mesh actor or could not be shown because there is no volume mesh.
+	 */
+	void meshSectionVisibilityChanged(bool aVisible);
+
 private slots:
 
 private:
 	QVTKRenderWindow* _renderWindow;
 	const ModelDataView& _modelDataView;
+
+	// Mesh actor currently registered in the renderer
+	vtkSmartPointer<vtkActor> _meshActor;
+
+	// Modification time of the mesh that _meshActor was built from
+	vtkMTimeType _meshActorMTime;
+
+	// Section view with its actors registered in the renderer
+	std::unique_ptr<MGTMesh_SectionView> _sectionView;
+
+	// Modification time of the mesh that _sectionView was built from
+	vtkMTimeType _sectionViewMTime;
+
+	// Section actors and plane widget are shown
+	bool _sectionVisible;
 };
 }
 
@@ -31,14 +31,19 @@
 #include <vtkRenderer.h>
 
 #include <IVtkOCC_Shape.hxx>
+#include <TopExp.hxx>
+#include <Prs3d_Drawer.hxx>
 #include <IVtkTools_DisplayModeFilter.hxx>
 #include <IVtkTools_ShapeObject.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(QIVtkSelectionPipeline, Standard_Transient)
 
 //----------------------------------------------------------------------------
-QIVtkSelectionPipeline::QIVtkSelectionPipeline(
-	const TopoDS_Shape& theShape, const Standard_Integer theShapeID) {
+QIVtkSelectionPipeline::QIVtkSelectionPipeline(const TopoDS_Shape& theShape,
+	const TopoDS_Shape& theDisplayShape, const Standard_Integer theShapeID) {
+	// Same traversal as IVtkOCC_Shape does for the displayed copy
+	TopExp::MapShapes(theShape, _subShapes);
+
 	/* ===========================
 	 *  Allocate involved filters
 	 * =========================== */
@@ -53,8 +58,11 @@ QIVtkSelectionPipeline::QIVtkSelectionPipeline(
 	 *  Build primary pipeline
 	 * ======================== */
 	_actor = vtkSmartPointer<vtkActor>::New();
-	IVtkOCC_Shape::Handle anIVtkShape = new IVtkOCC_Shape(theShape);
+	IVtkOCC_Shape::Handle anIVtkShape = new IVtkOCC_Shape(theDisplayShape);
 	anIVtkShape->SetId(theShapeID);
+	// Triangulation is computed in background by QIVtkTessellator, data source
+	// must not mesh the shape on its own.
+	anIVtkShape->Attributes()->SetAutoTriangulation(Standard_False);
 	_dataSource = vtkSmartPointer<IVtkTools_ShapeDataSource>::New();
 	_dataSource->SetShape(anIVtkShape);
 
@@ -146,6 +154,24 @@ void QIVtkSelectionPipeline::RemoveFromRenderer(vtkRenderer* theRenderer) {
 	}
 }
 
+//----------------------------------------------------------------------------
+void QIVtkSelectionPipeline::SetVisibility(bool theVisibility) {
+	_actor->SetVisibility(theVisibility);
+	_actor->SetPickable(theVisibility);
+	_hiliActor->SetVisibility(theVisibility);
+	_selActor->SetVisibility(theVisibility);
+}
+
+//----------------------------------------------------------------------------
+void QIVtkSelectionPipeline::UpdateTessellation() {
+	_dataSource->Modified();
+}
+
+//----------------------------------------------------------------------------
+const TopoDS_Shape& QIVtkSelectionPipeline::GetSubShape(const IVtk_IdType theSubShapeID) const {
+	return _subShapes.FindKey(static_cast<Standard_Integer>(theSubShapeID));
+}
+
 //----------------------------------------------------------------------------
 void QIVtkSelectionPipeline::ClearHighlightFilters() {
 	this->GetHighlightFilter()->Clear();
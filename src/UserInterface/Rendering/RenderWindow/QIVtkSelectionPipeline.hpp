@@ -24,6 +24,7 @@
 
 #include <NCollection_Shared.hxx>
 #include <Standard_Transient.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopoDS_Shape.hxx>
 
 // prevent disabling some MSVC warning messages by VTK headers
@@ -65,10 +66,11 @@ public:
 
 	/**
 	 * @brief Constructs a QIVtkSelectionPipeline for a given shape and shape ID.
-	 * @param theShape The TopoDS_Shape to be managed by this pipeline.
+	 * @param theShape The TopoDS_Shape of the model managed by this pipeline.
+	 * @param theDisplayShape Copy of the shape whose triangulation is displayed.
 	 * @param theShapeID The ID of the shape.
 	 */
-	QIVtkSelectionPipeline(const TopoDS_Shape& theShape,
+	QIVtkSelectionPipeline(const TopoDS_Shape& theShape, const TopoDS_Shape& theDisplayShape,
 		const Standard_Integer theShapeID);
 
 	/**
@@ -89,6 +91,25 @@ public:
 	 */
 	void RemoveFromRenderer(vtkRenderer* theRenderer);
 
+	/**
+	 * @brief Shows or hides all actors of the pipeline without releasing their graphics resources.
+	 * Hidden pipeline is also excluded from picking.
+	 * @param theVisibility Visibility flag.
+	 */
+	void SetVisibility(bool theVisibility);
+
+	/**
+	 * @brief Rebuilds polygonal data after triangulation of the shape was replaced.
+	 */
+	void UpdateTessellation();
+
+	/**
+	 * @brief Gets sub-shape of the model shape picked in the displayed one.
+	 * @param theSubShapeID ID of the sub-shape in the displayed shape.
+	 * @return The sub-shape of the model shape with the same index.
+	 */
+	const TopoDS_Shape& GetSubShape(const IVtk_IdType theSubShapeID) const;
+
 	/**
 	 * @brief Clears all highlight filters.
 	 */
@@ -179,6 +200,9 @@ private:
 	typedef NCollection_DataMap<FilterId, vtkSmartPointer<vtkAlgorithm>> FilterMap;
 
 private:
+	//! Sub-shapes of the model shape, indexed as sub-shapes of the displayed one.
+	TopTools_IndexedMapOfShape _subShapes;
+
 	//! Shape data source.
 	vtkSmartPointer<IVtkTools_ShapeDataSource> _dataSource;
 
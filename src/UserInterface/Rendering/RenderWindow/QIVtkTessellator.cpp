@@ -0,0 +1,350 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz, Krystian Fudali
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "QIVtkTessellator.hpp"
+
+#include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <Bnd_Box.hxx>
+#include <Precision.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_ListIteratorOfListOfShape.hxx>
+#include <TopoDS.hxx>
+
+// prevent disabling some MSVC warning messages by VTK headers
+#include <Standard_WarningsDisable.hxx>
+#include <Standard_WarningsRestore.hxx>
+#include <vtkCamera.h>
+#include <vtkLogger.h>
+#include <vtkMath.h>
+#include <vtkRenderer.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+// Linear deflection of each level relative to the diagonal of shape bounding box
+constexpr std::array<double, QIVtkTessellator::LevelsNb> RelativeDeflection
+	= { 1.0e-2, 2.0e-3, 5.0e-4, 1.25e-4 };
+
+// Angular deflection of each level [rad]
+constexpr std::array<double, QIVtkTessellator::LevelsNb> AngularDeflection
+	= { 0.5, 0.35, 0.2, 0.1 };
+}
+
+//----------------------------------------------------------------------------
+QIVtkTessellator::QIVtkTessellator(QObject* parent)
+	: QObject(parent) { }
+
+//----------------------------------------------------------------------------
+QIVtkTessellator::~QIVtkTessellator() {
+	_pool.clear();
+	_pool.waitForDone();
+}
+
+//----------------------------------------------------------------------------
+double QIVtkTessellator::getLinearDeflection(int level, double diagonal) {
+	return RelativeDeflection[level] * diagonal;
+}
+
+//----------------------------------------------------------------------------
+double QIVtkTessellator::getAngularDeflection(int level) {
+	return AngularDeflection[level];
+}
+
+//----------------------------------------------------------------------------
+TopoDS_Shape QIVtkTessellator::addShape(IVtk_IdType shapeId, const TopoDS_Shape& shape) {
+	PartEntry part;
+	// Workers mesh their own topology and triangulations are bound to the displayed one,
+	// geometry is shared (read only). Topology of the model shape is shared with the model
+	// and its meshers, so none of the triangulations is bound to it.
+	part.displayShape = BRepBuilderAPI_Copy(shape, Standard_False, Standard_False).Shape();
+	part.workShape = BRepBuilderAPI_Copy(shape, Standard_False, Standard_False).Shape();
+
+	const TopoDS_Shape displayShape = part.displayShape;
+	_parts[shapeId] = std::move(part);
+	this->scheduleLevels(shapeId);
+	return displayShape;
+}
+
+//----------------------------------------------------------------------------
+void QIVtkTessellator::removeShape(IVtk_IdType shapeId) {
+	_parts.erase(shapeId);
+}
+
+//----------------------------------------------------------------------------
+int QIVtkTessellator::getAppliedLevel(IVtk_IdType shapeId) const {
+	const auto partIt = _parts.find(shapeId);
+	return partIt != _parts.end() ? partIt->second.appliedLevel : -1;
+}
+
+//----------------------------------------------------------------------------
+void QIVtkTessellator::updateLevelOfDetail(vtkRenderer* renderer) {
+	vtkCamera* camera = renderer->GetActiveCamera();
+	const int* viewportSize = renderer->GetSize();
+	if (!camera || viewportSize[1] <= 0)
+		return;
+
+	double cameraPosition[3];
+	camera->GetPosition(cameraPosition);
+	const gp_Pnt eye(cameraPosition[0], cameraPosition[1], cameraPosition[2]);
+	const double halfAngleTan
+		= std::tan(vtkMath::RadiansFromDegrees(camera->GetViewAngle()) / 2.0);
+
+	for (auto& [shapeId, part] : _parts) {
+		if (part.diagonal <= 0.0)
+			continue;
+
+		// Size of a pixel at the nearest point of the shape bounding sphere
+		double pixelSize;
+		if (camera->GetParallelProjection()) {
+			pixelSize = 2.0 * camera->GetParallelScale() / viewportSize[1];
+		} else {
+			const double distance = std::max(
+				part.center.Distance(eye) - part.diagonal / 2.0, part.diagonal * 1.0e-3);
+			pixelSize = 2.0 * distance * halfAngleTan / viewportSize[1];
+		}
+
+		// Chordal error below half of a pixel is not visible
+		int level = DefaultLevel;
+		while (level < LevelsNb - 1
+			&& getLinearDeflection(level, part.diagonal) > 0.5 * pixelSize) {
+			++level;
+		}
+
+		if (level > part.targetLevel) {
+			part.targetLevel = level;
+			this->scheduleLevels(shapeId);
+		}
+	}
+}
+
+//----------------------------------------------------------------------------
+void QIVtkTessellator::scheduleLevels(IVtk_IdType shapeId) {
+	const auto partIt = _parts.find(shapeId);
+	if (partIt == _parts.end())
+		return;
+
+	PartEntry& part = partIt->second;
+	if (part.busy)
+		return;
+
+	int fromLevel = 0;
+	while (fromLevel <= part.targetLevel && part.levels[fromLevel])
+		++fromLevel;
+
+	if (fromLevel > part.targetLevel) {
+		this->applyFinestLevel(shapeId, part);
+		return;
+	}
+
+	part.busy = true;
+	const TopoDS_Shape workShape = part.workShape;
+	const int toLevel = part.targetLevel;
+	const double knownDiagonal = part.diagonal;
+
+	_pool.start([this, shapeId, workShape, fromLevel, toLevel, knownDiagonal]() {
+		double diagonal = knownDiagonal;
+		gp_Pnt center;
+		if (diagonal <= 0.0) {
+			Bnd_Box box;
+			BRepBndLib::Add(workShape, box, Standard_False);
+			if (!box.IsVoid()) {
+				diagonal = std::sqrt(box.SquareExtent());
+				center = gp_Pnt((box.CornerMin().XYZ() + box.CornerMax().XYZ()) / 2.0);
+			}
+		}
+
+		if (diagonal > Precision::Confusion()) {
+			for (int level = fromLevel; level <= toLevel; ++level) {
+				std::shared_ptr<const Tessellation> tessellation
+					= tessellate(workShape, level, diagonal);
+
+				QMetaObject::invokeMethod(
+					this,
+					[this, shapeId, level, tessellation, diagonal, center]() {
+						const auto partIt = _parts.find(shapeId);
+						if (partIt == _parts.end())
+							return;
+
+						PartEntry& part = partIt->second;
+						if (part.diagonal <= 0.0) {
+							part.diagonal = diagonal;
+							part.center = center;
+						}
+						part.levels[level] = tessellation;
+						this->applyFinestLevel(shapeId, part);
+					},
+					Qt::QueuedConnection);
+			}
+		} else {
+			vtkLogF(WARNING, "Shape %lld has empty bounding box, it is not tessellated",
+				static_cast<long long>(shapeId));
+		}
+
+		QMetaObject::invokeMethod(
+			this,
+			[this, shapeId]() {
+				const auto partIt = _parts.find(shapeId);
+				if (partIt == _parts.end())
+					return;
+
+				partIt->second.busy = false;
+				if (partIt->second.diagonal > 0.0)
+					this->scheduleLevels(shapeId);
+			},
+			Qt::QueuedConnection);
+	});
+}
+
+//----------------------------------------------------------------------------
+void QIVtkTessellator::applyFinestLevel(IVtk_IdType shapeId, PartEntry& part) {
+	int level = part.targetLevel;
+	while (level >= 0 && !part.levels[level])
+		--level;
+
+	if (level < 0 || level == part.appliedLevel)
+		return;
+
+	if (!bindTessellation(part.displayShape, *part.levels[level])) {
+		vtkLogF(ERROR, "Topology of shape %lld does not match its tessellation",
+			static_cast<long long>(shapeId));
+		return;
+	}
+
+	part.appliedLevel = level;
+	emit tessellationApplied(shapeId, level);
+}
+
+//----------------------------------------------------------------------------
+std::shared_ptr<const QIVtkTessellator::Tessellation> QIVtkTessellator::tessellate(
+	const TopoDS_Shape& workShape, int level, double diagonal) {
+
+	BRepMesh_IncrementalMesh mesher(workShape, getLinearDeflection(level, diagonal),
+		Standard_False, getAngularDeflection(level), Standard_True);
+
+	TopTools_IndexedMapOfShape faces;
+	TopTools_IndexedMapOfShape edges;
+	TopTools_IndexedDataMapOfShapeListOfShape edgeFaces;
+	TopExp::MapShapes(workShape, TopAbs_FACE, faces);
+	TopExp::MapShapes(workShape, TopAbs_EDGE, edges);
+	TopExp::MapShapesAndAncestors(workShape, TopAbs_EDGE, TopAbs_FACE, edgeFaces);
+
+	auto tessellation = std::make_shared<Tessellation>();
+	tessellation->edgesNb = edges.Extent();
+	tessellation->faces.resize(faces.Extent());
+
+	for (int faceIndex = 1; faceIndex <= faces.Extent(); ++faceIndex) {
+		TopLoc_Location location;
+		tessellation->faces[faceIndex - 1]
+			= BRep_Tool::Triangulation(TopoDS::Face(faces(faceIndex)), location);
+	}
+
+	for (int edgeIndex = 1; edgeIndex <= edges.Extent(); ++edgeIndex) {
+		const TopoDS_Edge& edge = TopoDS::Edge(edges(edgeIndex));
+		const TopTools_ListOfShape* ancestors = edgeFaces.Seek(edge);
+
+		if (!ancestors || ancestors->IsEmpty()) {
+			TopLoc_Location location;
+			Handle(Poly_Polygon3D) polygon = BRep_Tool::Polygon3D(edge, location);
+			if (!polygon.IsNull())
+				tessellation->freeEdges.push_back({ edgeIndex - 1, polygon });
+			continue;
+		}
+
+		std::vector<int> visitedFaces;
+		for (TopTools_ListIteratorOfListOfShape fIt(*ancestors); fIt.More(); fIt.Next()) {
+			const int faceIndex = faces.FindIndex(fIt.Value());
+			if (faceIndex == 0
+				|| std::find(visitedFaces.begin(), visitedFaces.end(), faceIndex)
+					!= visitedFaces.end()) {
+				continue;
+			}
+			visitedFaces.push_back(faceIndex);
+
+			TopLoc_Location location;
+			const Handle(Poly_Triangulation)& triangulation
+				= BRep_Tool::Triangulation(TopoDS::Face(fIt.Value()), location);
+			if (triangulation.IsNull())
+				continue;
+
+			Handle(Poly_PolygonOnTriangulation) polygon
+				= BRep_Tool::PolygonOnTriangulation(edge, triangulation, location);
+			if (!polygon.IsNull()) {
+				tessellation->edges.push_back(
+					{ edgeIndex - 1, faceIndex - 1, polygon, location });
+			}
+		}
+	}
+
+	return tessellation;
+}
+
+//----------------------------------------------------------------------------
+bool QIVtkTessellator::bindTessellation(
+	const TopoDS_Shape& shape, const Tessellation& tessellation) {
+
+	TopTools_IndexedMapOfShape faces;
+	TopTools_IndexedMapOfShape edges;
+	TopExp::MapShapes(shape, TopAbs_FACE, faces);
+	TopExp::MapShapes(shape, TopAbs_EDGE, edges);
+
+	if (faces.Extent() != static_cast<int>(tessellation.faces.size())
+		|| edges.Extent() != tessellation.edgesNb) {
+		return false;
+	}
+
+	std::vector<Handle(Poly_Triangulation)> previousFaces(faces.Extent());
+	for (int faceIndex = 1; faceIndex <= faces.Extent(); ++faceIndex) {
+		TopLoc_Location location;
+		previousFaces[faceIndex - 1]
+			= BRep_Tool::Triangulation(TopoDS::Face(faces(faceIndex)), location);
+	}
+
+	BRep_Builder builder;
+
+	// Polygons on triangulation are bound to triangulation of the face, polygons
+	// of previously bound level have to be removed before new ones are added.
+	for (const EdgePolygon& edgePolygon : tessellation.edges) {
+		const TopoDS_Edge& edge = TopoDS::Edge(edges(edgePolygon.edgeIndex + 1));
+		const Handle(Poly_Triangulation)& previous = previousFaces[edgePolygon.faceIndex];
+		if (!previous.IsNull()) {
+			builder.UpdateEdge(
+				edge, Handle(Poly_PolygonOnTriangulation)(), previous, edgePolygon.location);
+		}
+		builder.UpdateEdge(edge, edgePolygon.polygon,
+			tessellation.faces[edgePolygon.faceIndex], edgePolygon.location);
+	}
+
+	for (const FreeEdgePolygon& freeEdge : tessellation.freeEdges) {
+		builder.UpdateEdge(TopoDS::Edge(edges(freeEdge.edgeIndex + 1)), freeEdge.polygon);
+	}
+
+	for (int faceIndex = 1; faceIndex <= faces.Extent(); ++faceIndex) {
+		builder.UpdateFace(
+			TopoDS::Face(faces(faceIndex)), tessellation.faces[faceIndex - 1]);
+	}
+
+	return true;
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2024 Paweł Gilewicz, Krystian Fudali
+ *
+ * This file is part of the Mesh Generating Tool. (https://github.com/PawelekPro/MeshGeneratingTool)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef QIVTKTESSELLATOR_HPP
+#define QIVTKTESSELLATOR_HPP
+
+#include <Poly_Polygon3D.hxx>
+#include <Poly_PolygonOnTriangulation.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS_Shape.hxx>
+#include <gp_Pnt.hxx>
+
+#include <IVtk_Types.hxx>
+
+#include <QObject>
+#include <QThreadPool>
+
+#include <array>
+#include <map>
+#include <memory>
+#include <vector>
+
+class vtkRenderer;
+
+/**
+ * @class QIVtkTessellator
+ * @brief Computes tessellation of displayed shapes on a worker pool.
+ *
+ * Every shape is tessellated with BRepMesh_IncrementalMesh (in parallel mode) on its own
+ * copy of the topology, so the GUI thread never waits for meshing and never shares
+ * topology with workers. Coarse level of detail is computed first, finer levels follow
+ * and are requested again when camera zooms in. Results are cached per shape and level;
+ * applying a cached level only rebinds triangulations to the display copy of the shape.
+ * Shapes of the model are never modified.
+ */
+class QIVtkTessellator : public QObject {
+	Q_OBJECT
+
+public:
+	//! Number of available levels of detail, level 0 is the coarsest one.
+	static constexpr int LevelsNb = 4;
+
+	//! Level that is displayed when the whole shape fits the view.
+	static constexpr int DefaultLevel = 1;
+
+	explicit QIVtkTessellator(QObject* parent = nullptr);
+
+	/**
+	 * @brief Cancels pending tasks and waits for running ones.
+	 */
+	~QIVtkTessellator() override;
+
+	/**
+	 * @brief Starts background tessellation of the shape.
+	 * @param shapeId ID of the pipeline displaying the shape.
+	 * @param shape The shape of the model, it is left untouched.
+	 * @return Copy of the shape to be displayed, its triangulation is replaced once levels
+	 * are computed. Sub-shapes are indexed the same way as in the shape.
+	 */
+	TopoDS_Shape addShape(IVtk_IdType shapeId, const TopoDS_Shape& shape);
+
+	/**
+	 * @brief Drops cached tessellations of the shape. Results of running task are discarded.
+	 */
+	void removeShape(IVtk_IdType shapeId);
+
+	/**
+	 * @brief Requests finer levels for shapes whose chordal error is visible with current camera.
+	 * @param renderer Renderer whose active camera is used.
+	 */
+	void updateLevelOfDetail(vtkRenderer* renderer);
+
+	/**
+	 * @brief Returns level currently bound to the shape, -1 if none was applied yet.
+	 */
+	int getAppliedLevel(IVtk_IdType shapeId) const;
+
+signals:
+	/**
+	 * @brief Emitted on GUI thread once triangulation of the shape was replaced.
+	 * Pipeline displaying the shape has to be updated.
+	 */
+	void tessellationApplied(IVtk_IdType shapeId, int level);
+
+private:
+	/**
+	 * @brief Polygon of an edge bound to triangulation of one of its faces.
+	 */
+	struct EdgePolygon {
+		int edgeIndex;
+		int faceIndex;
+		Handle(Poly_PolygonOnTriangulation) polygon;
+		TopLoc_Location location;
+	};
+
+	/**
+	 * @brief Polygon of an edge that does not belong to any face.
+	 */
+	struct FreeEdgePolygon {
+		int edgeIndex;
+		Handle(Poly_Polygon3D) polygon;
+	};
+
+	/**
+	 * @brief Tessellation of a shape at single level. Faces and edges are indexed
+	 * the same way as in TopExp::MapShapes of the shape.
+	 */
+	struct Tessellation {
+		std::vector<Handle(Poly_Triangulation)> faces;
+		std::vector<EdgePolygon> edges;
+		std::vector<FreeEdgePolygon> freeEdges;
+		int edgesNb = 0;
+	};
+
+	struct PartEntry {
+		TopoDS_Shape displayShape;
+		TopoDS_Shape workShape;
+		std::array<std::shared_ptr<const Tessellation>, LevelsNb> levels;
+		double diagonal = 0.0;
+		gp_Pnt center;
+		int appliedLevel = -1;
+		int targetLevel = DefaultLevel;
+		bool busy = false;
+	};
+
+	static double getLinearDeflection(int level, double diagonal);
+	static double getAngularDeflection(int level);
+
+	static std::shared_ptr<const Tessellation> tessellate(
+		const TopoDS_Shape& workShape, int level, double diagonal);
+	static bool bindTessellation(const TopoDS_Shape& shape, const Tessellation& tessellation);
+
+	void scheduleLevels(IVtk_IdType shapeId);
+	void applyFinestLevel(IVtk_IdType shapeId, PartEntry& part);
+
+private:
+	//! Cache of shapes tessellations, keyed by pipeline ID.
+	std::map<IVtk_IdType, PartEntry> _parts;
+
+	//! Workers, one task per shape at a time.
+	QThreadPool _pool;
+};
+
+#endif
@@ -22,6 +22,8 @@
 #include <Message.hxx>
 #include <Message_Messenger.hxx>
 
+#include <chrono>
+
 //----------------------------------------------------------------------------
 static void ClearHighlightAndSelection(ShapePipelinesMap& theMap,
 	const Standard_Boolean doHighlighting, const Standard_Boolean doSelection) {
@@ -52,7 +54,7 @@ QVTKInteractorStyle::QVTKInteractorStyle()
 
 //----------------------------------------------------------------------------
 void QVTKInteractorStyle::setQVTKRenderWindow(
-	const Rendering::QVTKRenderWindow* qvtkRenderWindow) {
+	Rendering::QVTKRenderWindow* qvtkRenderWindow) {
 	_qvtkRenderWindow = qvtkRenderWindow;
 }
 
@@ -117,6 +119,29 @@ void QVTKInteractorStyle::removePipelines() {
     }
     _shapePipelinesMap.Clear();
 }
+//----------------------------------------------------------------------------
+Handle(QIVtkSelectionPipeline) QVTKInteractorStyle::getPipeline(IVtk_IdType shapeID) {
+	Handle(QIVtkSelectionPipeline) pipeline;
+	_shapePipelinesMap.Find(shapeID, pipeline);
+	return pipeline;
+}
+
+//----------------------------------------------------------------------------
+void QVTKInteractorStyle::removePipeline(IVtk_IdType shapeID) {
+	if (!_shapePipelinesMap.IsBound(shapeID))
+		return;
+
+	_shapePipelinesMap.UnBind(shapeID);
+
+	IVtk_ShapeIdList* shapeIdList = nullptr;
+	if (_selectedSubShapeIdsMap.Find(shapeID, shapeIdList)) {
+		delete shapeIdList;
+		_selectedSubShapeIdsMap.UnBind(shapeID);
+	}
+
+	_selectedShapes.clear();
+}
+
 //----------------------------------------------------------------------------
 Standard_Integer QVTKInteractorStyle::getPipelinesMapSize() {
 	return _shapePipelinesMap.Size();
@@ -161,6 +186,7 @@ void QVTKInteractorStyle::setSelectionMode(
 	// Set given selection mode
 	_picker->SetSelectionMode(mode, true);
 	_currentSelection = mode;
+	_qvtkRenderWindow->RenderScene();
 }
 
 IVtk_SelectionMode QVTKInteractorStyle::getSelectionMode(){
@@ -185,8 +211,15 @@ void QVTKInteractorStyle::createContextMenu() {
 		// QObject::connect(_addSizingAction, &QAction::triggered, 
 		// 	[this]() {_qvtkRenderWindow->model->addSizing(this->_selectedShapes);});
 
+		_overlayAction = new QAction("Performance overlay", _contextMenu);
+		_overlayAction->setCheckable(true);
+		QObject::connect(_overlayAction, &QAction::toggled,
+			[this](bool checked) { _qvtkRenderWindow->enablePerformanceOverlay(checked); });
+
 		_contextMenu->addAction(_fitViewAction);
 		_contextMenu->addAction(_addSizingAction);
+		_contextMenu->addSeparator();
+		_contextMenu->addAction(_overlayAction);
 
 	}
 }
@@ -244,6 +277,7 @@ void QVTKInteractorStyle::OnKeyPress() {
 			pipeline->Mapper()->Update();
 		}
 		_selectedShapes.clear();
+		_qvtkRenderWindow->RenderScene();
 	}
 
 	this->Superclass::OnKeyPress();
@@ -258,7 +292,10 @@ void QVTKInteractorStyle::OnKeyRelease() {
 void QVTKInteractorStyle::MoveTo(
 	Standard_Integer theX, Standard_Integer theY) {
 
+	const auto pickStart = std::chrono::steady_clock::now();
 	_picker->Pick(theX, theY, 0);
+	const auto pickEnd = std::chrono::steady_clock::now();
+	_lastPickTime = std::chrono::duration<double, std::milli>(pickEnd - pickStart).count();
 
 	// Traversing results
 	vtkSmartPointer<vtkActorCollection> anActorCollection = _picker->GetPickedActors();
@@ -331,6 +368,7 @@ void QVTKInteractorStyle::MoveTo(
 
 			pipeline->Mapper()->Update();
 		}
+		_qvtkRenderWindow->RenderScene();
 	}
 }
 
@@ -410,7 +448,7 @@ void QVTKInteractorStyle::OnSelection(const Standard_Boolean appendId) {
 			_selectedShapes.clear();
 			for (; aMetaIds.More(); aMetaIds.Next()) {
 				IVtk_ShapeIdList aSubSubIds = anOccShape->GetSubIds(aMetaIds.Value());
-				const TopoDS_Shape& aSubShape = anOccShape->GetSubShape(aMetaIds.Value());
+				const TopoDS_Shape& aSubShape = pipeline->GetSubShape(aMetaIds.Value());
 				_selectedShapes.push_back(aSubShape);
 				aSubIds.Append(aSubSubIds);
 			}
@@ -425,6 +463,7 @@ void QVTKInteractorStyle::OnSelection(const Standard_Boolean appendId) {
 			if (!pipeline.IsNull())
 				pipeline->Mapper()->Update();
 		}
+		_qvtkRenderWindow->RenderScene();
 	}
 }
 
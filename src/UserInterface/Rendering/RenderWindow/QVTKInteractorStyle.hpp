@@ -86,7 +86,7 @@ public:
 	 * @brief Sets the QVTKRenderWindow for the interactor style.
 	 * @param qvtkRenderWindow A pointer to the QVTKRenderWindow.
 	 */
-	void setQVTKRenderWindow(const Rendering::QVTKRenderWindow*);
+	void setQVTKRenderWindow(Rendering::QVTKRenderWindow*);
 
 	/**
 	 * @brief Gets the renderer associated with the interactor style.
@@ -135,6 +135,11 @@ public:
 	 */
 	const std::vector<std::reference_wrapper<const TopoDS_Shape>>& getSelectedShapes();
 
+	/**
+	 * @brief Returns duration of the last pick performed on mouse move [ms].
+	 */
+	double getLastPickTime() const { return _lastPickTime; };
+
 	/**
 	 * @brief Gets the list of pipelines.
 	 * @return A list of handles to the QIVtkSelectionPipelines.
@@ -142,6 +147,20 @@ public:
 	NCollection_List<Handle(QIVtkSelectionPipeline)> getPipelines();
 	void removePipelines();
 
+	/**
+	 * @brief Gets the pipeline bound to the given ID.
+	 * @param id The ID associated with the pipeline.
+	 * @return A handle to the QIVtkSelectionPipeline or null handle if ID is not bound.
+	 */
+	Handle(QIVtkSelectionPipeline) getPipeline(IVtk_IdType);
+
+	/**
+	 * @brief Removes a single selection pipeline from the interactor style.
+	 * Current selection is cleared since it may reference sub-shapes of removed shape.
+	 * @param id The ID associated with the pipeline.
+	 */
+	void removePipeline(IVtk_IdType);
+
 	// Overriding
 public:
 	/**
@@ -215,6 +234,9 @@ private:
 	// ! Pointer to the "Fit View" action.
 	QPointer<QAction> _fitViewAction;
 	QPointer<QAction> _addSizingAction;
+
+	// ! Pointer to the action toggling performance overlay.
+	QPointer<QAction> _overlayAction;
 	// QPointer<QAction> _edgeSizingAction;
 
 
@@ -225,7 +247,7 @@ private:
 	vtkSmartPointer<IVtkTools_ShapePicker> _picker;
 
 	// ! Pointer to the QVTK render window.
-	const Rendering::QVTKRenderWindow* _qvtkRenderWindow;
+	Rendering::QVTKRenderWindow* _qvtkRenderWindow;
 
 	// ! Map of shape pipelines
 	ShapePipelinesMap _shapePipelinesMap;
@@ -237,6 +259,9 @@ private:
 	IVtk_SelectionMode _currentSelection;
 
 	std::vector<std::reference_wrapper<const TopoDS_Shape>> _selectedShapes;
+
+	// ! Duration of the last pick on mouse move [ms].
+	double _lastPickTime = 0.0;
 };
 
 #endif
\ No newline at end of file
@@ -21,6 +21,8 @@
 
 #include <QLayout>
 
+#include <format>
+
 //----------------------------------------------------------------------------
 Rendering::QVTKRenderWindow::QVTKRenderWindow(QWidget* widget)
 	: _widget(widget)
@@ -29,7 +31,20 @@ Rendering::QVTKRenderWindow::QVTKRenderWindow(QWidget* widget)
 	, _vtkWidget(new QVTKOpenGLNativeWidget())
 	, _shapePicker(vtkSmartPointer<IVtkTools_ShapePicker>::New())
 	, _interactorStyle(vtkSmartPointer<QVTKInteractorStyle>::New())
-	, _qIVtkViewRepresentation(new QIVtkViewRepresentation()) {
+	, _qIVtkViewRepresentation(new QIVtkViewRepresentation())
+	, _tessellator(std::make_unique<QIVtkTessellator>())
+	, _lastShapeId(0)
+	, _shapesVisible(true)
+	, _renderTimer(std::make_unique<QTimer>())
+	, _fitViewPending(false)
+	, _statsActor(vtkSmartPointer<vtkTextActor>::New())
+	, _statsEnabled(false)
+	, _statsObserved(false)
+	, _frameTimes {}
+	, _framesNb(0)
+	, _renderStartObserver(0)
+	, _renderEndObserver(0)
+	, _planeWidget(vtkSmartPointer<vtkImplicitPlaneWidget2>::New()) {
 
 	_vtkWidget->setRenderWindow(_rendererWindow);
 	_interactor = _vtkWidget->interactor();
@@ -77,6 +92,45 @@ Rendering::QVTKRenderWindow::QVTKRenderWindow(QWidget* widget)
 	_interactor->SetInteractorStyle(_interactorStyle);
 	_qIVtkViewRepresentation->setInteractorStyle(_interactorStyle);
 
+	// Setup background tessellation
+	QObject::connect(_tessellator.get(), &QIVtkTessellator::tessellationApplied,
+		[this](IVtk_IdType shapeId, int) {
+			Handle(QIVtkSelectionPipeline) pipeline = _interactorStyle->getPipeline(shapeId);
+			if (pipeline.IsNull())
+				return;
+			pipeline->UpdateTessellation();
+			this->RenderScene();
+		});
+	_interactorStyle->AddObserver(vtkCommand::EndInteractionEvent, this,
+		&Rendering::QVTKRenderWindow::updateLevelOfDetail);
+
+	// Setup render scheduler
+	_renderTimer->setSingleShot(true);
+	_renderTimer->setInterval(0);
+	QObject::connect(_renderTimer.get(), &QTimer::timeout,
+		[this]() { this->executeScheduledRender(); });
+
+	// Setup performance overlay
+	_statsActor->GetPositionCoordinate()->SetCoordinateSystemToNormalizedViewport();
+	_statsActor->SetPosition(0.99, 0.98);
+	_statsActor->GetTextProperty()->SetFontSize(12);
+	_statsActor->GetTextProperty()->SetColor(1.0, 1.0, 1.0);
+	_statsActor->GetTextProperty()->SetJustificationToRight();
+	_statsActor->GetTextProperty()->SetVerticalJustificationToTop();
+	_statsActor->VisibilityOff();
+	_renderer->AddActor2D(_statsActor);
+
+	// Setup section plane widget
+	const auto planeRep = vtkSmartPointer<vtkImplicitPlaneRepresentation>::New();
+	planeRep->SetPlaceFactor(1.0);
+	planeRep->OutlineTranslationOff();
+	planeRep->ScaleEnabledOff();
+	planeRep->DrawPlaneOff();
+	_planeWidget->SetRepresentation(planeRep);
+	_planeWidget->SetInteractor(_interactor);
+	_planeWidget->AddObserver(vtkCommand::InteractionEvent, this,
+		&Rendering::QVTKRenderWindow::onPlaneInteraction);
+
 	_renderer->ResetCamera();
 	_rendererWindow->Render();
 	_widget->layout()->addWidget(_vtkWidget);
@@ -84,6 +138,13 @@ Rendering::QVTKRenderWindow::QVTKRenderWindow(QWidget* widget)
 
 //----------------------------------------------------------------------------
 Rendering::QVTKRenderWindow::~QVTKRenderWindow() {
+	_renderTimer->stop();
+
+	// Render window outlives the widget deleted later
+	if (_statsEnabled) {
+		_rendererWindow->RemoveObserver(_renderStartObserver);
+		_rendererWindow->RemoveObserver(_renderEndObserver);
+	}
 
 	if (_renderer)
 		_renderer->Delete();
@@ -101,15 +162,43 @@ Rendering::QVTKRenderWindow::~QVTKRenderWindow() {
 void Rendering::QVTKRenderWindow::addActor(vtkActor* actor) {
 	_renderer->AddActor(actor);
 }
+//----------------------------------------------------------------------------
+void Rendering::QVTKRenderWindow::removeActor(vtkActor* actor) {
+	_renderer->RemoveActor(actor);
+	actor->ReleaseGraphicsResources(_rendererWindow);
+}
+
 //----------------------------------------------------------------------------
 void Rendering::QVTKRenderWindow::RenderScene() {
-	_rendererWindow->Render();
+	++_renderCounters.requested;
+	if (!_renderTimer->isActive())
+		_renderTimer->start();
 }
 
 //----------------------------------------------------------------------------
-void Rendering::QVTKRenderWindow::fitView() const {
-	_renderer->ResetCamera();
+void Rendering::QVTKRenderWindow::fitView() {
+	_fitViewPending = true;
+	this->RenderScene();
+}
+
+//----------------------------------------------------------------------------
+void Rendering::QVTKRenderWindow::executeScheduledRender() {
+	const bool fitView = _fitViewPending;
+	if (fitView) {
+		_renderer->ResetCamera();
+		_fitViewPending = false;
+	}
+
 	_rendererWindow->Render();
+	++_renderCounters.executed;
+
+	if (fitView)
+		_tessellator->updateLevelOfDetail(_renderer);
+}
+
+//----------------------------------------------------------------------------
+void Rendering::QVTKRenderWindow::updateLevelOfDetail() {
+	_tessellator->updateLevelOfDetail(_renderer);
 }
 //----------------------------------------------------------------------------
 void Rendering::QVTKRenderWindow::generateCoordinateSystemAxes() {
@@ -154,6 +243,155 @@ void Rendering::QVTKRenderWindow::enableWaterMark() {
 	this->_logoWidget->On();
 }
 
+//----------------------------------------------------------------------------
+void Rendering::QVTKRenderWindow::enablePerformanceOverlay(bool enable) {
+	_statsActor->SetVisibility(enable);
+	this->updateStatsObservers();
+	this->RenderScene();
+}
+
+//----------------------------------------------------------------------------
+void Rendering::QVTKRenderWindow::addViewportStatsObserver(
+	std::shared_ptr<EventObserver> observer) {
+	_statsSubject.attachObserver(observer);
+	_statsObserved = true;
+	this->updateStatsObservers();
+}
+
+//----------------------------------------------------------------------------
+void Rendering::QVTKRenderWindow::updateStatsObservers() {
+	const bool enable = _statsActor->GetVisibility() || _statsObserved;
+	if (enable == _statsEnabled)
+		return;
+
+	_statsEnabled = enable;
+	if (enable) {
+		_renderStartObserver = _rendererWindow->AddObserver(
+			vtkCommand::StartEvent, this, &Rendering::QVTKRenderWindow::onRenderStart);
+		_renderEndObserver = _rendererWindow->AddObserver(
+			vtkCommand::EndEvent, this, &Rendering::QVTKRenderWindow::onRenderEnd);
+	} else {
+		_rendererWindow->RemoveObserver(_renderStartObserver);
+		_rendererWindow->RemoveObserver(_renderEndObserver);
+	}
+}
+
+//----------------------------------------------------------------------------
+void Rendering::QVTKRenderWindow::onRenderStart() {
+	_frameStart = std::chrono::steady_clock::now();
+	if (!_statsActor->GetVisibility())
+		return;
+
+	// Overlay is drawn by this render, so it shows the scene about to be rendered and the
+	// time of the last finished frame
+	this->collectSceneStats();
+	const ViewportStatsEvent& stats = _viewportStats;
+	const std::string statsText = std::format(
+		"Frame: {:.2f} ms (avg {:.2f} ms)\nPick: {:.2f} ms\n"
+		"Actors: {}, pipelines: {}\nTriangles: {}, lines: {}, points: {}",
+		stats.frameTime, stats.averageFrameTime, stats.pickTime, stats.actorsNb,
+		stats.pipelinesNb, stats.trianglesNb, stats.linesNb, stats.pointsNb);
+	_statsActor->SetInput(statsText.c_str());
+}
+
+//----------------------------------------------------------------------------
+void Rendering::QVTKRenderWindow::onRenderEnd() {
+	const auto frameEnd = std::chrono::steady_clock::now();
+	const double frameTime
+		= std::chrono::duration<double, std::milli>(frameEnd - _frameStart).count();
+
+	_frameTimes[_framesNb % _frameTimes.size()] = frameTime;
+	++_framesNb;
+	const std::size_t samplesNb = std::min(_framesNb, _frameTimes.size());
+	_viewportStats.frameTime = frameTime;
+	_viewportStats.averageFrameTime
+		= std::accumulate(_frameTimes.begin(), _frameTimes.begin() + samplesNb, 0.0)
+		/ static_cast<double>(samplesNb);
+
+	// Scene was already collected before the render if overlay is shown
+	if (!_statsActor->GetVisibility())
+		this->collectSceneStats();
+	_statsSubject.publishEvent(_viewportStats);
+}
+
+//----------------------------------------------------------------------------
+void Rendering::QVTKRenderWindow::collectSceneStats() {
+	ViewportStatsEvent& stats = _viewportStats;
+	stats.pickTime = _interactorStyle->getLastPickTime();
+	stats.pipelinesNb = _interactorStyle->getPipelinesMapSize();
+	stats.requestedRenders = _renderCounters.requested;
+	stats.executedRenders = _renderCounters.executed;
+	stats.actorsNb = 0;
+	stats.trianglesNb = 0;
+	stats.linesNb = 0;
+	stats.pointsNb = 0;
+
+	// Count primitives of visible actors, mapper inputs are brought up to date first
+	vtkActorCollection* actors = _renderer->GetActors();
+	vtkCollectionSimpleIterator actorsIt;
+	actors->InitTraversal(actorsIt);
+	while (vtkActor* actor = actors->GetNextActor(actorsIt)) {
+		if (!actor->GetVisibility())
+			continue;
+		++stats.actorsNb;
+
+		vtkPolyDataMapper* mapper = vtkPolyDataMapper::SafeDownCast(actor->GetMapper());
+		if (mapper && mapper->GetNumberOfInputConnections(0) > 0)
+			mapper->Update();
+		vtkPolyData* polyData = mapper ? mapper->GetInput() : nullptr;
+		if (!polyData)
+			continue;
+
+		// Polygons and strips with n points are drawn as n - 2 triangles
+		vtkCellArray* polys = polyData->GetPolys();
+		vtkCellArray* strips = polyData->GetStrips();
+		vtkCellArray* lines = polyData->GetLines();
+		stats.trianglesNb
+			+= polys->GetNumberOfConnectivityIds() - 2 * polys->GetNumberOfCells();
+		stats.trianglesNb
+			+= strips->GetNumberOfConnectivityIds() - 2 * strips->GetNumberOfCells();
+		stats.linesNb += lines->GetNumberOfConnectivityIds() - lines->GetNumberOfCells();
+		stats.pointsNb += polyData->GetVerts()->GetNumberOfConnectivityIds();
+	}
+}
+
+//----------------------------------------------------------------------------
+void Rendering::QVTKRenderWindow::showPlaneWidget(
+	const double bounds[6], PlaneCallback callback) {
+	_planeCallback = std::move(callback);
+
+	auto* planeRep
+		= vtkImplicitPlaneRepresentation::SafeDownCast(_planeWidget->GetRepresentation());
+	double placeBounds[6];
+	std::copy_n(bounds, 6, placeBounds);
+	planeRep->PlaceWidget(placeBounds);
+	planeRep->SetOrigin(0.5 * (bounds[0] + bounds[1]), 0.5 * (bounds[2] + bounds[3]),
+		0.5 * (bounds[4] + bounds[5]));
+	planeRep->SetNormal(1.0, 0.0, 0.0);
+
+	_planeWidget->On();
+	this->onPlaneInteraction();
+	this->RenderScene();
+}
+
+//----------------------------------------------------------------------------
+void Rendering::QVTKRenderWindow::hidePlaneWidget() {
+	_planeWidget->Off();
+	_planeCallback = nullptr;
+	this->RenderScene();
+}
+
+//----------------------------------------------------------------------------
+void Rendering::QVTKRenderWindow::onPlaneInteraction() {
+	if (!_planeCallback)
+		return;
+
+	auto* planeRep
+		= vtkImplicitPlaneRepresentation::SafeDownCast(_planeWidget->GetRepresentation());
+	// Widget renders right after the interaction event, no render is requested here
+	_planeCallback(planeRep->GetOrigin(), planeRep->GetNormal());
+}
+
 //----------------------------------------------------------------------------
 void Rendering::QVTKRenderWindow::clearRenderer() {
 
@@ -203,17 +441,40 @@ void Rendering::QVTKRenderWindow::setWaterMark() {
 }
 
 //----------------------------------------------------------------------------
-void Rendering::QVTKRenderWindow::addShapeToRenderer(const TopoDS_Shape& shape) {
+IVtk_IdType Rendering::QVTKRenderWindow::addShapeToRenderer(const TopoDS_Shape& shape) {
+	const IVtk_IdType shapeId = ++_lastShapeId;
 
-	static Standard_Integer ShapeID
-		= _interactorStyle->getPipelinesMapSize();
-	++ShapeID;
-
-	Handle(QIVtkSelectionPipeline) pipeline = new QIVtkSelectionPipeline(shape, ShapeID);
+	const TopoDS_Shape displayShape = _tessellator->addShape(shapeId, shape);
+	Handle(QIVtkSelectionPipeline) pipeline
+		= new QIVtkSelectionPipeline(shape, displayShape, shapeId);
+	pipeline->SetVisibility(_shapesVisible);
 	pipeline->AddToRenderer(_renderer);
 
-	_interactorStyle->addPipeline(pipeline, ShapeID);
-	fitView();
+	_interactorStyle->addPipeline(pipeline, shapeId);
+	return shapeId;
+}
+
+//----------------------------------------------------------------------------
+void Rendering::QVTKRenderWindow::removeShapeFromRenderer(IVtk_IdType shapeId) {
+	Handle(QIVtkSelectionPipeline) pipeline = _interactorStyle->getPipeline(shapeId);
+	if (pipeline.IsNull())
+		return;
+
+	pipeline->RemoveFromRenderer(_renderer);
+	_interactorStyle->removePipeline(shapeId);
+	_tessellator->removeShape(shapeId);
+}
+
+//----------------------------------------------------------------------------
+void Rendering::QVTKRenderWindow::setShapesVisibility(bool visible) {
+	_shapesVisible = visible;
+
+	NCollection_List<Handle(QIVtkSelectionPipeline)> pipelinesList
+		= _interactorStyle->getPipelines();
+	NCollection_List<Handle(QIVtkSelectionPipeline)>::Iterator pIt(pipelinesList);
+	for (; pIt.More(); pIt.Next()) {
+		pIt.Value()->SetVisibility(visible);
+	}
 }
 
 //----------------------------------------------------------------------------
@@ -24,12 +24,19 @@
 class QVTKInteractorStyle;
 class QIVtkViewRepresentation;
 
+#include "QIVtkTessellator.hpp"
 #include "QIVtkViewRepresentation.hpp"
 #include "QVTKCameraOrientationWidget.hpp"
 #include "QVTKInteractorStyle.hpp"
 
+#include "ModelSubject.hpp"
+#include "ViewportStatsEvent.hpp"
+
 #include <algorithm>
 #include <array>
+#include <chrono>
+#include <functional>
+#include <memory>
 #include <numeric>
 
 #include <QVTKOpenGLNativeWidget.h>
@@ -38,7 +45,10 @@ class QIVtkViewRepresentation;
 #include <vtkAxesActor.h>
 #include <vtkCamera.h>
 #include <vtkCaptionActor2D.h>
+#include <vtkCommand.h>
 #include <vtkGenericOpenGLRenderWindow.h>
+#include <vtkImplicitPlaneRepresentation.h>
+#include <vtkImplicitPlaneWidget2.h>
 #include <vtkInteractorStyle.h>
 #include <vtkLogger.h>
 #include <vtkLogoRepresentation.h>
@@ -53,6 +63,7 @@ class QIVtkViewRepresentation;
 #include <vtkRenderWindow.h>
 #include <vtkRenderWindowInteractor.h>
 #include <vtkRenderer.h>
+#include <vtkTextActor.h>
 #include <vtkTextProperty.h>
 
 // VIS includes
@@ -61,6 +72,9 @@ class QIVtkViewRepresentation;
 #include <QImage>
 #include <QPixmap>
 #include <QPointer>
+#include <QTimer>
+
+#include <cstdint>
 
 namespace Rendering {
 
@@ -84,18 +98,38 @@ public:
 
 	/**
 	 * @brief  Adjust the displayed objects to the size of the rendering window.
+	 * Camera is reset right before the next scheduled render, so fitting requested
+	 * several times within a batch of changes is done once.
 	 *
 	 */
-	void fitView() const;
+	void fitView();
 
 	void addActor(vtkActor* actor);
 
 	/**
-	 * @brief  Reset render view to update currently displayed state.
+	 * @brief  Remove single actor from renderer and release its graphics resources.
+	 *
+	 */
+	void removeActor(vtkActor* actor);
+
+	/**
+	 * @brief  Mark render view as dirty to update currently displayed state.
+	 * Requests are coalesced, single render is executed on the next event-loop turn.
 	 *
 	 */
 	void RenderScene();
 
+	/**
+	 * @brief  Number of render requests and of renders actually executed by the scheduler.
+	 *
+	 */
+	struct RenderCounters {
+		std::uint64_t requested = 0;
+		std::uint64_t executed = 0;
+	};
+
+	const RenderCounters& getRenderCounters() const { return _renderCounters; };
+
 	/**
 	 * @brief  Enable and start displaying the camera orientation widget.
 	 *
@@ -114,11 +148,66 @@ public:
 	 */
 	void setWaterMark();
 
+	/**
+	 * @brief  Show or hide overlay with frame time, pick time and primitive counts.
+	 *
+	 */
+	void enablePerformanceOverlay(bool enable);
+
+	/**
+	 * @brief  Attach observer receiving ViewportStatsEvent after every render.
+	 * Statistics are collected only if overlay is enabled or an observer is attached.
+	 *
+	 */
+	void addViewportStatsObserver(std::shared_ptr<EventObserver> observer);
+
+	/**
+	 * @brief  Statistics of the last rendered frame.
+	 *
+	 */
+	const ViewportStatsEvent& getViewportStats() const { return _viewportStats; };
+
+	bool isPerformanceOverlayEnabled() const { return _statsActor->GetVisibility(); };
+
+	/**
+	 * @brief  Callback receiving origin and normal of the section plane.
+	 *
+	 */
+	using PlaneCallback = std::function<void(const double*, const double*)>;
+
+	/**
+	 * @brief  Show interactive plane placed within given bounds. Callback is invoked on
+	 * every interaction with the plane, so it should only update already built data.
+	 *
+	 */
+	void showPlaneWidget(const double bounds[6], PlaneCallback callback);
+
+	/**
+	 * @brief  Hide interactive plane and drop its callback.
+	 *
+	 */
+	void hidePlaneWidget();
+
 	/**
 	 * @brief  Create pipeline based on TopoDS_Shape and add it to render window.
+	 * Camera is not reset, call fitView() once all shapes of a batch are added.
+	 *
+	 * @return  ID of the created pipeline, used to remove it later.
+	 */
+	IVtk_IdType addShapeToRenderer(const TopoDS_Shape& shape);
+
+	/**
+	 * @brief  Remove pipeline with given ID from render window and release it.
+	 *
+	 */
+	void removeShapeFromRenderer(IVtk_IdType shapeId);
+
+	/**
+	 * @brief  Show or hide all shape pipelines while keeping them (and their
+	 * tessellation) alive. Pipelines created later inherit current visibility.
 	 *
 	 */
-	void addShapeToRenderer(const TopoDS_Shape& shape);
+	void setShapesVisibility(bool visible);
 
 	/**
 	 * @brief  Add existing pipelines to renderer window
@@ -144,6 +233,46 @@ public:
 		vtkRenderer::GradientModes mode, const double* col1 = nullptr, const double* col2 = nullptr);
 	void setBackground(const double* col1 = nullptr);
 
+private:
+	/**
+	 * @brief  Request finer tessellation of shapes if camera zoomed in.
+	 *
+	 */
+	void updateLevelOfDetail();
+
+	/**
+	 * @brief  Execute pending camera fit and render, called by the render timer.
+	 *
+	 */
+	void executeScheduledRender();
+
+	/**
+	 * @brief  Render window observers measuring frame time and collecting statistics.
+	 * Overlay text is updated before the render, observers are notified after it.
+	 *
+	 */
+	void onRenderStart();
+	void onRenderEnd();
+
+	/**
+	 * @brief  Attach render observers while overlay is shown or statistics are observed,
+	 * remove them otherwise.
+	 *
+	 */
+	void updateStatsObservers();
+
+	/**
+	 * @brief  Count actors and primitives of the scene and copy scheduler statistics.
+	 *
+	 */
+	void collectSceneStats();
+
+	/**
+	 * @brief  Plane widget observer passing current plane to the callback.
+	 *
+	 */
+	void onPlaneInteraction();
+
 private:
 	// ! Container widget
 	QPointer<QWidget> _widget;
@@ -177,6 +306,54 @@ private:
 
 	// ! Utility for controling view representation
 	QIVtkViewRepresentation* _qIVtkViewRepresentation;
+
+	// ! Background tessellation of displayed shapes
+	std::unique_ptr<QIVtkTessellator> _tessellator;
+
+	// ! Last ID assigned to shape pipeline
+	IVtk_IdType _lastShapeId;
+
+	// ! Visibility applied to shape pipelines
+	bool _shapesVisible;
+
+	// ! Single shot timer coalescing render requests
+	std::unique_ptr<QTimer> _renderTimer;
+
+	// ! Camera has to be reset before the next scheduled render
+	bool _fitViewPending;
+
+	// ! Statistics of the render scheduler
+	RenderCounters _renderCounters;
+
+	// ! Performance overlay
+	vtkSmartPointer<vtkTextActor> _statsActor;
+
+	// ! Publishes viewport statistics to instrumentation observers
+	ModelSubject _statsSubject;
+
+	// ! Render observers collecting statistics are attached
+	bool _statsEnabled;
+
+	// ! Statistics observer is attached
+	bool _statsObserved;
+
+	// ! Statistics of the last frame
+	ViewportStatsEvent _viewportStats;
+
+	// ! Frame times used for rolling average [ms]
+	std::array<double, 30> _frameTimes;
+	std::size_t _framesNb;
+	std::chrono::steady_clock::time_point _frameStart;
+
+	// ! Tags of render observers, valid while statistics are collected
+	unsigned long _renderStartObserver;
+	unsigned long _renderEndObserver;
+
+	// ! Interactive section plane
+	vtkSmartPointer<vtkImplicitPlaneWidget2> _planeWidget;
+
+	// ! Receiver of section plane updates
+	PlaneCallback _planeCallback;
 };
 };
 
@@ -30,6 +30,11 @@ QString FileDialogUtils::getFileSelection(const QString &actionName,
     return fname;
 }
 
+QString FileDialogUtils::getSaveFileSelection(const QString &actionName,
+                                              const QString &filter,
+                                              QWidget *parent) {
+    return QFileDialog::getSaveFileName(parent, actionName, "", filter);
+}
 
 int FileDialogUtils::executeWithFileSelection(
     std::function<void(QString)> action, const QString &actionName,
@@ -32,6 +32,8 @@
 namespace FileDialogUtils {
     constexpr auto FilterSTEP = "STEP Files (*.step *.stp)";
     constexpr auto FilterSTL = "STL Files (*.stl)";
+    constexpr auto FilterMesh = "VTK Unstructured Grid (*.vtu);;Gmsh Mesh (*.msh);;Abaqus Input (*.inp)";
+    constexpr auto FilterMeshImport = "Mesh Files (*.vtu *.msh)";
     constexpr auto FilterAll = "All Files (*)";
 
     /**
@@ -43,6 +45,15 @@ namespace FileDialogUtils {
     QString getFileSelection(const QString &actionName, const QString &filter,
                              QWidget *parent = nullptr);
 
+    /**
+     * @brief Creates a filedialog window and returns path of the file to be saved.
+     * @param actionName - name of the filedialog window that will be displayed in top bar.
+     * @param filter - file extension filter - use FileDialogUtils::filterName.
+     * @param parent - parent that will be assigned to filedialog window.
+     */
+    QString getSaveFileSelection(const QString &actionName, const QString &filter,
+                                 QWidget *parent = nullptr);
+
     /**
      * @brief Creates a filedialog window and calls action with the selected file path as an argument
      * @param action - callable with QString argument that will be called upon confirming file selection